@@ -24,7 +24,11 @@
 
 #include "config.h"
 
+#include <iomanip>
+#include <iostream>
+
 #include <QApplication>
+#include <QElapsedTimer>
 #include <QQmlApplicationEngine>
 #include <QQuickWindow>
 #ifndef Q_OS_WASM
@@ -58,6 +62,8 @@ void AppShell::addModule(modularity::IModuleSetup* module)
 
 int AppShell::run(int argc, char** argv)
 {
+    m_startupTimer.start();
+
     // ====================================================
     // Setup global Qt application variables
     // ====================================================
@@ -92,22 +98,22 @@ int AppShell::run(int argc, char** argv)
     // ====================================================
     // Setup modules: Resources, Exports, Imports, UiTypes
     // ====================================================
-    globalModule.registerResources();
-    globalModule.registerExports();
-    globalModule.registerUiTypes();
+    measureStartup(&globalModule, StartupPhase::Resources, []() { globalModule.registerResources(); });
+    measureStartup(&globalModule, StartupPhase::Exports, []() { globalModule.registerExports(); });
+    measureStartup(&globalModule, StartupPhase::UiTypes, []() { globalModule.registerUiTypes(); });
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerResources();
+        measureStartup(m, StartupPhase::Resources, [m]() { m->registerResources(); });
     }
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerExports();
+        measureStartup(m, StartupPhase::Exports, [m]() { m->registerExports(); });
     }
 
-    globalModule.resolveImports();
+    measureStartup(&globalModule, StartupPhase::Imports, []() { globalModule.resolveImports(); });
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerUiTypes();
-        m->resolveImports();
+        measureStartup(m, StartupPhase::UiTypes, [m]() { m->registerUiTypes(); });
+        measureStartup(m, StartupPhase::Imports, [m]() { m->resolveImports(); });
     }
 
     // ====================================================
@@ -117,30 +123,35 @@ int AppShell::run(int argc, char** argv)
     commandLine.parse(QCoreApplication::arguments());
     commandLine.apply();
     framework::IApplication::RunMode runMode = muapplication()->runMode();
+    bool startupProfile = commandLine.isStartupProfileEnabled();
 
     // ====================================================
     // Setup modules: onInit
     // ====================================================
-    globalModule.onInit(runMode);
+    measureStartup(&globalModule, StartupPhase::Init, [runMode]() { globalModule.onInit(runMode); });
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onInit(runMode);
+        measureStartup(m, StartupPhase::Init, [m, runMode]() { m->onInit(runMode); });
     }
 
     // ====================================================
     // Setup modules: onAllInited
     // ====================================================
-    globalModule.onAllInited(runMode);
+    measureStartup(&globalModule, StartupPhase::AllInited, [runMode]() { globalModule.onAllInited(runMode); });
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onAllInited(runMode);
+        measureStartup(m, StartupPhase::AllInited, [m, runMode]() { m->onAllInited(runMode); });
     }
 
     // ====================================================
     // Setup modules: onStartApp (on next event loop)
     // ====================================================
-    QMetaObject::invokeMethod(qApp, [this]() {
-        globalModule.onStartApp();
+    QMetaObject::invokeMethod(qApp, [this, startupProfile]() {
+        measureStartup(&globalModule, StartupPhase::StartApp, []() { globalModule.onStartApp(); });
         for (mu::modularity::IModuleSetup* m : m_modules) {
-            m->onStartApp();
+            measureStartup(m, StartupPhase::StartApp, [m]() { m->onStartApp(); });
+        }
+
+        if (startupProfile) {
+            printStartupProfile();
         }
     }, Qt::QueuedConnection);
 
@@ -148,15 +159,27 @@ int AppShell::run(int argc, char** argv)
     // Run
     // ====================================================
 
+    std::unique_ptr<ConverterServer> converterServer;
+
     switch (runMode) {
     case framework::IApplication::RunMode::Converter: {
         // ====================================================
         // Process Converter
         // ====================================================
         auto task = commandLine.converterTask();
+        if (task.type == CommandLineController::ConvertType::Server) {
+            QMetaObject::invokeMethod(qApp, [this, task, &converterServer]() {
+                    int code = startConverterServer(task, converterServer);
+                    if (code != 0) {
+                        qApp->exit(code);
+                    }
+                }, Qt::QueuedConnection);
+            break;
+        }
+
         QMetaObject::invokeMethod(qApp, [this, task]() {
-                int code = processConverter(task);
-                qApp->exit(code);
+                Ret ret = processConverter(task);
+                qApp->exit(ret.code());
             }, Qt::QueuedConnection);
     } break;
     case framework::IApplication::RunMode::Editor: {
@@ -229,6 +252,8 @@ int AppShell::run(int argc, char** argv)
     // ====================================================
     int retCode = app.exec();
 
+    converterServer.reset();
+
     // ====================================================
     // Quit
     // ====================================================
@@ -268,7 +293,76 @@ int AppShell::run(int argc, char** argv)
     return retCode;
 }
 
-int AppShell::processConverter(const CommandLineController::ConverterTask& task)
+void AppShell::measureStartup(const modularity::IModuleSetup* module, StartupPhase phase, const std::function<void()>& func)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    func();
+
+    m_startupTimes[module->moduleName()][phase] += timer.nsecsElapsed() / 1000000.0;
+}
+
+void AppShell::printStartupProfile() const
+{
+    static const std::vector<std::pair<StartupPhase, std::string> > PHASES = {
+        { StartupPhase::Resources, "resources" },
+        { StartupPhase::Exports, "exports" },
+        { StartupPhase::UiTypes, "uiTypes" },
+        { StartupPhase::Imports, "imports" },
+        { StartupPhase::Init, "onInit" },
+        { StartupPhase::AllInited, "onAllInited" },
+        { StartupPhase::StartApp, "onStartApp" }
+    };
+
+    constexpr int NAME_WIDTH = 20;
+    constexpr int TIME_WIDTH = 12;
+
+    //! NOTE Printed to stderr, in the converter mode stdout may be the output of the conversion
+    std::ostream& stream = std::cerr;
+    stream << std::fixed << std::setprecision(2);
+    stream << "Startup profile (ms):\n";
+
+    stream << std::left << std::setw(NAME_WIDTH) << "module" << std::right;
+    for (const auto& phase : PHASES) {
+        stream << std::setw(TIME_WIDTH) << phase.second;
+    }
+    stream << std::setw(TIME_WIDTH) << "total" << "\n";
+
+    std::vector<const modularity::IModuleSetup*> modules = { &globalModule };
+    modules.insert(modules.end(), m_modules.cbegin(), m_modules.cend());
+
+    std::map<StartupPhase, double> phasesTotal;
+    for (const modularity::IModuleSetup* m : modules) {
+        auto it = m_startupTimes.find(m->moduleName());
+        if (it == m_startupTimes.cend()) {
+            continue;
+        }
+
+        double moduleTotal = 0.0;
+        stream << std::left << std::setw(NAME_WIDTH) << m->moduleName() << std::right;
+        for (const auto& phase : PHASES) {
+            auto phaseIt = it->second.find(phase.first);
+            double ms = phaseIt != it->second.cend() ? phaseIt->second : 0.0;
+            phasesTotal[phase.first] += ms;
+            moduleTotal += ms;
+            stream << std::setw(TIME_WIDTH) << ms;
+        }
+        stream << std::setw(TIME_WIDTH) << moduleTotal << "\n";
+    }
+
+    double total = 0.0;
+    stream << std::left << std::setw(NAME_WIDTH) << "total" << std::right;
+    for (const auto& phase : PHASES) {
+        total += phasesTotal[phase.first];
+        stream << std::setw(TIME_WIDTH) << phasesTotal[phase.first];
+    }
+    stream << std::setw(TIME_WIDTH) << total << "\n";
+
+    stream << "Startup time (ms): " << m_startupTimer.nsecsElapsed() / 1000000.0 << std::endl;
+}
+
+mu::Ret AppShell::processConverter(const CommandLineController::ConverterTask& task)
 {
     Ret ret = make_ret(Ret::Code::Ok);
     io::path_t stylePath = task.params[CommandLineController::ParamKey::StylePath].toString();
@@ -308,11 +402,39 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
         std::string scoreSource = task.params[CommandLineController::ParamKey::ScoreSource].toString().toStdString();
         ret = converter()->updateSource(task.inputFile, scoreSource, forceMode);
     } break;
+    case CommandLineController::ConvertType::ExportScoreDiff: {
+        io::path_t scoreDiffFile = task.params[CommandLineController::ParamKey::ScoreDiffFile].toString();
+        ret = converter()->exportScoreDiff(task.inputFile, scoreDiffFile, task.outputFile, forceMode);
+    } break;
+    case CommandLineController::ConvertType::Server:
+        UNREACHABLE;
+        ret = make_ret(Ret::Code::NotSupported);
+        break;
     }
 
     if (!ret) {
         LOGE() << "failed convert, error: " << ret.toString();
     }
 
+    return ret;
+}
+
+int AppShell::startConverterServer(const CommandLineController::ConverterTask& task, std::unique_ptr<ConverterServer>& server)
+{
+    server = std::make_unique<ConverterServer>([this](const CommandLineController::ConverterTask& job) {
+        return processConverter(job);
+    }, []() {
+        qApp->exit(0);
+    });
+
+    if (task.params.contains(CommandLineController::ParamKey::ServerMaxQueuedJobs)) {
+        server->setMaxQueuedJobs(task.params[CommandLineController::ParamKey::ServerMaxQueuedJobs].toInt());
+    }
+
+    Ret ret = server->start(task.params[CommandLineController::ParamKey::ServerSocketName].toString());
+    if (!ret) {
+        LOGE() << "failed start converter server, error: " << ret.toString();
+    }
+
     return ret.code();
 }
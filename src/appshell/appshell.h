@@ -23,6 +23,11 @@
 #ifndef MU_APPSHELL_APPSHELL_H
 #define MU_APPSHELL_APPSHELL_H
 
+#include <functional>
+#include <map>
+#include <memory>
+
+#include <QElapsedTimer>
 #include <QList>
 
 #include "modularity/imodulesetup.h"
@@ -31,6 +36,7 @@
 #include "converter/iconvertercontroller.h"
 
 #include "commandlinecontroller.h"
+#include "converterserver.h"
 
 namespace mu::appshell {
 class AppShell
@@ -46,10 +52,26 @@ public:
     int run(int argc, char** argv);
 
 private:
+    enum class StartupPhase {
+        Resources,
+        Exports,
+        UiTypes,
+        Imports,
+        Init,
+        AllInited,
+        StartApp
+    };
+
+    void measureStartup(const modularity::IModuleSetup* module, StartupPhase phase, const std::function<void()>& func);
+    void printStartupProfile() const;
 
-    int processConverter(const CommandLineController::ConverterTask& task);
+    Ret processConverter(const CommandLineController::ConverterTask& task);
+    int startConverterServer(const CommandLineController::ConverterTask& task, std::unique_ptr<ConverterServer>& server);
 
     QList<modularity::IModuleSetup*> m_modules;
+
+    QElapsedTimer m_startupTimer;
+    std::map<std::string, std::map<StartupPhase, double> > m_startupTimes;
 };
 }
 
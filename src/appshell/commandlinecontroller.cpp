@@ -38,6 +38,7 @@ void CommandLineController::parse(const QStringList& args)
 
     m_parser.addOption(QCommandLineOption("long-version", "Print detailed version information"));
     m_parser.addOption(QCommandLineOption({ "d", "debug" }, "Debug mode"));
+    m_parser.addOption(QCommandLineOption("startup-profile", "Print the startup time of each module to stderr"));
 
     m_parser.addOption(QCommandLineOption({ "D", "monitor-resolution" }, "Specify monitor resolution", "DPI"));
     m_parser.addOption(QCommandLineOption({ "T", "trim-image" },
@@ -73,9 +74,21 @@ void CommandLineController::parse(const QStringList& args)
                                           "Transpose the given score and export the data to a single JSON file, print it to stdout",
                                           "options"));
     m_parser.addOption(QCommandLineOption("source-update", "Update the source in the given score"));
+    m_parser.addOption(QCommandLineOption("score-diff",
+                                          "Compare the two given scores element by element, export the changes to a JSON document "
+                                          "and print it to stdout"));
 
     m_parser.addOption(QCommandLineOption({ "S", "style" }, "Load style file", "style"));
 
+    m_parser.addOption(QCommandLineOption("converter-server",
+                                          "Process converter jobs (JSON documents, one per line) read from stdin, "
+                                          "print a JSON response per job to stdout"));
+    m_parser.addOption(QCommandLineOption("converter-server-socket",
+                                          "Use with '--converter-server', read the jobs from the clients of the given local socket",
+                                          "name"));
+    m_parser.addOption(QCommandLineOption("converter-server-queue",
+                                          "Use with '--converter-server', max number of jobs waiting to be processed", "count"));
+
     // Video export
     m_parser.addOption(QCommandLineOption("score-video", "Generate video for the given score and export it to file"));
 // not implemented
@@ -259,6 +272,36 @@ void CommandLineController::apply()
         }
     }
 
+    if (m_parser.isSet("score-diff")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::ExportScoreDiff;
+
+        if (scorefiles.size() < 2) {
+            LOGE() << "Option: --score-diff two input files required";
+        } else {
+            m_converterTask.inputFile = scorefiles[0];
+            m_converterTask.params[CommandLineController::ParamKey::ScoreDiffFile] = scorefiles[1];
+        }
+    }
+
+    if (m_parser.isSet("converter-server")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::Server;
+
+        if (m_parser.isSet("converter-server-socket")) {
+            m_converterTask.params[CommandLineController::ParamKey::ServerSocketName] = m_parser.value("converter-server-socket");
+        }
+
+        if (m_parser.isSet("converter-server-queue")) {
+            std::optional<int> val = intValue("converter-server-queue");
+            if (val && val.value() > 0) {
+                m_converterTask.params[CommandLineController::ParamKey::ServerMaxQueuedJobs] = val.value();
+            } else {
+                LOGE() << "Option: --converter-server-queue not recognized value: " << m_parser.value("converter-server-queue");
+            }
+        }
+    }
+
     // Video
 #ifdef BUILD_VIDEOEXPORT_MODULE
     if (m_parser.isSet("score-video")) {
@@ -363,6 +406,11 @@ CommandLineController::ConverterTask CommandLineController::converterTask() cons
     return m_converterTask;
 }
 
+bool CommandLineController::isStartupProfileEnabled() const
+{
+    return m_parser.isSet("startup-profile");
+}
+
 void CommandLineController::printLongVersion() const
 {
     if (Version::unstable()) {
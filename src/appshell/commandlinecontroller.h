@@ -64,7 +64,9 @@ public:
         ExportScorePartsPdf,
         ExportScoreTranspose,
         SourceUpdate,
-        ExportScoreVideo
+        ExportScoreDiff,
+        ExportScoreVideo,
+        Server
     };
 
     enum class ParamKey {
@@ -72,8 +74,13 @@ public:
         StylePath,
         ScoreSource,
         ScoreTransposeOptions,
+        ScoreDiffFile,
         ForceMode,
 
+        // Server
+        ServerSocketName,
+        ServerMaxQueuedJobs,
+
         // Video
     };
 
@@ -91,6 +98,8 @@ public:
 
     ConverterTask converterTask() const;
 
+    bool isStartupProfileEnabled() const;
+
 private:
     void printLongVersion() const;
 
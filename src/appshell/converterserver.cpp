@@ -0,0 +1,410 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "converterserver.h"
+
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLocalServer>
+#include <QLocalSocket>
+
+#include "converter/convertercodes.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::appshell;
+
+using ConvertType = CommandLineController::ConvertType;
+using ParamKey = CommandLineController::ParamKey;
+
+static const QString QUIT_JOB_TYPE("quit");
+
+static const std::map<QString, ConvertType> JOB_TYPES = {
+    { "convert", ConvertType::File },
+    { "convert-score-parts", ConvertType::ConvertScoreParts },
+    { "batch", ConvertType::Batch },
+    { "score-media", ConvertType::ExportScoreMedia },
+    { "score-meta", ConvertType::ExportScoreMeta },
+    { "score-parts", ConvertType::ExportScoreParts },
+    { "score-parts-pdf", ConvertType::ExportScorePartsPdf },
+    { "score-transpose", ConvertType::ExportScoreTranspose },
+    { "score-video", ConvertType::ExportScoreVideo },
+    { "source-update", ConvertType::SourceUpdate },
+    { "score-diff", ConvertType::ExportScoreDiff }
+};
+
+//! NOTE Without the output file these jobs print the result to stdout
+static bool isOutputFileRequired(ConvertType type)
+{
+    switch (type) {
+    case ConvertType::Batch:
+    case ConvertType::SourceUpdate:
+        return false;
+    default:
+        break;
+    }
+
+    return true;
+}
+
+ConverterServer::ConverterServer(const JobProcessor& processor, const OnFinished& onFinished)
+    : m_processor(processor), m_onFinished(onFinished)
+{
+}
+
+ConverterServer::~ConverterServer()
+{
+    stopReadingInput();
+
+    delete m_server;
+}
+
+void ConverterServer::setMaxQueuedJobs(int count)
+{
+    IF_ASSERT_FAILED(count > 0) {
+        return;
+    }
+
+    m_maxQueuedJobs = count;
+}
+
+Ret ConverterServer::start(const QString& socketName)
+{
+    if (socketName.isEmpty()) {
+        //! NOTE std::cin is never destroyed
+        return start(std::shared_ptr<std::istream>(&std::cin, [](std::istream*) {}));
+    }
+
+    //! NOTE Remove the socket file left by a crashed server
+    QLocalServer::removeServer(socketName);
+
+    m_server = new QLocalServer();
+    if (!m_server->listen(socketName)) {
+        LOGE() << "failed listen: " << m_server->errorString();
+        return make_ret(Ret::Code::UnknownError, m_server->errorString());
+    }
+
+    QObject::connect(m_server, &QLocalServer::newConnection, [this]() {
+        QLocalSocket* socket = m_server->nextPendingConnection();
+        if (!socket) {
+            return;
+        }
+
+        QObject::connect(socket, &QLocalSocket::readyRead, [this, socket]() {
+            while (socket->canReadLine()) {
+                onJobReceived(socket->readLine().trimmed(), false, socket);
+            }
+        });
+
+        QObject::connect(socket, &QLocalSocket::disconnected, socket, &QLocalSocket::deleteLater);
+    });
+
+    LOGI() << "listening: " << m_server->fullServerName();
+
+    return make_ok();
+}
+
+Ret ConverterServer::start(std::shared_ptr<std::istream> input)
+{
+    IF_ASSERT_FAILED(input && !m_input) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    m_input = std::make_shared<InputState>();
+    m_input->stream = input;
+    m_input->server = this;
+    m_input->freeSlots.release(m_maxQueuedJobs);
+
+    m_inputThread = std::thread(&ConverterServer::th_readInput, m_input);
+
+    return make_ok();
+}
+
+void ConverterServer::th_readInput(std::shared_ptr<InputState> state)
+{
+    std::string line;
+
+    auto isReading = [&state]() {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        return state->server != nullptr;
+    };
+
+    while (true) {
+        state->freeSlots.acquire();
+
+        if (!isReading()) {
+            break;
+        }
+
+        if (!std::getline(*state->stream, line)) {
+            break;
+        }
+
+        QByteArray data = QByteArray::fromStdString(line).trimmed();
+
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->server) {
+            break;
+        }
+
+        //! NOTE The server is checked again in the main thread, it may be stopped before the call
+        QMetaObject::invokeMethod(qApp, [state, data]() {
+            if (state->server) {
+                state->server->onJobReceived(data, true, nullptr);
+            }
+        }, Qt::QueuedConnection);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->server) {
+            QMetaObject::invokeMethod(qApp, [state]() {
+                if (state->server) {
+                    state->server->m_inputEnded = true;
+                    state->server->finishIfDone();
+                }
+            }, Qt::QueuedConnection);
+        }
+    }
+
+    state->threadFinished = true;
+}
+
+void ConverterServer::stopReadingInput()
+{
+    if (!m_input) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_input->mutex);
+        m_input->server = nullptr;
+    }
+
+    //! NOTE Wake up the thread if it is waiting for a free slot
+    m_input->freeSlots.release();
+
+    if (m_inputThread.joinable()) {
+        //! NOTE The thread may still be waiting for a line, it only touches the shared state
+        if (m_input->threadFinished) {
+            m_inputThread.join();
+        } else {
+            m_inputThread.detach();
+        }
+    }
+}
+
+void ConverterServer::onJobReceived(const QByteArray& data, bool fromStdin, QLocalSocket* client)
+{
+    //! NOTE The jobs received after the quit job are ignored
+    if (m_finished) {
+        return;
+    }
+
+    if (data.isEmpty()) {
+        if (fromStdin) {
+            m_input->freeSlots.release();
+        }
+        return;
+    }
+
+    RetVal<Job> job = parseJob(data);
+    job.val.fromStdin = fromStdin;
+    job.val.client = client;
+
+    if (!job.ret) {
+        sendResponse(job.val, job.ret, 0);
+        return;
+    }
+
+    if (static_cast<int>(m_queue.size()) >= m_maxQueuedJobs) {
+        sendResponse(job.val, converter::make_ret(converter::Err::ServerQueueFull, "too many queued jobs"), 0);
+        return;
+    }
+
+    m_queue.push(job.val);
+    scheduleNextJob();
+}
+
+RetVal<ConverterServer::Job> ConverterServer::parseJob(const QByteArray& data) const
+{
+    QJsonParseError err;
+    QJsonDocument doc = QJsonDocument::fromJson(data, &err);
+    if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+        return converter::make_ret(converter::Err::ServerJobFailedParse, err.errorString().toStdString());
+    }
+
+    QJsonObject obj = doc.object();
+
+    RetVal<Job> result;
+    result.val.id = obj.value("id");
+
+    QString type = obj.value("type").toString("convert");
+    if (type == QUIT_JOB_TYPE) {
+        result.val.quit = true;
+        result.ret = make_ok();
+        return result;
+    }
+
+    auto typeIt = JOB_TYPES.find(type);
+    if (typeIt == JOB_TYPES.cend()) {
+        result.ret = converter::make_ret(converter::Err::ConvertTypeUnknown, "unknown job type: " + type.toStdString());
+        return result;
+    }
+
+    CommandLineController::ConverterTask& task = result.val.task;
+    task.type = typeIt->second;
+    task.inputFile = obj.value("in").toString();
+    task.outputFile = obj.value("out").toString();
+
+    if (task.inputFile.isEmpty()) {
+        result.ret = converter::make_ret(converter::Err::ServerJobFailedParse, "no input file specified");
+        return result;
+    }
+
+    if (task.outputFile.isEmpty() && isOutputFileRequired(task.type)) {
+        result.ret = converter::make_ret(converter::Err::ServerJobFailedParse, "no output file specified");
+        return result;
+    }
+
+    task.params[ParamKey::StylePath] = obj.value("style").toString();
+    task.params[ParamKey::ForceMode] = obj.value("force").toBool();
+
+    if (obj.contains("highlightConfig")) {
+        task.params[ParamKey::HighlightConfigPath] = obj.value("highlightConfig").toString();
+    }
+
+    if (obj.contains("source")) {
+        task.params[ParamKey::ScoreSource] = obj.value("source").toString();
+    }
+
+    if (task.type == ConvertType::ExportScoreDiff) {
+        QString diffFile = obj.value("in2").toString();
+        if (diffFile.isEmpty()) {
+            result.ret = converter::make_ret(converter::Err::ServerJobFailedParse, "no second input file specified");
+            return result;
+        }
+
+        task.params[ParamKey::ScoreDiffFile] = diffFile;
+    }
+
+    //! NOTE The transpose options may be given as a JSON object or as a string, like on the command line
+    QJsonValue transposeOptions = obj.value("transposeOptions");
+    if (transposeOptions.isObject()) {
+        task.params[ParamKey::ScoreTransposeOptions] = QString::fromUtf8(QJsonDocument(transposeOptions.toObject()).toJson(
+                                                                              QJsonDocument::Compact));
+    } else if (transposeOptions.isString()) {
+        task.params[ParamKey::ScoreTransposeOptions] = transposeOptions.toString();
+    }
+
+    result.ret = make_ok();
+    return result;
+}
+
+void ConverterServer::scheduleNextJob()
+{
+    if (m_nextJobScheduled || m_queue.empty()) {
+        return;
+    }
+
+    //! NOTE One job per event loop iteration, so the new jobs and the clients are handled between them
+    m_nextJobScheduled = true;
+    QMetaObject::invokeMethod(qApp, [this]() {
+        m_nextJobScheduled = false;
+        processNextJob();
+    }, Qt::QueuedConnection);
+}
+
+void ConverterServer::processNextJob()
+{
+    if (m_finished || m_queue.empty()) {
+        return;
+    }
+
+    Job job = m_queue.front();
+    m_queue.pop();
+
+    if (job.quit) {
+        sendResponse(job, make_ok(), 0);
+        m_finished = true;
+        stopReadingInput();
+        m_onFinished();
+        return;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    Ret ret = m_processor(job.task);
+
+    //! NOTE Don't keep the project of this job alive until the next one
+    if (globalContext()->currentProject()) {
+        globalContext()->setCurrentProject(nullptr);
+    }
+
+    sendResponse(job, ret, timer.elapsed());
+
+    scheduleNextJob();
+    finishIfDone();
+}
+
+void ConverterServer::sendResponse(const Job& job, const Ret& ret, qint64 elapsedMs)
+{
+    QJsonObject response;
+    response["id"] = job.id;
+    response["success"] = ret.success();
+    response["code"] = ret.code();
+    response["error"] = QString::fromStdString(ret.success() ? std::string() : ret.text());
+    response["elapsed"] = elapsedMs;
+
+    QByteArray data = QJsonDocument(response).toJson(QJsonDocument::Compact);
+    data.append('\n');
+
+    if (job.fromStdin) {
+        std::cout.write(data.constData(), data.size());
+        std::cout.flush();
+
+        m_input->freeSlots.release();
+        return;
+    }
+
+    if (job.client) {
+        job.client->write(data);
+        job.client->flush();
+    }
+}
+
+void ConverterServer::finishIfDone()
+{
+    if (m_finished || !m_inputEnded || !m_queue.empty()) {
+        return;
+    }
+
+    m_finished = true;
+    m_onFinished();
+}
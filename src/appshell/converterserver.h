@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_APPSHELL_CONVERTERSERVER_H
+#define MU_APPSHELL_CONVERTERSERVER_H
+
+#include <atomic>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include <QJsonValue>
+#include <QPointer>
+#include <QSemaphore>
+
+#include "modularity/ioc.h"
+#include "context/iglobalcontext.h"
+#include "retval.h"
+
+#include "commandlinecontroller.h"
+
+class QLocalServer;
+class QLocalSocket;
+
+namespace mu::appshell {
+//! NOTE Processes a stream of converter jobs, so the application is initialized once for all of them.
+//! A job is a JSON document on a single line, for example:
+//! { "id": 1, "type": "convert", "in": "score.mscz", "out": "score.pdf" }
+//! The response to it is a JSON document on a single line too:
+//! { "id": 1, "success": true, "code": 0, "error": "", "elapsed": 120 }
+//!
+//! The jobs are read from stdin (the responses are written to stdout) or from the clients of a local socket.
+//! Engraving isn't thread safe, so the jobs are processed one by one in the main thread,
+//! the number of jobs waiting in the queue is limited
+class ConverterServer
+{
+    INJECT(appshell, context::IGlobalContext, globalContext)
+
+public:
+    using JobProcessor = std::function<Ret (const CommandLineController::ConverterTask& task)>;
+    using OnFinished = std::function<void ()>;
+
+    static constexpr int DEFAULT_MAX_QUEUED_JOBS = 16;
+
+    ConverterServer(const JobProcessor& processor, const OnFinished& onFinished);
+    ~ConverterServer();
+
+    void setMaxQueuedJobs(int count);
+
+    //! NOTE If the socket name is empty, the jobs are read from stdin until its end
+    Ret start(const QString& socketName = QString());
+
+    //! NOTE Reads the jobs from the given stream until its end
+    Ret start(std::shared_ptr<std::istream> input);
+
+private:
+    struct Job {
+        QJsonValue id;
+        CommandLineController::ConverterTask task;
+        bool quit = false;
+        bool fromStdin = false;
+        QPointer<QLocalSocket> client;
+    };
+
+    //! NOTE Shared with the input thread, which may outlive the server:
+    //! a thread waiting for a line of stdin can't be interrupted
+    struct InputState {
+        std::shared_ptr<std::istream> stream;
+
+        //! NOTE The input isn't read further while the queue is full
+        QSemaphore freeSlots;
+
+        //! NOTE Reset in the main thread when the server stops reading,
+        //! nothing is posted to the main thread after that
+        std::mutex mutex;
+        ConverterServer* server = nullptr;
+
+        std::atomic<bool> threadFinished { false };
+    };
+
+    static void th_readInput(std::shared_ptr<InputState> state);
+    void stopReadingInput();
+
+    void onJobReceived(const QByteArray& data, bool fromStdin, QLocalSocket* client);
+    RetVal<Job> parseJob(const QByteArray& data) const;
+
+    void scheduleNextJob();
+    void processNextJob();
+    void sendResponse(const Job& job, const Ret& ret, qint64 elapsedMs);
+
+    void finishIfDone();
+
+    JobProcessor m_processor;
+    OnFinished m_onFinished;
+    int m_maxQueuedJobs = DEFAULT_MAX_QUEUED_JOBS;
+
+    QLocalServer* m_server = nullptr;
+
+    std::shared_ptr<InputState> m_input;
+    std::thread m_inputThread;
+    bool m_inputEnded = false;
+
+    std::queue<Job> m_queue;
+    bool m_nextJobScheduled = false;
+    bool m_finished = false;
+};
+}
+
+#endif // MU_APPSHELL_CONVERTERSERVER_H
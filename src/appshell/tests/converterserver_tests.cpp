@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+
+#include "appshell/converterserver.h"
+
+using namespace mu;
+using namespace mu::appshell;
+
+class AppShell_ConverterServerTests : public ::testing::Test
+{
+public:
+    static void processEventsUntil(const std::function<bool()>& condition, int timeoutMs = 5000)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        while (!condition() && timer.elapsed() < timeoutMs) {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+    }
+};
+
+TEST_F(AppShell_ConverterServerTests, QuitJobFollowedByMoreInput)
+{
+    //! [GIVEN] The input has more jobs after the quit job
+    auto input = std::make_shared<std::istringstream>(
+        "{ \"id\": 1, \"type\": \"quit\" }\n"
+        "{ \"id\": 2, \"type\": \"convert\", \"in\": \"score.mscz\", \"out\": \"score.pdf\" }\n"
+        "\n"
+        "{ \"id\": 3, \"type\": \"convert\", \"in\": \"score.mscz\", \"out\": \"score.png\" }\n");
+
+    int processedCount = 0;
+    int finishedCount = 0;
+
+    auto server = std::make_unique<ConverterServer>([&processedCount](const CommandLineController::ConverterTask&) {
+        ++processedCount;
+        return make_ok();
+    }, [&finishedCount]() {
+        ++finishedCount;
+    });
+
+    server->setMaxQueuedJobs(1);
+
+    //! [WHEN] The server reads the input
+    ASSERT_TRUE(server->start(input));
+    processEventsUntil([&finishedCount]() { return finishedCount > 0; });
+
+    //! [THEN] The server is finished by the quit job, the next jobs aren't processed
+    EXPECT_EQ(finishedCount, 1);
+    EXPECT_EQ(processedCount, 0);
+
+    //! [WHEN] The server is destroyed while the input thread may still be running
+    server.reset();
+    processEventsUntil([]() { return false; }, 100);
+
+    //! [THEN] Nothing is delivered to the destroyed server
+    EXPECT_EQ(finishedCount, 1);
+    EXPECT_EQ(processedCount, 0);
+}
+
+TEST_F(AppShell_ConverterServerTests, DestroyBeforeInputIsProcessed)
+{
+    //! [GIVEN] The server has read some jobs which aren't processed yet
+    auto input = std::make_shared<std::istringstream>(
+        "{ \"id\": 1, \"type\": \"convert\", \"in\": \"score.mscz\", \"out\": \"score.pdf\" }\n"
+        "{ \"id\": 2, \"type\": \"quit\" }\n");
+
+    int processedCount = 0;
+    int finishedCount = 0;
+
+    auto server = std::make_unique<ConverterServer>([&processedCount](const CommandLineController::ConverterTask&) {
+        ++processedCount;
+        return make_ok();
+    }, [&finishedCount]() {
+        ++finishedCount;
+    });
+
+    ASSERT_TRUE(server->start(input));
+
+    //! [WHEN] The server is destroyed without running the event loop
+    server.reset();
+    processEventsUntil([]() { return false; }, 100);
+
+    //! [THEN] The jobs posted by the input thread are dropped
+    EXPECT_EQ(finishedCount, 0);
+    EXPECT_EQ(processedCount, 0);
+}
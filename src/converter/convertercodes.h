@@ -39,6 +39,9 @@ enum class Err {
 
     OutFileFailedOpen = 1330,
     OutFileFailedWrite = 1331,
+
+    ServerJobFailedParse = 1340,
+    ServerQueueFull = 1341,
 };
 
 inline Ret make_ret(Err e)
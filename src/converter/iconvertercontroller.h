@@ -53,6 +53,8 @@ public:
 
     virtual Ret exportScoreVideo(const io::path_t& in, const io::path_t& out) = 0;
 
+    virtual Ret exportScoreDiff(const io::path_t& in1, const io::path_t& in2, const io::path_t& out, bool forceMode = false) = 0;
+
     virtual Ret updateSource(const io::path_t& in, const std::string& newSource, bool forceMode = false) = 0;
 };
 }
@@ -21,8 +21,10 @@
  */
 #include "backendapi.h"
 
+#include <memory>
 #include <stdio.h>
 
+#include <QBuffer>
 #include <QString>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -34,7 +36,10 @@
 
 #include "engraving/compat/scoreaccess.h"
 #include "engraving/infrastructure/io/mscwriter.h"
+#include "engraving/libmscore/engravingitem.h"
 #include "engraving/libmscore/excerpt.h"
+#include "engraving/libmscore/property.h"
+#include "engraving/libmscore/scorestructurediff.h"
 
 #include "backendjsonwriter.h"
 #include "notationmeta.h"
@@ -60,6 +65,52 @@ static const std::string META_DATA_NAME = "metadata";
 static constexpr bool ADD_SEPARATOR = true;
 static constexpr auto NO_STYLE = "";
 
+static QJsonObject scoreDiffJson(const Ms::Score* score1, const Ms::Score* score2)
+{
+    TRACEFUNC
+
+    Ms::ScoreStructureDiff diff(score1, score2);
+    diff.update();
+
+    auto diffTypeName = [](Ms::DiffType type) -> QString {
+        switch (type) {
+        case Ms::DiffType::INSERT: return "insert";
+        case Ms::DiffType::DELETE: return "delete";
+        case Ms::DiffType::REPLACE: return "replace";
+        case Ms::DiffType::EQUAL: break;
+        }
+
+        return "equal";
+    };
+
+    QJsonArray changesArray;
+    for (const Ms::ElementChange& change : diff.changes()) {
+        QJsonObject changeObj;
+        changeObj["type"] = diffTypeName(change.type);
+
+        const Ms::EngravingItem* item = change.el[0] ? change.el[0] : change.el[1];
+        changeObj["element"] = QString(item->typeName());
+        changeObj["tick"] = change.tick.ticks();
+        changeObj["track"] = change.track == mu::nidx ? -1 : static_cast<int>(change.track);
+
+        if (!change.properties.empty()) {
+            QJsonArray propertiesArray;
+            for (Ms::Pid pid : change.properties) {
+                propertiesArray.append(QString(Ms::propertyName(pid)));
+            }
+            changeObj["properties"] = propertiesArray;
+        }
+
+        changesArray.append(changeObj);
+    }
+
+    QJsonObject json;
+    json["equal"] = diff.equal();
+    json["changes"] = changesArray;
+
+    return json;
+}
+
 Ret BackendApi::exportScoreMedia(const io::path_t& in, const io::path_t& out, const io::path_t& highlightConfigPath,
                                  const io::path_t& stylePath,
                                  bool forceMode)
@@ -92,6 +143,34 @@ Ret BackendApi::exportScoreMedia(const io::path_t& in, const io::path_t& out, co
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
+Ret BackendApi::exportScoreDiff(const io::path_t& in1, const io::path_t& in2, const io::path_t& out, bool forceMode)
+{
+    TRACEFUNC
+
+    RetVal<INotationProjectPtr> prj1 = openProject(in1, NO_STYLE, forceMode);
+    if (!prj1.ret) {
+        return prj1.ret;
+    }
+
+    RetVal<INotationProjectPtr> prj2 = openProject(in2, NO_STYLE, forceMode);
+    if (!prj2.ret) {
+        return prj2.ret;
+    }
+
+    const Ms::Score* score1 = prj1.val->masterNotation()->notation()->elements()->msScore();
+    const Ms::Score* score2 = prj2.val->masterNotation()->notation()->elements()->msScore();
+
+    QFile outputFile;
+    openOutputFile(outputFile, out);
+
+    QJsonObject json = scoreDiffJson(score1, score2);
+    bool ok = outputFile.write(QJsonDocument(json).toJson(QJsonDocument::Compact)) != -1;
+
+    outputFile.close();
+
+    return ok ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+}
+
 Ret BackendApi::exportScoreMeta(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
 {
     TRACEFUNC
@@ -548,30 +627,43 @@ Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation,
     jsonForPdfs["scoreBin"] = QString::fromLatin1(scoreBin);
 
     INotationPtrList notations;
-
-    QJsonArray partsArray;
     QJsonArray partsNamesArray;
     for (IExcerptNotationPtr e : masterNotation->excerpts().val) {
         QJsonValue partNameVal(e->name());
         partsNamesArray.append(partNameVal);
 
-        QByteArray partBin = processWriter(PDF_WRITER_NAME, e->notation()).val;
-        QJsonValue partVal(QString::fromLatin1(partBin));
-        partsArray.append(partVal);
-
         notations.push_back(e->notation());
     }
 
-    jsonForPdfs["parts"] = partsNamesArray;
-    jsonForPdfs["partsBin"] = partsArray;
+    //! NOTE The parts are painted once, to their own documents and to the full one at the same time
+    std::vector<QByteArray> partsData(notations.size());
+    std::vector<std::unique_ptr<QBuffer> > partsBuffers;
+    QVariantList partsDevices;
 
-    jsonForPdfs["scoreFullPostfix"] = QString("-Score_and_parts") + ".pdf";
+    for (QByteArray& partData : partsData) {
+        partsBuffers.push_back(std::make_unique<QBuffer>(&partData));
+        partsBuffers.back()->open(QIODevice::ReadWrite);
+        partsDevices << QVariant::fromValue<QObject*>(partsBuffers.back().get());
+    }
 
     INotationWriter::Options options {
-        { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::MULTI_PART) }
+        { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::MULTI_PART) },
+        { INotationWriter::OptionKey::PARTS_DEVICES, Val(QVariant(partsDevices)) }
     };
 
-    QByteArray fullScoreData = processWriter(PDF_WRITER_NAME, notations, options).val;
+    QByteArray fullScoreData = notations.empty() ? QByteArray() : processWriter(PDF_WRITER_NAME, notations, options).val;
+
+    QJsonArray partsArray;
+    for (const QByteArray& partData : partsData) {
+        QJsonValue partVal(QString::fromLatin1(partData.toBase64()));
+        partsArray.append(partVal);
+    }
+
+    jsonForPdfs["parts"] = partsNamesArray;
+    jsonForPdfs["partsBin"] = partsArray;
+
+    jsonForPdfs["scoreFullPostfix"] = QString("-Score_and_parts") + ".pdf";
+
     jsonForPdfs["scoreFullBin"] = QString::fromLatin1(fullScoreData.toBase64());
 
     QJsonDocument jsonDoc(jsonForPdfs);
@@ -53,6 +53,8 @@ public:
     static Ret exportScoreTranspose(const io::path_t& in, const io::path_t& out, const std::string& optionsJson,
                                     const io::path_t& stylePath, bool forceMode = false);
 
+    static Ret exportScoreDiff(const io::path_t& in1, const io::path_t& in2, const io::path_t& out, bool forceMode = false);
+
     static Ret updateSource(const io::path_t& in, const std::string& newSource, bool forceMode = false);
 
 private:
@@ -52,6 +52,9 @@ mu::RetVal<std::string> NotationMeta::metaJson(notation::INotationPtr notation)
         return make_ret(Ret::Code::UnknownError);
     }
 
+    //! NOTE The page count depends on the layout, which is postponed for the parts which aren't open
+    score->doPostponedLayout();
+
     QJsonObject json;
 
     json["title"] =  title(score);
@@ -26,11 +26,15 @@
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
+#include <QThreadPool>
+#include <QtConcurrent>
 
 #include "convertercodes.h"
 #include "stringutils.h"
 #include "compat/backendapi.h"
 
+#include "libmscore/masterscore.h"
+
 #include "log.h"
 
 using namespace mu::converter;
@@ -39,6 +43,13 @@ using namespace mu::notation;
 
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
+static const std::string WAV_SUFFIX = "wav";
+static const std::string MP3_SUFFIX = "mp3";
+static const std::string OGG_SUFFIX = "ogg";
+static const std::string FLAC_SUFFIX = "flac";
+
+//! NOTE Each page being written keeps its image in memory
+static constexpr int MAX_PAGES_IN_FLIGHT = 4;
 
 mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode)
 {
@@ -84,7 +95,11 @@ mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t&
         return make_ret(Err::InFileFailedLoad);
     }
 
-    globalContext()->setCurrentProject(notationProject);
+    //! NOTE The audio writers export the playback of the current project.
+    //! Setting it starts the audio engine, so it is done only if needed
+    if (isConvertPlayback(suffix)) {
+        globalContext()->setCurrentProject(notationProject);
+    }
 
     if (isConvertPageByPage(suffix)) {
         ret = convertPageByPage(writer, notationProject->masterNotation()->notation(), out);
@@ -174,12 +189,25 @@ bool ConverterController::isConvertPageByPage(const std::string& suffix) const
     return types.contains(suffix);
 }
 
+bool ConverterController::isConvertPlayback(const std::string& suffix) const
+{
+    QList<std::string> types {
+        WAV_SUFFIX,
+        MP3_SUFFIX,
+        OGG_SUFFIX,
+        FLAC_SUFFIX
+    };
+
+    return types.contains(suffix);
+}
+
 mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotationPtr notation, const mu::io::path_t& out) const
 {
     TRACEFUNC;
 
-    for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
-        const QString filePath = io::path_t(io::dirpath(out) + "/" + io::basename(out) + "-%1." + io::suffix(out)).toQString().arg(i + 1);
+    auto writePage = [writer, notation, out](size_t pageIndex) -> Ret {
+        const QString filePath = io::path_t(io::dirpath(out) + "/" + io::basename(out) + "-%1." + io::suffix(out)).toQString().arg(
+            pageIndex + 1);
 
         QFile file(filePath);
         if (!file.open(QFile::WriteOnly)) {
@@ -187,7 +215,7 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
         }
 
         INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
+            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(pageIndex)) },
         };
 
         file.setProperty("path", out.toQString());
@@ -199,8 +227,47 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
         }
 
         file.close();
+
+        return make_ret(Ret::Code::Ok);
+    };
+
+    //! NOTE Lay out a postponed part before its pages are counted and written in parallel
+    notation->elements()->msScore()->doPostponedLayout();
+
+    const size_t pagesCount = notation->elements()->pages().size();
+
+#ifndef Q_OS_WASM
+    //! NOTE The writers paint the pages one by one (the painting uses the global state of the engraving),
+    //! but the rest (e.g. the PNG encoding and writing the files) runs in parallel.
+    //! A page is only painted when a thread of the pool takes it, so the memory is bounded by the threads count
+    QThreadPool pool;
+    pool.setMaxThreadCount(std::min(QThread::idealThreadCount(), MAX_PAGES_IN_FLIGHT));
+
+    std::vector<QFuture<Ret> > results;
+    results.reserve(pagesCount);
+
+    for (size_t i = 0; i < pagesCount; ++i) {
+        results.push_back(QtConcurrent::run(&pool, writePage, i));
     }
 
+    //! NOTE The errors are reported in the order of the pages
+    for (QFuture<Ret>& result : results) {
+        Ret ret = result.result();
+        if (!ret) {
+            pool.clear();
+            pool.waitForDone();
+            return ret;
+        }
+    }
+#else
+    for (size_t i = 0; i < pagesCount; ++i) {
+        Ret ret = writePage(i);
+        if (!ret) {
+            return ret;
+        }
+    }
+#endif
+
     return make_ret(Ret::Code::Ok);
 }
 
@@ -353,6 +420,13 @@ mu::Ret ConverterController::exportScoreVideo(const io::path_t& in, const io::pa
     return make_ret(Ret::Code::Ok);
 }
 
+mu::Ret ConverterController::exportScoreDiff(const io::path_t& in1, const io::path_t& in2, const io::path_t& out, bool forceMode)
+{
+    TRACEFUNC;
+
+    return BackendApi::exportScoreDiff(in1, in2, out, forceMode);
+}
+
 mu::Ret ConverterController::updateSource(const io::path_t& in, const std::string& newSource, bool forceMode)
 {
     TRACEFUNC;
@@ -65,6 +65,8 @@ public:
 
     Ret exportScoreVideo(const io::path_t& in, const io::path_t& out) override;
 
+    Ret exportScoreDiff(const io::path_t& in1, const io::path_t& in2, const io::path_t& out, bool forceMode = false) override;
+
     Ret updateSource(const io::path_t& in, const std::string& newSource, bool forceMode = false) override;
 
 private:
@@ -79,6 +81,7 @@ private:
     RetVal<BatchJob> parseBatchJob(const io::path_t& batchJobFile) const;
 
     bool isConvertPageByPage(const std::string& suffix) const;
+    bool isConvertPlayback(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
     Ret convertFullNotation(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
 
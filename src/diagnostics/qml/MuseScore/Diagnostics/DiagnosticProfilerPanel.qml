@@ -84,6 +84,18 @@ Rectangle {
                 text: "Print"
                 onClicked: profModel.print()
             }
+
+            FlatButton {
+                anchors.verticalCenter: parent.verticalCenter
+                text: profModel.isTraceEnabled ? "Stop trace" : "Start trace"
+                onClicked: profModel.toggleTrace()
+            }
+
+            FlatButton {
+                anchors.verticalCenter: parent.verticalCenter
+                text: "Save trace"
+                onClicked: profModel.saveTrace()
+            }
         }
     }
 
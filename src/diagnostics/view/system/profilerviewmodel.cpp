@@ -121,3 +121,32 @@ void ProfilerViewModel::print()
 {
     PROFILER_PRINT;
 }
+
+bool ProfilerViewModel::isTraceEnabled() const
+{
+    return Profiler::isTraceEnabled();
+}
+
+void ProfilerViewModel::toggleTrace()
+{
+    Profiler::setTraceEnabled(!Profiler::isTraceEnabled());
+    emit isTraceEnabledChanged();
+}
+
+void ProfilerViewModel::saveTrace()
+{
+    io::path_t path = interactive()->selectSavingFile("Save trace", "trace.json", "Chrome trace (*.json)");
+    if (path.empty()) {
+        return;
+    }
+
+    //! NOTE Stop the trace while saving to get consistent data
+    bool wasEnabled = Profiler::isTraceEnabled();
+    Profiler::setTraceEnabled(false);
+
+    if (!Profiler::instance()->saveTrace(path.toStdString())) {
+        LOGE() << "failed save trace to: " << path.toStdString();
+    }
+
+    Profiler::setTraceEnabled(wasEnabled);
+}
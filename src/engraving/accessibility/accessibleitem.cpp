@@ -101,6 +101,11 @@ void AccessibleItem::notifyAboutFocus(bool focused)
     m_accessibleStateChanged.send(IAccessible::State::Focused, focused);
 }
 
+void AccessibleItem::notifyAboutNameChanged()
+{
+    m_accessiblePropertyChanged.send(IAccessible::Property::Name, Val(accessibleName()));
+}
+
 const IAccessible* AccessibleItem::accessibleParent() const
 {
     Ms::EngravingObject* p = m_element->parent();
@@ -51,6 +51,7 @@ public:
     bool registered() const;
 
     void notifyAboutFocus(bool focused);
+    void notifyAboutNameChanged();
 
     // IAccessible
     const IAccessible* accessibleParent() const override;
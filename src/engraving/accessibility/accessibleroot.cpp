@@ -52,7 +52,9 @@ void AccessibleRoot::setFocusedElement(AccessibleItem* e)
     }
 
     m_focusedElement = e;
+    m_focusedElementName.clear();
     if (m_focusedElement) {
+        m_focusedElementName = m_focusedElement->accessibleName();
         m_focusedElement->notifyAboutFocus(true);
     }
 }
@@ -62,6 +64,21 @@ AccessibleItem* AccessibleRoot::focusedElement() const
     return m_focusedElement;
 }
 
+void AccessibleRoot::updateFocusedElementName()
+{
+    if (!m_focusedElement) {
+        return;
+    }
+
+    QString name = m_focusedElement->accessibleName();
+    if (name == m_focusedElementName) {
+        return;
+    }
+
+    m_focusedElementName = name;
+    m_focusedElement->notifyAboutNameChanged();
+}
+
 mu::RectF AccessibleRoot::toScreenRect(const RectF& rect, bool* ok) const
 {
     RectF result;
@@ -37,6 +37,9 @@ public:
     void setFocusedElement(AccessibleItem* e);
     AccessibleItem* focusedElement() const;
 
+    //! NOTE Announces the focused element again if it has been changed in place (e.g. pitch up/down)
+    void updateFocusedElementName();
+
     void setMapToScreenFunc(const AccessibleMapToScreenFunc& func);
     RectF toScreenRect(const RectF& rect, bool* ok = nullptr) const;
 
@@ -51,6 +54,7 @@ private:
     bool m_enabled = false;
 
     AccessibleItem* m_focusedElement = nullptr;
+    QString m_focusedElementName;
 
     AccessibleMapToScreenFunc m_accessibleMapToScreenFunc;
 };
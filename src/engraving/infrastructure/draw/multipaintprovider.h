@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_MULTIPAINTPROVIDER_H
+#define MU_DRAW_MULTIPAINTPROVIDER_H
+
+#include <vector>
+
+#include "ipaintprovider.h"
+
+namespace mu::draw {
+//! NOTE Forwards the painting to several providers, so the same content
+//! is painted to several devices (e.g. documents) in one pass.
+//! The state (pen, font, transform...) is returned from the first one, so the list must not be empty
+class MultiPaintProvider : public IPaintProvider
+{
+public:
+    MultiPaintProvider(const std::vector<IPaintProviderPtr>& providers);
+
+    const std::vector<IPaintProviderPtr>& providers() const;
+
+    bool isActive() const override;
+    void beginTarget(const std::string& name) override;
+    void beforeEndTargetHook(Painter* painter) override;
+    bool endTarget(bool endDraw = false) override;
+
+    void beginObject(const std::string& name, const PointF& pagePos) override;
+    void endObject() override;
+
+    void setAntialiasing(bool arg) override;
+    void setCompositionMode(CompositionMode mode) override;
+
+    void setFont(const Font& font) override;
+    const Font& font() const override;
+
+    void setPen(const Pen& pen) override;
+    void setNoPen() override;
+    const Pen& pen() const override;
+
+    void setBrush(const Brush& brush) override;
+    const Brush& brush() const override;
+
+    void save() override;
+    void restore() override;
+
+    void setTransform(const Transform& transform) override;
+    const Transform& transform() const override;
+
+    void drawPath(const PainterPath& path) override;
+    void drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode) override;
+
+    void drawText(const PointF& point, const QString& text) override;
+    void drawText(const RectF& rect, int flags, const QString& text) override;
+    void drawTextWorkaround(const Font& f, const PointF& pos, const QString& text) override;
+
+    void drawSymbol(const PointF& point, uint ucs4Code) override;
+
+    void drawPixmap(const PointF& point, const Pixmap& pm) override;
+    void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) override;
+
+#ifndef NO_QT_SUPPORT
+    void drawPixmap(const PointF& point, const QPixmap& pm) override;
+    void drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset = PointF()) override;
+#endif
+
+    void setClipRect(const RectF& rect) override;
+    void setClipping(bool enable) override;
+
+private:
+    std::vector<IPaintProviderPtr> m_providers;
+};
+}
+
+#endif // MU_DRAW_MULTIPAINTPROVIDER_H
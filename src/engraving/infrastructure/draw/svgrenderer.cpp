@@ -26,6 +26,7 @@
 #include <QSvgRenderer>
 
 #include "internal/qpainterprovider.h"
+#include "multipaintprovider.h"
 #endif
 
 #include "log.h"
@@ -65,9 +66,17 @@ void SvgRenderer::render(Painter* painter, const RectF& rect)
 {
 #ifndef NO_ENGRAVING_QSVGRENDER
     IPaintProviderPtr paintProvider = painter->provider();
-    std::shared_ptr<QPainterProvider> qPaintProvider = std::dynamic_pointer_cast<QPainterProvider>(paintProvider);
-    if (qPaintProvider) {
-        m_qSvgRenderer->render(qPaintProvider->qpainter(), rect.toQRectF());
+
+    std::vector<IPaintProviderPtr> paintProviders { paintProvider };
+    if (auto multiPaintProvider = std::dynamic_pointer_cast<MultiPaintProvider>(paintProvider)) {
+        paintProviders = multiPaintProvider->providers();
+    }
+
+    for (const IPaintProviderPtr& provider : paintProviders) {
+        std::shared_ptr<QPainterProvider> qPaintProvider = std::dynamic_pointer_cast<QPainterProvider>(provider);
+        if (qPaintProvider) {
+            m_qSvgRenderer->render(qPaintProvider->qpainter(), rect.toQRectF());
+        }
     }
 #else
     NOT_SUPPORTED;
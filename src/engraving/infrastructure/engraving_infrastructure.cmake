@@ -22,6 +22,8 @@ set (ENGRAVING_INFRASTRUCTURE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/draw/buffereddrawtypes.h
     ${CMAKE_CURRENT_LIST_DIR}/draw/bufferedpaintprovider.cpp
     ${CMAKE_CURRENT_LIST_DIR}/draw/bufferedpaintprovider.h
+    ${CMAKE_CURRENT_LIST_DIR}/draw/multipaintprovider.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/draw/multipaintprovider.h
     ${CMAKE_CURRENT_LIST_DIR}/draw/svgrenderer.cpp
     ${CMAKE_CURRENT_LIST_DIR}/draw/svgrenderer.h
     ${CMAKE_CURRENT_LIST_DIR}/draw/ifontprovider.h
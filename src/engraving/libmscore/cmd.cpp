@@ -398,7 +398,13 @@ void Score::update(bool resetCmdState)
         ms->deletePostponed();
         if (cs.layoutRange()) {
             for (Score* s : ms->scoreList()) {
-                s->doLayoutRange(cs.startTick(), cs.endTick());
+                //! NOTE Laying out every linked part after each command is slow for big projects,
+                //! the parts which aren't open are laid out when they are needed
+                if (s != this && !s->isMaster() && !s->isOpen()) {
+                    s->postponeLayoutRange(cs.startTick(), cs.endTick());
+                } else {
+                    s->doLayoutRange(cs.startTick(), cs.endTick());
+                }
             }
             updateAll = true;
         }
@@ -2700,26 +2700,31 @@ bool EngravingItem::selected() const
 void EngravingItem::setSelected(bool f)
 {
     setFlag(ElementFlag::SELECTED, f);
+}
 
-    if (f) {
-        initAccessibleIfNeed();
+void EngravingItem::setAccessibleFocus()
+{
+    TRACEFUNC;
 
-        if (m_accessible) {
-            AccessibleRoot* accRoot = score()->rootItem()->accessible()->accessibleRoot();
-            if (accRoot && accRoot->registered()) {
-                accRoot->setFocusedElement(nullptr);
-            }
+    initAccessibleIfNeed();
 
-            AccessibleRoot* dummyAccRoot = score()->dummy()->rootItem()->accessible()->accessibleRoot();
-            if (dummyAccRoot && dummyAccRoot->registered()) {
-                dummyAccRoot->setFocusedElement(nullptr);
-            }
+    if (!m_accessible) {
+        return;
+    }
 
-            AccessibleRoot* currAccRoot = m_accessible->accessibleRoot();
-            if (currAccRoot && currAccRoot->registered()) {
-                currAccRoot->setFocusedElement(m_accessible);
-            }
-        }
+    AccessibleRoot* accRoot = score()->rootItem()->accessible()->accessibleRoot();
+    if (accRoot && accRoot->registered()) {
+        accRoot->setFocusedElement(nullptr);
+    }
+
+    AccessibleRoot* dummyAccRoot = score()->dummy()->rootItem()->accessible()->accessibleRoot();
+    if (dummyAccRoot && dummyAccRoot->registered()) {
+        dummyAccRoot->setFocusedElement(nullptr);
+    }
+
+    AccessibleRoot* currAccRoot = m_accessible->accessibleRoot();
+    if (currAccRoot && currAccRoot->registered()) {
+        currAccRoot->setFocusedElement(m_accessible);
     }
 }
 
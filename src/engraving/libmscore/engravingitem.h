@@ -590,6 +590,7 @@ public:
     virtual EngravingItem* prevSegmentElement();    //< next-element and prev-element command
 
     mu::engraving::AccessibleItem* accessible() const;
+    void setAccessibleFocus();                        //< creates the accessible object on demand, moves the focus even if it is already there
     virtual QString accessibleInfo() const;           //< used to populate the status bar
     virtual QString screenReaderInfo() const          //< by default returns accessibleInfo, but can be overridden
     {
@@ -242,6 +242,38 @@ bool Excerpt::operator!=(const Excerpt& other) const
 }
 
 void Excerpt::createExcerpt(Excerpt* excerpt)
+{
+    createExcerpts({ excerpt });
+}
+
+void Excerpt::createExcerpts(const std::vector<Excerpt*>& excerpts)
+{
+    if (excerpts.empty()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    for (Excerpt* excerpt : excerpts) {
+        initExcerptScore(excerpt);
+    }
+
+    //! NOTE The midi mapping and the channels belong to the master score,
+    //! so they are updated once for all the created excerpts
+    MasterScore* masterScore = excerpts.front()->masterScore();
+    masterScore->rebuildMidiMapping();
+    masterScore->updateChannel();
+
+    // second layout of scores
+    for (Excerpt* excerpt : excerpts) {
+        Score* score = excerpt->excerptScore();
+        score->setPlaylistDirty();
+        score->setLayoutAll();
+        score->doLayout();
+    }
+}
+
+void Excerpt::initExcerptScore(Excerpt* excerpt)
 {
     MasterScore* masterScore = excerpt->masterScore();
     Score* score = excerpt->excerptScore();
@@ -384,14 +416,6 @@ void Excerpt::createExcerpt(Excerpt* excerpt)
         //score->spatiumChanged(oscore->spatium(), score->spatium());
         score->styleChanged();
     }
-
-    // second layout of score
-    score->setPlaylistDirty();
-    masterScore->rebuildMidiMapping();
-    masterScore->updateChannel();
-
-    score->setLayoutAll();
-    score->doLayout();
 }
 
 void MasterScore::deleteExcerpt(Excerpt* excerpt)
@@ -449,16 +473,24 @@ void MasterScore::deleteExcerpt(Excerpt* excerpt)
 
 void MasterScore::initAndAddExcerpt(Excerpt* excerpt, bool fakeUndo)
 {
-    Score* score = new Score(masterScore());
-    excerpt->setExcerptScore(score);
-    score->style().set(Sid::createMultiMeasureRests, true);
-    auto excerptCmd = new AddExcerpt(excerpt);
-    if (fakeUndo) {
-        excerptCmd->redo(nullptr);
-    } else {
-        score->undo(excerptCmd);
+    initAndAddExcerpts({ excerpt }, fakeUndo);
+}
+
+void MasterScore::initAndAddExcerpts(const std::vector<Excerpt*>& excerpts, bool fakeUndo)
+{
+    for (Excerpt* excerpt : excerpts) {
+        Score* score = new Score(masterScore());
+        excerpt->setExcerptScore(score);
+        score->style().set(Sid::createMultiMeasureRests, true);
+        auto excerptCmd = new AddExcerpt(excerpt);
+        if (fakeUndo) {
+            excerptCmd->redo(nullptr);
+        } else {
+            score->undo(excerptCmd);
+        }
     }
-    Excerpt::createExcerpt(excerpt);
+
+    Excerpt::createExcerpts(excerpts);
 }
 
 void MasterScore::initEmptyExcerpt(Excerpt* excerpt)
@@ -79,6 +79,7 @@ public:
     static Excerpt* createExcerptFromPart(Part* part);
 
     static void createExcerpt(Excerpt*);
+    static void createExcerpts(const std::vector<Excerpt*>& excerpts);
     static void cloneStaves(Score* sourceScore, Score* dstScore, const std::vector<staff_idx_t>& sourceStavesIndexes,
                             const TracksMap& allTracks);
     static void cloneMeasures(Score* oscore, Score* score);
@@ -86,6 +87,7 @@ public:
     static void cloneStaff2(Staff* ostaff, Staff* nstaff, const Fraction& startTick, const Fraction& endTick);
 
 private:
+    static void initExcerptScore(Excerpt* excerpt);
     static QString formatName(const QString& partName, const std::vector<Excerpt*>&);
 
     MasterScore* m_masterScore = nullptr;
@@ -22,6 +22,8 @@
 
 #include "instrtemplate.h"
 
+#include <QHash>
+
 #include "io/file.h"
 
 #include "translation.h"
@@ -50,6 +52,38 @@ std::vector<InstrumentGenre*> instrumentGenres;
 std::vector<InstrumentFamily*> instrumentFamilies;
 std::vector<ScoreOrder> instrumentOrders;
 
+//! NOTE Templates by id, so that searchTemplate isn't a linear search over all the templates.
+//! If there are several templates with the same id (e.g. copies made by <ref>), the first one is found
+static QHash<QString, InstrumentTemplate*> templatesById;
+
+//---------------------------------------------------------
+//   registerTemplate
+//---------------------------------------------------------
+
+static void registerTemplate(InstrumentTemplate* t)
+{
+    if (!templatesById.contains(t->id)) {
+        templatesById.insert(t->id, t);
+    }
+}
+
+//---------------------------------------------------------
+//   registerFirstTemplate
+//    register the first template with this id, as it was found by a linear search
+//---------------------------------------------------------
+
+static void registerFirstTemplate(const QString& id)
+{
+    for (const InstrumentGroup* g : instrumentGroups) {
+        for (InstrumentTemplate* t : g->instrumentTemplates) {
+            if (t->id == id) {
+                templatesById.insert(id, t);
+                return;
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------
 //   InstrumentIndex
 //---------------------------------------------------------
@@ -168,11 +202,13 @@ void InstrumentGroup::read(XmlReader& e)
                 instrumentTemplates.push_back(t);
             }
             t->read(e);
+            registerTemplate(t);
         } else if (tag == "ref") {
             InstrumentTemplate* ttt = searchTemplate(e.readElementText());
             if (ttt) {
                 InstrumentTemplate* t = new InstrumentTemplate(*ttt);
                 instrumentTemplates.push_back(t);
+                registerTemplate(t);
             } else {
                 LOGD("instrument reference not found <%s>", e.text().toUtf8().data());
             }
@@ -195,8 +231,20 @@ void InstrumentGroup::read(XmlReader& e)
 
 void InstrumentGroup::clear()
 {
+    QStringList unregisteredIds;
+    for (InstrumentTemplate* t : instrumentTemplates) {
+        if (templatesById.value(t->id) == t) {
+            templatesById.remove(t->id);
+            unregisteredIds << t->id;
+        }
+    }
     qDeleteAll(instrumentTemplates);
     instrumentTemplates.clear();
+
+    //! NOTE Templates of the other groups with the same ids were hidden by the removed ones
+    for (const QString& id : unregisteredIds) {
+        registerFirstTemplate(id);
+    }
 }
 
 //---------------------------------------------------------
@@ -660,6 +708,8 @@ void InstrumentTemplate::setPitchRange(const QString& s, char* a, char* b) const
 
 void clearInstrumentTemplates()
 {
+    //! NOTE All the groups are cleared, so there is nothing to register again
+    templatesById.clear();
     for (InstrumentGroup* g : instrumentGroups) {
         g->clear();
     }
@@ -740,14 +790,7 @@ bool loadInstrumentTemplates(const QString& instrTemplates)
 
 InstrumentTemplate* searchTemplate(const QString& name)
 {
-    for (InstrumentGroup* g : instrumentGroups) {
-        for (InstrumentTemplate* it : g->instrumentTemplates) {
-            if (it->id == name) {
-                return it;
-            }
-        }
-    }
-    return 0;
+    return templatesById.value(name, nullptr);
 }
 
 //---------------------------------------------------------
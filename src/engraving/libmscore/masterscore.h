@@ -212,6 +212,7 @@ public:
     void deleteExcerpt(Excerpt*);
 
     void initAndAddExcerpt(Excerpt*, bool);
+    void initAndAddExcerpts(const std::vector<Excerpt*>& excerpts, bool fakeUndo);
     void initEmptyExcerpt(Excerpt*);
 
     void setPlaybackScore(Score*);
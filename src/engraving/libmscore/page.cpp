@@ -84,6 +84,21 @@ std::vector<EngravingItem*> Page::items(const mu::PointF& point)
     return bspTree.items(point);
 }
 
+//---------------------------------------------------------
+//   bspTreeRevision
+//    changes every time the tree is rebuilt, that is after
+//    every layout of the page. Revisions are unique among
+//    all the pages, so they may be used as a cache key
+//---------------------------------------------------------
+
+int Page::bspTreeRevision()
+{
+    if (!bspTreeValid) {
+        doRebuildBspTree();
+    }
+    return _bspTreeRevision;
+}
+
 //---------------------------------------------------------
 //   appendSystem
 //---------------------------------------------------------
@@ -362,6 +377,9 @@ void Page::doRebuildBspTree()
     bspTree.initialize(r, n);
     scanElements(&bspTree, &bspInsert, false);
     bspTreeValid = true;
+
+    static int revisionCounter = 0;
+    _bspTreeRevision = ++revisionCounter;
 }
 
 //---------------------------------------------------------
@@ -54,6 +54,7 @@ class Page final : public EngravingItem
 
     BspTree bspTree;
     bool bspTreeValid;
+    int _bspTreeRevision = 0;
 
     void doRebuildBspTree();
 
@@ -96,6 +97,7 @@ public:
     std::vector<EngravingItem*> items(const mu::RectF& r);
     std::vector<EngravingItem*> items(const mu::PointF& p);
     void invalidateBspTree() { bspTreeValid = false; }
+    int bspTreeRevision();
     mu::PointF pagePos() const override { return mu::PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     mu::RectF tbbox();                             // tight bounding box, excluding white space
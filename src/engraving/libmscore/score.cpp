@@ -899,6 +899,10 @@ bool Score::isOpen() const
 void Score::setIsOpen(bool open)
 {
     _isOpen = open;
+
+    if (open) {
+        doPostponedLayout();
+    }
 }
 
 //---------------------------------------------------------
@@ -5394,8 +5398,19 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
     _scoreFont = ScoreFont::fontByName(style().value(Sid::MusicalSymbolFont).toString());
     _noteHeadWidth = _scoreFont->width(SymId::noteheadBlack, spatium() / SPATIUM20);
 
+    //! NOTE The postponed range is laid out too, or it is covered by the whole score layout
+    Fraction stick = st;
+    Fraction etick = et;
+    if (_layoutPostponed) {
+        _layoutPostponed = false;
+        stick = std::min(stick, _postponedLayoutStartTick);
+        if (etick >= Fraction(0, 1)) {
+            etick = _postponedLayoutEndTick < Fraction(0, 1) ? _postponedLayoutEndTick : std::max(etick, _postponedLayoutEndTick);
+        }
+    }
+
     m_layoutOptions.updateFromStyle(style());
-    m_layout.doLayoutRange(m_layoutOptions, st, et);
+    m_layout.doLayoutRange(m_layoutOptions, stick, etick);
     if (_resetAutoplace) {
         _resetAutoplace = false;
         resetAutoplace();
@@ -5406,6 +5421,49 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
     }
 }
 
+//---------------------------------------------------------
+//   postponeLayoutRange
+//---------------------------------------------------------
+
+void Score::postponeLayoutRange(const Fraction& st, const Fraction& et)
+{
+    //! NOTE The layout flags are reset after the command, so they are applied now
+    if (cmdState().layoutFlags & LayoutFlag::FIX_PITCH_VELO) {
+        updateVelo();
+    }
+
+    if (!_layoutPostponed) {
+        _layoutPostponed = true;
+        _postponedLayoutStartTick = st;
+        _postponedLayoutEndTick = et;
+        return;
+    }
+
+    _postponedLayoutStartTick = std::min(_postponedLayoutStartTick, st);
+
+    //! NOTE A negative end tick means the end of the score
+    if (_postponedLayoutEndTick < Fraction(0, 1) || et < Fraction(0, 1)) {
+        _postponedLayoutEndTick = Fraction(-1, 1);
+    } else {
+        _postponedLayoutEndTick = std::max(_postponedLayoutEndTick, et);
+    }
+}
+
+//---------------------------------------------------------
+//   doPostponedLayout
+//---------------------------------------------------------
+
+void Score::doPostponedLayout()
+{
+    if (!_layoutPostponed) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    doLayoutRange(_postponedLayoutStartTick, _postponedLayoutEndTick);
+}
+
 void Score::createPaddingTable()
 {
     for (int i=0; i < int(ElementType::MAXTYPE); ++i) {
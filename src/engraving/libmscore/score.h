@@ -452,6 +452,10 @@ private:
 
     bool _isOpen { true };
 
+    bool _layoutPostponed { false };
+    Fraction _postponedLayoutStartTick { -1, 1 };
+    Fraction _postponedLayoutEndTick { -1, 1 };
+
     std::map<QString, QString> _metaTags;
 
     Selection _selection;
@@ -880,6 +884,12 @@ public:
     bool isOpen() const;
     void setIsOpen(bool open);
 
+    //! NOTE The layout of a part which isn't open is postponed after the commands,
+    //! the accumulated range is laid out when the part is opened or accessed
+    bool isLayoutPostponed() const { return _layoutPostponed; }
+    void postponeLayoutRange(const Fraction& st, const Fraction& et);
+    void doPostponedLayout();
+
     void spell();
     void spell(staff_idx_t startStaff, staff_idx_t endStaff, Segment* startSegment, Segment* endSegment);
     void spell(Note*);
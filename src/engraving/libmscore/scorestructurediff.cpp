@@ -0,0 +1,261 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "scorestructurediff.h"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+#include "engravingitem.h"
+#include "measurebase.h"
+#include "property.h"
+#include "score.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+namespace Ms {
+//---------------------------------------------------------
+//   ItemKey
+//    Identifies an element among the children of its parent
+//---------------------------------------------------------
+
+struct ItemKey {
+    ElementType type = ElementType::INVALID;
+    int tick = 0;
+    track_idx_t track = mu::nidx;
+    size_t index = 0;   // number of the previous children with the same type, tick and track
+
+    bool operator<(const ItemKey& other) const
+    {
+        return std::tie(type, tick, track, index) < std::tie(other.type, other.tick, other.track, other.index);
+    }
+};
+
+using KeyedItems = std::vector<std::pair<ItemKey, EngravingItem*> >;
+
+//---------------------------------------------------------
+//   isComparedItem
+//    The elements created by the layout aren't a part of
+//    the score content
+//---------------------------------------------------------
+
+static bool isComparedItem(const EngravingItem* item)
+{
+    if (item->generated() || item->isSpannerSegment()) {
+        return false;
+    }
+
+    switch (item->type()) {
+    case ElementType::STAFF_LINES:
+    case ElementType::LEDGER_LINE:
+        return false;
+    default:
+        break;
+    }
+
+    return true;
+}
+
+static std::vector<EngravingItem*> childItems(const EngravingObject* object)
+{
+    std::vector<EngravingItem*> items;
+
+    for (EngravingObject* child : object->scanChildren()) {
+        if (child && child->isEngravingItem() && isComparedItem(toEngravingItem(child))) {
+            items.push_back(toEngravingItem(child));
+        }
+    }
+
+    return items;
+}
+
+static KeyedItems keyedItems(const std::vector<EngravingItem*>& items)
+{
+    KeyedItems result;
+    result.reserve(items.size());
+
+    std::map<std::tuple<ElementType, int, track_idx_t>, size_t> counts;
+
+    for (EngravingItem* item : items) {
+        ItemKey key;
+        key.type = item->type();
+        key.tick = item->tick().ticks();
+        key.track = item->track();
+        key.index = counts[std::make_tuple(key.type, key.tick, key.track)]++;
+
+        result.push_back({ key, item });
+    }
+
+    std::sort(result.begin(), result.end(), [](const auto& i1, const auto& i2) {
+        return i1.first < i2.first;
+    });
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   isIgnoredProperty
+//    These properties are used as the key of the element
+//    or describe its state in the editor
+//---------------------------------------------------------
+
+static bool isIgnoredProperty(Pid pid)
+{
+    switch (pid) {
+    case Pid::TICK:
+    case Pid::TRACK:
+    case Pid::VOICE:
+    case Pid::POSITION:
+    case Pid::SELECTED:
+    case Pid::GENERATED:
+        return true;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------
+//   ScoreStructureDiff
+//---------------------------------------------------------
+
+ScoreStructureDiff::ScoreStructureDiff(const Score* s1, const Score* s2)
+    : _s1(s1), _s2(s2)
+{
+}
+
+//---------------------------------------------------------
+//   update
+//---------------------------------------------------------
+
+void ScoreStructureDiff::update()
+{
+    TRACEFUNC;
+
+    _changes.clear();
+
+    IF_ASSERT_FAILED(_s1 && _s2) {
+        return;
+    }
+
+    std::vector<EngravingItem*> measures1;
+    for (MeasureBase* mb = _s1->first(); mb; mb = mb->next()) {
+        measures1.push_back(mb);
+    }
+
+    std::vector<EngravingItem*> measures2;
+    for (MeasureBase* mb = _s2->first(); mb; mb = mb->next()) {
+        measures2.push_back(mb);
+    }
+
+    diffItems(measures1, measures2);
+}
+
+//---------------------------------------------------------
+//   diffItems
+//    Both lists are sorted by key and merged, the matched
+//    elements are compared recursively
+//---------------------------------------------------------
+
+void ScoreStructureDiff::diffItems(const std::vector<EngravingItem*>& items1, const std::vector<EngravingItem*>& items2)
+{
+    const KeyedItems keyed1 = keyedItems(items1);
+    const KeyedItems keyed2 = keyedItems(items2);
+
+    auto it1 = keyed1.cbegin();
+    auto it2 = keyed2.cbegin();
+
+    while (it1 != keyed1.cend() || it2 != keyed2.cend()) {
+        if (it2 == keyed2.cend() || (it1 != keyed1.cend() && it1->first < it2->first)) {
+            addChange(DiffType::DELETE, it1->second, nullptr);
+            ++it1;
+        } else if (it1 == keyed1.cend() || it2->first < it1->first) {
+            addChange(DiffType::INSERT, nullptr, it2->second);
+            ++it2;
+        } else {
+            diffProperties(it1->second, it2->second);
+            diffItems(childItems(it1->second), childItems(it2->second));
+            ++it1;
+            ++it2;
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   diffProperties
+//    Elements return the properties they don't have from
+//    their parents, such differences are reported for the
+//    parent only
+//---------------------------------------------------------
+
+void ScoreStructureDiff::diffProperties(const EngravingItem* item1, const EngravingItem* item2)
+{
+    std::vector<Pid> properties;
+
+    const EngravingObject* parent1 = item1->explicitParent();
+    const EngravingObject* parent2 = item2->explicitParent();
+
+    for (int i = 0; i < static_cast<int>(Pid::END); ++i) {
+        Pid pid = static_cast<Pid>(i);
+        if (isIgnoredProperty(pid)) {
+            continue;
+        }
+
+        PropertyValue value1 = item1->getProperty(pid);
+        PropertyValue value2 = item2->getProperty(pid);
+        if (value1 == value2) {
+            continue;
+        }
+
+        if (parent1 && parent2 && value1 == parent1->getProperty(pid) && value2 == parent2->getProperty(pid)) {
+            continue;
+        }
+
+        properties.push_back(pid);
+    }
+
+    if (!properties.empty()) {
+        addChange(DiffType::REPLACE, item1, item2, std::move(properties));
+    }
+}
+
+void ScoreStructureDiff::addChange(DiffType type, const EngravingItem* item1, const EngravingItem* item2, std::vector<Pid> properties)
+{
+    const EngravingItem* item = item1 ? item1 : item2;
+
+    ElementChange change;
+    change.type = type;
+    change.elementType = item->type();
+    change.tick = item->tick();
+    change.track = item->track();
+    change.el[0] = item1;
+    change.el[1] = item2;
+    change.properties = std::move(properties);
+
+    _changes.push_back(std::move(change));
+}
+}
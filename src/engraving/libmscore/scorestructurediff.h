@@ -0,0 +1,81 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __SCORESTRUCTUREDIFF_H__
+#define __SCORESTRUCTUREDIFF_H__
+
+#include <vector>
+
+#include "scorediff.h"
+
+namespace Ms {
+class EngravingItem;
+
+//---------------------------------------------------------
+//   ElementChange
+//    INSERT: the element exists only in the second score
+//    DELETE: the element exists only in the first score
+//    REPLACE: the element exists in both scores, some of
+//             its properties differ
+//---------------------------------------------------------
+
+struct ElementChange {
+    DiffType type = DiffType::EQUAL;
+    ElementType elementType = ElementType::INVALID;
+    Fraction tick;
+    track_idx_t track = mu::nidx;
+    const EngravingItem* el[2] = { nullptr, nullptr };
+    std::vector<Pid> properties;   // changed properties
+};
+
+//---------------------------------------------------------
+//   ScoreStructureDiff
+//    Walks the measures of both scores and the elements
+//    under them in parallel. The elements are matched by
+//    type, tick, track and order, so the time is linear
+//    in the number of elements.
+//    ScoreStructureDiff does NOT take ownership of the scores.
+//---------------------------------------------------------
+
+class ScoreStructureDiff
+{
+    const Score* _s1;
+    const Score* _s2;
+    std::vector<ElementChange> _changes;
+
+    void diffItems(const std::vector<EngravingItem*>& items1, const std::vector<EngravingItem*>& items2);
+    void diffProperties(const EngravingItem* item1, const EngravingItem* item2);
+    void addChange(DiffType type, const EngravingItem* item1, const EngravingItem* item2, std::vector<Pid> properties = {});
+
+public:
+    ScoreStructureDiff(const Score* s1, const Score* s2);
+
+    void update();
+
+    const std::vector<ElementChange>& changes() const { return _changes; }
+    bool equal() const { return _changes.empty(); }
+
+    const Score* score1() const { return _s1; }
+    const Score* score2() const { return _s2; }
+};
+}     // namespace Ms
+#endif
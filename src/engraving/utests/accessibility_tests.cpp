@@ -0,0 +1,230 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "accessibility/iaccessibilitycontroller.h"
+#include "async/asyncable.h"
+
+#include "libmscore/masterscore.h"
+#include "libmscore/chord.h"
+#include "libmscore/measure.h"
+#include "libmscore/note.h"
+#include "libmscore/segment.h"
+
+#include "accessibility/accessibleitem.h"
+#include "accessibility/accessibleroot.h"
+
+#include "mocks/engravingconfigurationmock.h"
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::accessibility;
+using namespace Ms;
+
+static const QString ACCESSIBILITY_DATA_DIR("note_data/");
+
+namespace {
+//! NOTE Counts what would be sent to the platform accessibility
+class AccessibilityControllerStub : public IAccessibilityController, public async::Asyncable
+{
+public:
+    void reg(IAccessible* item) override
+    {
+        ++registeredCount;
+
+        item->accessibleStateChanged().onReceive(this, [this, item](IAccessible::State state, bool arg) {
+            if (state == IAccessible::State::Focused) {
+                if (arg) {
+                    focusedIn.push_back(item);
+                } else {
+                    ++focusedOutCount;
+                }
+            }
+        });
+
+        item->accessiblePropertyChanged().onReceive(this, [this, item](IAccessible::Property property, const Val&) {
+            if (property == IAccessible::Property::Name) {
+                nameChanged.push_back(item);
+            }
+        });
+    }
+
+    void unreg(IAccessible*) override {}
+
+    const IAccessible* accessibleRoot() const override { return nullptr; }
+    const IAccessible* lastFocused() const override { return nullptr; }
+
+    void clearEvents()
+    {
+        focusedIn.clear();
+        focusedOutCount = 0;
+        nameChanged.clear();
+    }
+
+    int registeredCount = 0;
+    std::vector<IAccessible*> focusedIn;
+    int focusedOutCount = 0;
+    std::vector<IAccessible*> nameChanged;
+};
+}
+
+class AccessibilityTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_oldConfiguration = EngravingItem::engravingConfiguration();
+
+        auto configuration = std::make_shared<testing::NiceMock<EngravingConfigurationMock> >();
+        ON_CALL(*configuration, isAccessibleEnabled()).WillByDefault(testing::Return(true));
+        ON_CALL(*configuration, defaultColor()).WillByDefault(testing::Return(mu::draw::Color::black));
+        EngravingItem::setengravingConfiguration(configuration);
+
+        m_controller = std::make_shared<AccessibilityControllerStub>();
+        AccessibleItem::setaccessibilityController(m_controller);
+
+        m_score = ScoreRW::readScore(ACCESSIBILITY_DATA_DIR + "altered-unison.mscx");
+        ASSERT_TRUE(m_score);
+
+        for (Segment* s = m_score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+            EngravingItem* e = s->element(0);
+            if (e && e->isChord()) {
+                for (Note* note : toChord(e)->notes()) {
+                    m_notes.push_back(note);
+                }
+            }
+        }
+        ASSERT_GE(m_notes.size(), 2);
+    }
+
+    void TearDown() override
+    {
+        delete m_score;
+        m_score = nullptr;
+
+        AccessibleItem::setaccessibilityController(nullptr);
+        EngravingItem::setengravingConfiguration(m_oldConfiguration);
+    }
+
+protected:
+    std::shared_ptr<IEngravingConfiguration> m_oldConfiguration;
+    std::shared_ptr<AccessibilityControllerStub> m_controller;
+    MasterScore* m_score = nullptr;
+    std::vector<Note*> m_notes;
+};
+
+TEST_F(AccessibilityTests, LazyCreationNearFocus)
+{
+    //! [GIVEN] All the notes are selected
+    int registeredCount = m_controller->registeredCount;
+    m_score->cmdSelectAll();
+
+    //! [THEN] The selection alone creates no accessible objects
+    for (const Note* note : m_notes) {
+        EXPECT_FALSE(note->accessible());
+    }
+    EXPECT_EQ(m_controller->registeredCount, registeredCount);
+
+    //! [WHEN] One note gets the accessibility focus
+    Note* focused = m_notes.front();
+    focused->setAccessibleFocus();
+
+    //! [THEN] Only the note and its parents get accessible objects
+    ASSERT_TRUE(focused->accessible());
+    EXPECT_TRUE(focused->chord()->accessible());
+    EXPECT_TRUE(focused->chord()->segment()->accessible());
+    EXPECT_TRUE(focused->chord()->measure()->accessible());
+
+    for (const Note* note : m_notes) {
+        if (note != focused && note->chord() != focused->chord()) {
+            EXPECT_FALSE(note->accessible());
+        }
+    }
+
+    EXPECT_GT(m_controller->registeredCount, registeredCount);
+}
+
+TEST_F(AccessibilityTests, FocusNotifications)
+{
+    //! [GIVEN] All the notes are selected
+    m_controller->clearEvents();
+    m_score->cmdSelectAll();
+
+    //! [THEN] No focus events are sent for the selected elements
+    EXPECT_TRUE(m_controller->focusedIn.empty());
+
+    //! [WHEN] The last selected note gets the focus, as after a selection change
+    Note* first = m_notes.front();
+    Note* last = m_notes.back();
+    last->setAccessibleFocus();
+
+    //! [THEN] One focus event is sent
+    ASSERT_EQ(m_controller->focusedIn.size(), 1);
+    EXPECT_EQ(m_controller->focusedIn.back(), last->accessible());
+
+    //! [WHEN] The focus moves to another note
+    m_controller->clearEvents();
+    first->setAccessibleFocus();
+
+    //! [THEN] The previous note loses it
+    ASSERT_EQ(m_controller->focusedIn.size(), 1);
+    EXPECT_EQ(m_controller->focusedIn.back(), first->accessible());
+    EXPECT_EQ(m_controller->focusedOutCount, 1);
+
+    //! [WHEN] The same note is selected again
+    m_controller->clearEvents();
+    first->setAccessibleFocus();
+
+    //! [THEN] It is focused again, so it is announced again
+    ASSERT_EQ(m_controller->focusedIn.size(), 1);
+    EXPECT_EQ(m_controller->focusedIn.back(), first->accessible());
+}
+
+TEST_F(AccessibilityTests, NameChangedOfFocusedElement)
+{
+    //! [GIVEN] A focused note
+    Note* note = m_notes.front();
+    note->setAccessibleFocus();
+    AccessibleRoot* root = note->accessible()->accessibleRoot();
+    ASSERT_TRUE(root);
+    ASSERT_EQ(root->focusedElement(), note->accessible());
+
+    //! [WHEN] Nothing has changed
+    m_controller->clearEvents();
+    root->updateFocusedElementName();
+
+    //! [THEN] Nothing is announced
+    EXPECT_TRUE(m_controller->nameChanged.empty());
+
+    //! [WHEN] The note is changed in place
+    note->setPitch(note->pitch() + 12);
+    root->updateFocusedElementName();
+
+    //! [THEN] Its new name is announced once, without moving the focus
+    ASSERT_EQ(m_controller->nameChanged.size(), 1);
+    EXPECT_EQ(m_controller->nameChanged.front(), note->accessible());
+    EXPECT_TRUE(m_controller->focusedIn.empty());
+
+    root->updateFocusedElementName();
+    EXPECT_EQ(m_controller->nameChanged.size(), 1);
+}
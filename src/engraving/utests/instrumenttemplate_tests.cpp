@@ -0,0 +1,113 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "libmscore/instrtemplate.h"
+#include "engraving/rw/xml.h"
+
+using namespace Ms;
+
+class InstrumentTemplateTests : public ::testing::Test
+{
+};
+
+TEST_F(InstrumentTemplateTests, SearchTemplate)
+{
+    //! [GIVEN] The templates loaded from instruments.xml by the test environment
+    ASSERT_FALSE(instrumentGroups.empty());
+
+    for (const InstrumentGroup* group : instrumentGroups) {
+        for (InstrumentTemplate* t : group->instrumentTemplates) {
+            //! [WHEN] Search the template by its id
+            InstrumentTemplate* found = searchTemplate(t->id);
+
+            //! [THEN] The first template with this id is found, like by a linear search
+            InstrumentTemplate* expected = nullptr;
+            for (const InstrumentGroup* g : instrumentGroups) {
+                for (InstrumentTemplate* it : g->instrumentTemplates) {
+                    if (it->id == t->id) {
+                        expected = it;
+                        break;
+                    }
+                }
+
+                if (expected) {
+                    break;
+                }
+            }
+
+            EXPECT_EQ(found, expected) << t->id.toStdString();
+        }
+    }
+
+    //! [THEN] Unknown ids aren't found
+    EXPECT_EQ(searchTemplate("not-existing-instrument"), nullptr);
+}
+
+TEST_F(InstrumentTemplateTests, SearchTemplateAfterClearingGroup)
+{
+    //! [GIVEN] A template and its copy (made by <ref>) in another group
+    const QString id = "test-shadowed-instrument";
+
+    InstrumentGroup* first = new InstrumentGroup();
+    InstrumentGroup* second = new InstrumentGroup();
+    instrumentGroups.push_back(first);
+    instrumentGroups.push_back(second);
+
+    XmlReader firstXml(QByteArray("<InstrumentGroup id=\"test-first\">"
+                                  "<Instrument id=\"test-shadowed-instrument\"><trackName>Test</trackName></Instrument>"
+                                  "</InstrumentGroup>"));
+    firstXml.readNextStartElement();
+    first->read(firstXml);
+
+    XmlReader secondXml(QByteArray("<InstrumentGroup id=\"test-second\">"
+                                   "<ref>test-shadowed-instrument</ref>"
+                                   "</InstrumentGroup>"));
+    secondXml.readNextStartElement();
+    second->read(secondXml);
+
+    ASSERT_EQ(first->instrumentTemplates.size(), 1);
+    ASSERT_EQ(second->instrumentTemplates.size(), 1);
+    EXPECT_EQ(searchTemplate(id), first->instrumentTemplates.front());
+
+    //! [WHEN] Clear the group of the template found so far
+    first->clear();
+
+    //! [THEN] The copy in the other group is found
+    EXPECT_EQ(searchTemplate(id), second->instrumentTemplates.front());
+
+    //! [WHEN] Clear the other group too
+    second->clear();
+
+    //! [THEN] The template isn't found anymore
+    EXPECT_EQ(searchTemplate(id), nullptr);
+
+    instrumentGroups.erase(std::remove_if(instrumentGroups.begin(), instrumentGroups.end(), [first, second](const InstrumentGroup* g) {
+        return g == first || g == second;
+    }), instrumentGroups.end());
+
+    delete first;
+    delete second;
+}
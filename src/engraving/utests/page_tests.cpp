@@ -0,0 +1,156 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <QElapsedTimer>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/page.h"
+#include "libmscore/segment.h"
+#include "libmscore/chord.h"
+#include "libmscore/note.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace Ms;
+
+class PageTests : public ::testing::Test
+{
+};
+
+static Note* firstNote(Score* score)
+{
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        EngravingItem* e = s->element(0);
+        if (e && e->isChord()) {
+            return toChord(e)->notes().front();
+        }
+    }
+    return nullptr;
+}
+
+static bool contains(const std::vector<EngravingItem*>& items, const EngravingItem* item)
+{
+    return std::find(items.cbegin(), items.cend(), item) != items.cend();
+}
+
+TEST_F(PageTests, BspTreeRevisionChangesAfterLayout)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+
+    //! [GIVEN] A laid out page
+    Page* page = score->pages().front();
+    int revision = page->bspTreeRevision();
+
+    //! [WHEN] The page is queried again without a layout
+    page->items(page->bbox());
+
+    //! [THEN] The revision doesn't change
+    EXPECT_EQ(page->bspTreeRevision(), revision);
+
+    //! [WHEN] The score is laid out again
+    score->doLayout();
+
+    //! [THEN] The revision changes
+    page = score->pages().front();
+    EXPECT_NE(page->bspTreeRevision(), revision);
+
+    delete score;
+}
+
+TEST_F(PageTests, CachedHitIsNotReusedAfterEdit)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+
+    //! [GIVEN] A hit on a note, cached with the page and its revision as key
+    Note* note = firstNote(score);
+    ASSERT_TRUE(note);
+
+    Page* page = score->pages().front();
+    PointF pos = note->pageBoundingRect().center();
+    int cachedRevision = page->bspTreeRevision();
+    std::vector<EngravingItem*> cachedHit = page->items(pos);
+    ASSERT_TRUE(contains(cachedHit, note));
+
+    //! [WHEN] The note is deleted
+    score->select(note);
+    score->startCmd();
+    score->cmdDeleteSelection();
+    score->endCmd();
+
+    //! [THEN] The key doesn't match anymore, so the cached hit is dropped
+    page = score->pages().front();
+    EXPECT_NE(page->bspTreeRevision(), cachedRevision);
+
+    //! [THEN] A new hit-test doesn't find the deleted note
+    EXPECT_FALSE(contains(page->items(pos), note));
+
+    delete score;
+}
+
+TEST_F(PageTests, HitTestTiming)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+
+    Note* note = firstNote(score);
+    ASSERT_TRUE(note);
+
+    Page* page = score->pages().front();
+    const PointF pos = note->pageBoundingRect().center();
+    constexpr int queries = 1000;
+
+    //! [GIVEN] The tree is rebuilt before every query, as without a revision to key the results on
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < queries; ++i) {
+        page->invalidateBspTree();
+        page->items(pos);
+    }
+    const qint64 rebuildingNs = timer.nsecsElapsed();
+
+    //! [WHEN] The tree is only rebuilt after a layout
+    const int revision = page->bspTreeRevision();
+    timer.restart();
+    for (int i = 0; i < queries; ++i) {
+        page->items(pos);
+    }
+    const qint64 reusingNs = timer.nsecsElapsed();
+
+    LOGI() << queries << " hit-tests: " << rebuildingNs / 1000 << " us rebuilding the tree, "
+           << reusingNs / 1000 << " us reusing it";
+
+    //! [THEN] The queries reuse the tree
+    EXPECT_EQ(page->bspTreeRevision(), revision);
+
+    delete score;
+}
@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/excerpt.h"
+#include "libmscore/chord.h"
+#include "libmscore/measure.h"
+#include "libmscore/note.h"
+#include "libmscore/part.h"
+
+#include "utils/scorerw.h"
+
+static const QString PARTS_DATA_DIR("parts_data/");
+
+using namespace mu::engraving;
+using namespace Ms;
+
+class PartsTests : public ::testing::Test
+{
+};
+
+TEST_F(PartsTests, PostponeLayoutOfClosedPart)
+{
+    //! [GIVEN] A score with a part, which isn't open
+    MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + "postpone-layout.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->excerpts().empty());
+
+    Score* part = score->excerpts().front()->excerptScore();
+    ASSERT_TRUE(part);
+
+    part->setIsOpen(false);
+
+    Chord* chord = score->firstMeasure()->findChord(Fraction(0, 1), 0);
+    ASSERT_TRUE(chord);
+    Note* note = chord->upNote();
+
+    Chord* partChord = part->firstMeasure()->findChord(Fraction(0, 1), 0);
+    ASSERT_TRUE(partChord);
+    Note* partNote = partChord->upNote();
+    ASSERT_EQ(partNote->pitch(), note->pitch());
+
+    double partNoteY = partNote->y();
+
+    //! [WHEN] Move the note an octave up in the master score
+    score->startCmd();
+    score->select(note);
+    score->upDown(true, UpDownMode::OCTAVE);
+    score->endCmd();
+
+    //! [THEN] The master score is laid out, the layout of the part is postponed
+    EXPECT_FALSE(score->isLayoutPostponed());
+    EXPECT_TRUE(part->isLayoutPostponed());
+    EXPECT_EQ(partNote->pitch(), note->pitch());
+    EXPECT_NE(note->y(), partNoteY);
+    EXPECT_DOUBLE_EQ(partNote->y(), partNoteY);
+
+    //! [WHEN] Open the part
+    part->setIsOpen(true);
+
+    //! [THEN] The edited note is laid out in the part
+    EXPECT_FALSE(part->isLayoutPostponed());
+    EXPECT_FALSE(part->pages().empty());
+    EXPECT_DOUBLE_EQ(partNote->y(), note->y());
+
+    //! [WHEN] Move the note back down
+    score->startCmd();
+    score->select(note);
+    score->upDown(false, UpDownMode::OCTAVE);
+    score->endCmd();
+
+    //! [THEN] The open part is laid out immediately
+    EXPECT_FALSE(part->isLayoutPostponed());
+    EXPECT_DOUBLE_EQ(partNote->y(), partNoteY);
+
+    delete score;
+}
+
+TEST_F(PartsTests, CreateExcerptsFromParts)
+{
+    //! [GIVEN] A score
+    MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + "postpone-layout.mscx");
+    ASSERT_TRUE(score);
+
+    size_t excerptsCount = score->excerpts().size();
+
+    //! [WHEN] Create the excerpts of all the parts at once
+    std::vector<Excerpt*> excerpts = Excerpt::createExcerptsFromParts(score->parts());
+    score->initAndAddExcerpts(excerpts, true);
+
+    //! [THEN] All the excerpts are added and laid out
+    EXPECT_EQ(score->excerpts().size(), excerptsCount + excerpts.size());
+
+    for (const Excerpt* excerpt : excerpts) {
+        Score* part = excerpt->excerptScore();
+        ASSERT_TRUE(part);
+        EXPECT_EQ(part->parts().size(), 1u);
+        EXPECT_FALSE(part->pages().empty());
+
+        //! [THEN] Their midi mapping is the one of the master score
+        const Part* masterPart = part->parts().front()->masterPart();
+        EXPECT_EQ(part->parts().front()->instrument()->channel(0)->channel(), masterPart->instrument()->channel(0)->channel());
+    }
+
+    delete score;
+}
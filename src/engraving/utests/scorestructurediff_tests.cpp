@@ -0,0 +1,131 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/chord.h"
+#include "libmscore/note.h"
+#include "libmscore/segment.h"
+#include "libmscore/scorestructurediff.h"
+
+#include "utils/scorerw.h"
+
+static const QString SCOREDIFF_DATA_DIR("scorediff_data/");
+
+using namespace mu::engraving;
+using namespace Ms;
+
+class ScoreStructureDiffTests : public ::testing::Test
+{
+};
+
+TEST_F(ScoreStructureDiffTests, SameScores)
+{
+    //! [GIVEN] The same score read twice
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "scorediff01.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "scorediff01.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! [WHEN] Compare them
+    ScoreStructureDiff diff(score1, score2);
+    diff.update();
+
+    //! [THEN] There are no changes
+    EXPECT_TRUE(diff.equal());
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreStructureDiffTests, ChangedPitch)
+{
+    //! [GIVEN] The same score read twice
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "scorediff01.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "scorediff01.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! [GIVEN] The pitch of the first note is changed in the second score
+    ChordRest* cr = score2->firstSegment(SegmentType::ChordRest)->cr(0);
+    ASSERT_TRUE(cr && cr->isChord());
+
+    Note* note = toChord(cr)->upNote();
+    note->setPitch(note->pitch() + 1);
+
+    //! [WHEN] Compare the scores
+    ScoreStructureDiff diff(score1, score2);
+    diff.update();
+
+    //! [THEN] Only the note is changed
+    ASSERT_EQ(diff.changes().size(), 1u);
+
+    const ElementChange& change = diff.changes().front();
+    EXPECT_EQ(change.type, DiffType::REPLACE);
+    EXPECT_EQ(change.elementType, ElementType::NOTE);
+    EXPECT_EQ(change.el[1], note);
+    EXPECT_NE(std::find(change.properties.cbegin(), change.properties.cend(), Pid::PITCH), change.properties.cend());
+
+    delete score1;
+    delete score2;
+}
+
+TEST_F(ScoreStructureDiffTests, AddedNote)
+{
+    //! [GIVEN] The same score read twice
+    MasterScore* score1 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "scorediff01.mscx");
+    MasterScore* score2 = ScoreRW::readScore(SCOREDIFF_DATA_DIR + "scorediff01.mscx");
+    ASSERT_TRUE(score1);
+    ASSERT_TRUE(score2);
+
+    //! [GIVEN] A note is added to the first chord of the second score
+    ChordRest* cr = score2->firstSegment(SegmentType::ChordRest)->cr(0);
+    ASSERT_TRUE(cr && cr->isChord());
+
+    NoteVal noteVal(toChord(cr)->upNote()->pitch() + 4);
+
+    score2->startCmd();
+    Note* note = score2->addNote(toChord(cr), noteVal);
+    score2->endCmd();
+    ASSERT_TRUE(note);
+
+    //! [WHEN] Compare the scores in both directions
+    ScoreStructureDiff diff(score1, score2);
+    diff.update();
+
+    ScoreStructureDiff reverseDiff(score2, score1);
+    reverseDiff.update();
+
+    //! [THEN] The note is inserted into the second score and deleted from the first one
+    auto findNoteChange = [](const ScoreStructureDiff& d, DiffType type) {
+        return std::find_if(d.changes().cbegin(), d.changes().cend(), [type](const ElementChange& c) {
+            return c.type == type && c.elementType == ElementType::NOTE;
+        }) != d.changes().cend();
+    };
+
+    EXPECT_TRUE(findNoteChange(diff, DiffType::INSERT));
+    EXPECT_TRUE(findNoteChange(reverseDiff, DiffType::DELETE));
+
+    delete score1;
+    delete score2;
+}
@@ -105,6 +105,7 @@ void AccessibilityController::reg(IAccessible* item)
     it.iface = QAccessible::queryAccessibleInterface(it.object);
 
     m_allItems.insert(item, it);
+    TRACE_COUNTER("AccessibilityController::items", m_allItems.size());
 
     if (item->accessibleParent() == this) {
         m_children.append(item);
@@ -131,6 +132,8 @@ void AccessibilityController::unreg(IAccessible* aitem)
         return;
     }
 
+    TRACE_COUNTER("AccessibilityController::items", m_allItems.size());
+
     if (m_lastFocused == item.item) {
         m_lastFocused = nullptr;
     }
@@ -126,11 +126,127 @@ void AbstractSynthesizer::setIsActive(bool arg)
     m_isActive = arg;
 }
 
-audio::msecs_t AbstractSynthesizer::samplesToMsecs(const samples_t samplesPerChannel, const samples_t sampleRate) const
+audio::msecs_t AbstractSynthesizer::framesToMsecs(const samples_t frames) const
 {
-    ONLY_AUDIO_WORKER_THREAD;
+    if (m_sampleRate == 0) {
+        return 0;
+    }
+
+    return static_cast<msecs_t>(frames * 1000 / m_sampleRate);
+}
+
+samples_t AbstractSynthesizer::msecsToFrames(const msecs_t msecs) const
+{
+    if (msecs <= 0) {
+        return 0;
+    }
+
+    //! NOTE Rounded up, so that framesToMsecs(msecsToFrames(msecs)) == msecs
+    return (static_cast<samples_t>(msecs) * m_sampleRate + 999) / 1000;
+}
+
+void AbstractSynthesizer::advancePlaybackPosition(const samples_t frames)
+{
+    m_playbackPositionFrames += frames;
+    m_playbackPosition = framesToMsecs(m_playbackPositionFrames);
+}
+
+samples_t AbstractSynthesizer::nextEventsFrameOffset(const msecs_t from, const samples_t blockSize) const
+{
+    samples_t result = blockSize;
+
+    auto considerTimestamp = [this, from, &result](const msecs_t timestamp) {
+        if (timestamp <= from) {
+            return;
+        }
+
+        samples_t frame = msecsToFrames(timestamp);
+        if (frame > m_playbackPositionFrames) {
+            result = std::min(result, frame - m_playbackPositionFrames);
+        }
+    };
+
+    auto considerEventEnd = [&considerTimestamp](const mpe::PlaybackEvent& event) {
+        if (!std::holds_alternative<mpe::NoteEvent>(event)) {
+            return;
+        }
+
+        const mpe::ArrangementContext& ctx = std::get<mpe::NoteEvent>(event).arrangementCtx();
+        considerTimestamp(ctx.actualTimestamp + ctx.actualDuration);
+    };
+
+    const mpe::PlaybackEventsMap& events = m_mainStreamEvents.events();
+    auto nextStart = events.lower_bound(from);
+
+    //! NOTE The events starting at "from" are turned on in this block, so their ends have to be considered as well
+    if (nextStart != events.cend() && nextStart->first == from) {
+        for (const mpe::PlaybackEvent& event : nextStart->second) {
+            considerEventEnd(event);
+        }
+
+        ++nextStart;
+    }
+
+    if (nextStart != events.cend()) {
+        considerTimestamp(nextStart->first);
+    }
 
-    return samplesPerChannel * 1000 / sampleRate;
+    for (const mpe::PlaybackEvent& event : m_playingEvents) {
+        considerEventEnd(event);
+    }
+
+    return result;
+}
+
+samples_t AbstractSynthesizer::handleMainStreamEvents(const samples_t maxFramesCount)
+{
+    msecs_t from = m_playbackPosition;
+
+    if (m_playbackPositionFrames == 0) {
+        from = actualPlaybackPositionStart();
+    }
+
+    samples_t framesCount = nextEventsFrameOffset(from, maxFramesCount);
+    msecs_t to = framesToMsecs(m_playbackPositionFrames + framesCount);
+
+    //! NOTE Notes are turned off before the new ones are turned on, a repeated note must not be cut
+    handleAlreadyPlayingEvents(from, to);
+
+    EventsMapIteratorList range = m_mainStreamEvents.findEventsRange(from, to);
+
+    for (const auto& it : range) {
+        for (const PlaybackEvent& event : it->second) {
+            if (handleNoteOnEvents(event, from, to)) {
+                m_playingEvents.emplace_back(event);
+            }
+        }
+    }
+
+    advancePlaybackPosition(framesCount);
+
+    return framesCount;
+}
+
+void AbstractSynthesizer::handleAlreadyPlayingEvents(const msecs_t from, const msecs_t to)
+{
+    auto it = m_playingEvents.cbegin();
+    while (it != m_playingEvents.cend()) {
+        if (handleNoteOffEvents(*it, from, to)) {
+            it = m_playingEvents.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+bool AbstractSynthesizer::handleNoteOnEvents(const mpe::PlaybackEvent&, const msecs_t, const msecs_t)
+{
+    return false;
+}
+
+bool AbstractSynthesizer::handleNoteOffEvents(const mpe::PlaybackEvent&, const msecs_t, const msecs_t)
+{
+    return false;
 }
 
 msecs_t AbstractSynthesizer::actualPlaybackPositionStart() const
@@ -151,5 +267,6 @@ void AbstractSynthesizer::setPlaybackPosition(const msecs_t newPosition)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    m_playbackPositionFrames = msecsToFrames(newPosition);
     m_playbackPosition = newPosition;
 }
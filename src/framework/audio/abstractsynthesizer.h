@@ -23,6 +23,8 @@
 #ifndef MU_AUDIO_ISYNTHESIZER_H
 #define MU_AUDIO_ISYNTHESIZER_H
 
+#include <list>
+
 #include "async/channel.h"
 #include "async/asyncable.h"
 #include "mpe/events.h"
@@ -157,15 +159,37 @@ protected:
     virtual void loadOffStreamEvents(const mpe::PlaybackEventsMap& updatedEvents);
     virtual void loadDynamicLevelChanges(const mpe::DynamicLevelMap& updatedDynamicLevelMap);
 
-    msecs_t samplesToMsecs(const samples_t samplesPerChannel, const samples_t sampleRate) const;
+    msecs_t framesToMsecs(const samples_t frames) const;
+    samples_t msecsToFrames(const msecs_t msecs) const;
     msecs_t actualPlaybackPositionStart() const;
 
+    void advancePlaybackPosition(const samples_t frames);
+
+    //! NOTE Returns the offset (from the playback position) of the first frame after "from" at which
+    //! a main stream event starts or one of the playing events ends, or blockSize if there is no such frame.
+    //! Used to split a block, so that every event is handled exactly at its frame
+    samples_t nextEventsFrameOffset(const msecs_t from, const samples_t blockSize) const;
+
+    //! NOTE Handles the main stream events up to the next event frame (but not more than maxFramesCount frames),
+    //! advances the playback position and returns the number of frames to render
+    samples_t handleMainStreamEvents(const samples_t maxFramesCount);
+    void handleAlreadyPlayingEvents(const msecs_t from, const msecs_t to);
+
+    //! NOTE Return true if the event has been turned on/off within [from, to)
+    virtual bool handleNoteOnEvents(const mpe::PlaybackEvent& event, const msecs_t from, const msecs_t to);
+    virtual bool handleNoteOffEvents(const mpe::PlaybackEvent& event, const msecs_t from, const msecs_t to);
+
+    //! NOTE The playback position is counted in sample frames, so that it doesn't drift
+    //! when the block duration isn't a whole number of milliseconds.
+    //! m_playbackPosition is always derived from it
+    samples_t m_playbackPositionFrames = 0;
     msecs_t m_playbackPosition = 0;
 
     mpe::PlaybackSetupData m_setupData;
     mpe::DynamicLevelMap m_dynamicLevelMap;
     EventsBuffer m_mainStreamEvents;
     EventsBuffer m_offStreamEvents;
+    std::list<mpe::PlaybackEvent> m_playingEvents;
 
     mpe::PlaybackEventsChanges m_mainStreamChanges;
     mpe::PlaybackEventsChanges m_offStreamChanges;
@@ -85,11 +85,50 @@ static std::shared_ptr<IAudioDriver> s_audioDriver = std::shared_ptr<IAudioDrive
 static std::shared_ptr<IAudioDriver> s_audioDriver = std::shared_ptr<IAudioDriver>(new WebAudioDriver());
 #endif
 
+static IAudioDriver::Spec s_activeSpec;
+static bool s_audioInited = false;
+static bool s_playbackResolved = false;
+static framework::IApplication::RunMode s_runMode = framework::IApplication::RunMode::Editor;
+
 static void audio_init_qrc()
 {
     Q_INIT_RESOURCE(audio);
 }
 
+static void startAudioWorker()
+{
+    if (s_audioWorker->isRunning()) {
+        return;
+    }
+
+    // Setup worker
+    auto workerSetup = [activeSpec = s_activeSpec]() {
+        AudioSanitizer::setupWorkerThread();
+        ONLY_AUDIO_WORKER_THREAD;
+
+        // Setup audio engine
+        AudioEngine::instance()->init(s_audioBuffer);
+        AudioEngine::instance()->setAudioChannelsCount(s_audioConfiguration->audioChannelsCount());
+        AudioEngine::instance()->setSampleRate(activeSpec.sampleRate);
+        AudioEngine::instance()->setReadBufferSize(activeSpec.samples);
+
+        auto fluidResolver = std::make_shared<FluidResolver>(s_audioConfiguration->soundFontDirectories(),
+                                                             s_audioConfiguration->soundFontDirectoriesChanged());
+        s_synthResolver->registerResolver(AudioSourceType::Fluid, fluidResolver);
+        s_synthResolver->init(s_audioConfiguration->defaultAudioInputParams());
+
+        // Initialize IPlayback facade and make sure that it's initialized after the audio-engine
+        s_playbackFacade->init();
+    };
+
+    auto workerLoopBody = []() {
+        ONLY_AUDIO_WORKER_THREAD;
+        s_audioBuffer->forward();
+    };
+
+    s_audioWorker->run(workerSetup, workerLoopBody);
+}
+
 AudioModule::AudioModule()
 {
     AudioSanitizer::setupMainThread();
@@ -105,7 +144,17 @@ void AudioModule::registerExports()
     ioc()->registerExport<IAudioConfiguration>(moduleName(), s_audioConfiguration);
     ioc()->registerExport<IAudioThreadSecurer>(moduleName(), std::make_shared<AudioThreadSecurer>());
     ioc()->registerExport<IAudioDriver>(moduleName(), s_audioDriver);
-    ioc()->registerExport<IPlayback>(moduleName(), s_playbackFacade);
+
+    //! NOTE In the converter mode the audio engine is started only if the playback is used (e.g. by the audio export).
+    //! In the editor mode it is always started by onInit
+    ioc()->registerLazyExport<IPlayback>(moduleName(), []() -> std::shared_ptr<IPlayback> {
+        s_playbackResolved = true;
+        if (s_audioInited && s_runMode != framework::IApplication::RunMode::Editor) {
+            ONLY_AUDIO_MAIN_THREAD;
+            startAudioWorker();
+        }
+        return s_playbackFacade;
+    });
 
     ioc()->registerExport<ISynthResolver>(moduleName(), s_synthResolver);
     ioc()->registerExport<IFxResolver>(moduleName(), s_fxResolver);
@@ -156,6 +205,8 @@ void AudioModule::onInit(const framework::IApplication::RunMode& mode)
 
     **/
 
+    s_runMode = mode;
+
     // Init configuration
     s_audioConfiguration->init();
 
@@ -172,44 +223,21 @@ void AudioModule::onInit(const framework::IApplication::RunMode& mode)
         s_audioBuffer->pop(reinterpret_cast<float*>(stream), samplesPerChannel);
     };
 
-    IAudioDriver::Spec activeSpec;
-
     if (mode == framework::IApplication::RunMode::Editor) {
-        bool driverOpened = s_audioDriver->open(requiredSpec, &activeSpec);
+        bool driverOpened = s_audioDriver->open(requiredSpec, &s_activeSpec);
         if (!driverOpened) {
             LOGE() << "audio output open failed";
             return;
         }
     } else {
-        activeSpec = requiredSpec;
+        s_activeSpec = requiredSpec;
     }
 
-    // Setup worker
-    auto workerSetup = [activeSpec]() {
-        AudioSanitizer::setupWorkerThread();
-        ONLY_AUDIO_WORKER_THREAD;
-
-        // Setup audio engine
-        AudioEngine::instance()->init(s_audioBuffer);
-        AudioEngine::instance()->setAudioChannelsCount(s_audioConfiguration->audioChannelsCount());
-        AudioEngine::instance()->setSampleRate(activeSpec.sampleRate);
-        AudioEngine::instance()->setReadBufferSize(activeSpec.samples);
-
-        auto fluidResolver = std::make_shared<FluidResolver>(s_audioConfiguration->soundFontDirectories(),
-                                                             s_audioConfiguration->soundFontDirectoriesChanged());
-        s_synthResolver->registerResolver(AudioSourceType::Fluid, fluidResolver);
-        s_synthResolver->init(s_audioConfiguration->defaultAudioInputParams());
-
-        // Initialize IPlayback facade and make sure that it's initialized after the audio-engine
-        s_playbackFacade->init();
-    };
+    s_audioInited = true;
 
-    auto workerLoopBody = []() {
-        ONLY_AUDIO_WORKER_THREAD;
-        s_audioBuffer->forward();
-    };
-
-    s_audioWorker->run(workerSetup, workerLoopBody);
+    if (mode == framework::IApplication::RunMode::Editor || s_playbackResolved) {
+        startAudioWorker();
+    }
 
     //! --- Diagnostics ---
     auto pr = ioc()->resolve<diagnostics::IDiagnosticsPathsRegister>(moduleName());
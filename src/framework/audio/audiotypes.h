@@ -25,6 +25,8 @@
 
 #include <variant>
 #include <memory>
+#include <array>
+#include <atomic>
 #include <set>
 #include <string>
 
@@ -227,43 +229,90 @@ struct AudioParams {
 struct AudioSignalVal {
     float amplitude = 0.f;
     volume_dbfs_t pressure = 0.f;
+    float peak = 0.f;
 };
 
-using AudioSignalChanges = async::Channel<audioch_t, AudioSignalVal>;
+//! NOTE The latest signal values of an audio output, per audio channel.
+//! Written by the audio worker once per processed block and polled by the UI at its frame rate,
+//! so neither side allocates, locks or queues anything. Each channel is guarded by a seqlock,
+//! there is only one writer (the audio worker)
+class AudioSignalsSnapshot
+{
+public:
+    static constexpr audioch_t MAX_CHANNELS = 8;
 
-struct AudioSignalsNotifier {
-    void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure)
+    void update(const audioch_t audioChNumber, const float amplitude, const float peak, const volume_dbfs_t pressure)
     {
-        AudioSignalVal& signalVal = m_signalValuesMap[audioChNumber];
-
-        volume_dbfs_t validatedPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
-
-        if (RealIsEqual(signalVal.amplitude, newAmplitude)
-            && RealIsEqual(signalVal.pressure, validatedPressure)) {
+        if (audioChNumber >= MAX_CHANNELS) {
             return;
         }
 
-        if (std::abs(signalVal.amplitude - newAmplitude) < AMPLITUDE_MINIMAL_VALUABLE_DIFF
-            && std::abs(signalVal.pressure - newPressure) < PRESSURE_MINIMAL_VALUABLE_DIFF) {
-            return;
+        if (audioChNumber >= m_audioChannelsCount.load(std::memory_order_relaxed)) {
+            m_audioChannelsCount.store(audioChNumber + 1, std::memory_order_release);
+        }
+
+        Slot& slot = m_slots[audioChNumber];
+
+        uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+        slot.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.amplitude.store(amplitude, std::memory_order_relaxed);
+        slot.peak.store(peak, std::memory_order_relaxed);
+        slot.pressure.store(std::max(pressure, MINIMUM_OPERABLE_DBFS_LEVEL), std::memory_order_relaxed);
+
+        slot.seq.store(seq + 2, std::memory_order_release);
+    }
+
+    AudioSignalVal value(const audioch_t audioChNumber) const
+    {
+        AudioSignalVal result;
+
+        if (audioChNumber >= MAX_CHANNELS) {
+            return result;
         }
 
-        signalVal.amplitude = newAmplitude;
-        signalVal.pressure = validatedPressure;
+        const Slot& slot = m_slots[audioChNumber];
+
+        uint32_t seqBefore = 0;
+        uint32_t seqAfter = 0;
+
+        do {
+            seqBefore = slot.seq.load(std::memory_order_acquire);
+
+            result.amplitude = slot.amplitude.load(std::memory_order_relaxed);
+            result.peak = slot.peak.load(std::memory_order_relaxed);
+            result.pressure = slot.pressure.load(std::memory_order_relaxed);
 
-        audioSignalChanges.send(audioChNumber, signalVal);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seqAfter = slot.seq.load(std::memory_order_relaxed);
+        } while (seqBefore != seqAfter || (seqBefore & 1));
+
+        return result;
     }
 
-    AudioSignalChanges audioSignalChanges;
+    //! NOTE The number of channels published so far
+    audioch_t audioChannelsCount() const
+    {
+        return m_audioChannelsCount.load(std::memory_order_acquire);
+    }
 
 private:
-    static constexpr float AMPLITUDE_MINIMAL_VALUABLE_DIFF = 0.01f;
-    static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = 1.f;
     static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
 
-    std::map<audioch_t, AudioSignalVal> m_signalValuesMap;
+    struct Slot {
+        std::atomic<uint32_t> seq = 0;
+        std::atomic<float> amplitude = 0.f;
+        std::atomic<float> peak = 0.f;
+        std::atomic<float> pressure = MINIMUM_OPERABLE_DBFS_LEVEL;
+    };
+
+    std::array<Slot, MAX_CHANNELS> m_slots;
+    std::atomic<audioch_t> m_audioChannelsCount = 0;
 };
 
+using AudioSignalsSnapshotPtr = std::shared_ptr<AudioSignalsSnapshot>;
+
 using PlaybackData = std::variant<mpe::PlaybackData, io::Device*>;
 using PlaybackSetupData = mpe::PlaybackSetupData;
 
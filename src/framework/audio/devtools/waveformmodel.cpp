@@ -27,24 +27,39 @@ using namespace mu::audio;
 static const volume_dbfs_t MAX_DISPLAYED_DBFS = 0.f; // 100%
 static const volume_dbfs_t MIN_DISPLAYED_DBFS = -60.f; // 0%
 
+static constexpr int SIGNALS_UPDATE_INTERVAL_MSECS = 1000 / 30;
+
 WaveFormModel::WaveFormModel(QObject* parent)
     : QObject(parent)
 {
-    playback()->audioOutput()->masterSignalChanges().onResolve(this, [this](AudioSignalChanges signalChanges) {
-        signalChanges.onReceive(this, [this](const audioch_t, const AudioSignalVal& newValue) {
-            setCurrentSignalAmplitude(newValue.amplitude);
-
-            if (newValue.pressure < MIN_DISPLAYED_DBFS) {
-                setCurrentVolumePressure(MIN_DISPLAYED_DBFS);
-            } else if (newValue.pressure > MAX_DISPLAYED_DBFS) {
-                setCurrentVolumePressure(MAX_DISPLAYED_DBFS);
-            } else {
-                setCurrentVolumePressure(newValue.pressure);
-            }
-        });
+    m_signalsUpdateTimer.setInterval(SIGNALS_UPDATE_INTERVAL_MSECS);
+    connect(&m_signalsUpdateTimer, &QTimer::timeout, this, &WaveFormModel::updateSignalValues);
+
+    playback()->audioOutput()->masterSignalsSnapshot().onResolve(this, [this](AudioSignalsSnapshotPtr signalsSnapshot) {
+        m_signals = std::move(signalsSnapshot);
+        m_signalsUpdateTimer.start();
     });
 }
 
+void WaveFormModel::updateSignalValues()
+{
+    if (!m_signals) {
+        return;
+    }
+
+    AudioSignalVal newValue = m_signals->value(0);
+
+    setCurrentSignalAmplitude(newValue.amplitude);
+
+    if (newValue.pressure < MIN_DISPLAYED_DBFS) {
+        setCurrentVolumePressure(MIN_DISPLAYED_DBFS);
+    } else if (newValue.pressure > MAX_DISPLAYED_DBFS) {
+        setCurrentVolumePressure(MAX_DISPLAYED_DBFS);
+    } else {
+        setCurrentVolumePressure(newValue.pressure);
+    }
+}
+
 QStringList WaveFormModel::availableSources() const
 {
     return m_availableSources;
@@ -87,12 +102,20 @@ void WaveFormModel::setCurrentSourceName(QString currentSourceName)
 
 void WaveFormModel::setCurrentSignalAmplitude(float currentSignalAmplitude)
 {
+    if (qFuzzyCompare(m_currentSignalAmplitude, currentSignalAmplitude)) {
+        return;
+    }
+
     m_currentSignalAmplitude = currentSignalAmplitude;
     emit currentSignalAmplitudeChanged(m_currentSignalAmplitude);
 }
 
 void WaveFormModel::setCurrentVolumePressure(float currentVolumePressure)
 {
+    if (qFuzzyCompare(m_currentVolumePressure, currentVolumePressure)) {
+        return;
+    }
+
     m_currentVolumePressure = currentVolumePressure;
     emit currentVolumePressureChanged(m_currentVolumePressure);
 }
@@ -24,6 +24,7 @@
 #define MU_AUDIO_WAVEFORMMODEL_H
 
 #include <QObject>
+#include <QTimer>
 
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
@@ -77,11 +78,16 @@ signals:
     void currentVolumePressureChanged(float currentVolumePressure);
 
 private:
+    void updateSignalValues();
+
     QStringList m_availableSources;
     QString m_currentSourceName;
 
     float m_currentSignalAmplitude = 0.f;
     float m_currentVolumePressure = 0.f;
+
+    AudioSignalsSnapshotPtr m_signals = nullptr;
+    QTimer m_signalsUpdateTimer;
 };
 }
 
@@ -27,6 +27,7 @@ using namespace mu::audio;
 
 static std::thread::id s_as_mainThreadID;
 static std::thread::id s_as_workerThreadID;
+static thread_local bool s_as_isWorkerHelperThread = false;
 
 void AudioSanitizer::setupMainThread()
 {
@@ -55,5 +56,10 @@ std::thread::id AudioSanitizer::workerThread()
 
 bool AudioSanitizer::isWorkerThread()
 {
-    return std::this_thread::get_id() == s_as_workerThreadID;
+    return std::this_thread::get_id() == s_as_workerThreadID || s_as_isWorkerHelperThread;
+}
+
+void AudioSanitizer::setIsWorkerHelperThread(bool arg)
+{
+    s_as_isWorkerHelperThread = arg;
 }
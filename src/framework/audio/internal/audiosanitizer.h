@@ -39,6 +39,10 @@ public:
     static void setupWorkerThread();
     static std::thread::id workerThread();
     static bool isWorkerThread();
+
+    //! NOTE Threads which process the audio on behalf of the worker thread,
+    //! while it is waiting for them (offline rendering)
+    static void setIsWorkerHelperThread(bool arg);
 };
 }
 
@@ -0,0 +1,224 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "audiokernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MU_AUDIO_KERNELS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MU_AUDIO_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(MU_AUDIO_KERNELS_AVX2) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "audiokernelsimpl.h"
+
+using namespace mu::audio::dsp;
+using namespace mu::audio::dsp::kernels;
+
+void mu::audio::dsp::kernels::scalarApplyGainAndMeasure(float* buffer, size_t audioChannelsCount, size_t samplesPerChannel,
+                                                        const float* channelGains, float* squaredSums, float* peaks)
+{
+    for (size_t c = 0; c < audioChannelsCount; ++c) {
+        squaredSums[c] = 0.f;
+        peaks[c] = 0.f;
+    }
+
+    for (size_t s = 0; s < samplesPerChannel; ++s) {
+        float* frame = buffer + s * audioChannelsCount;
+
+        for (size_t c = 0; c < audioChannelsCount; ++c) {
+            float sample = frame[c] * channelGains[c];
+            frame[c] = sample;
+
+            squaredSums[c] += sample * sample;
+            peaks[c] = std::max(peaks[c], std::abs(sample));
+        }
+    }
+}
+
+void mu::audio::dsp::kernels::scalarMixAccumulate(float* dst, const float* src, size_t samplesCount)
+{
+    for (size_t i = 0; i < samplesCount; ++i) {
+        dst[i] += src[i];
+    }
+}
+
+void mu::audio::dsp::kernels::scalarMultiply(float* buffer, size_t samplesCount, float multiplier)
+{
+    for (size_t i = 0; i < samplesCount; ++i) {
+        buffer[i] *= multiplier;
+    }
+}
+
+float mu::audio::dsp::kernels::scalarDotProduct(const float* a, const float* b, size_t samplesCount)
+{
+    float result = 0.f;
+
+    for (size_t i = 0; i < samplesCount; ++i) {
+        result += a[i] * b[i];
+    }
+
+    return result;
+}
+
+namespace mu::audio::dsp::kernels {
+static const AudioKernels SCALAR_AUDIO_KERNELS = {
+    &scalarApplyGainAndMeasure, &scalarMixAccumulate, &scalarMultiply, &scalarDotProduct
+};
+
+#ifdef MU_AUDIO_KERNELS_SSE2
+struct Sse2Traits {
+    using Reg = __m128;
+    static constexpr size_t WIDTH = 4;
+
+    static Reg load(const float* p) { return _mm_load_ps(p); }
+    static Reg loadu(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Reg r) { _mm_store_ps(p, r); }
+    static void storeu(float* p, Reg r) { _mm_storeu_ps(p, r); }
+    static Reg zero() { return _mm_setzero_ps(); }
+    static Reg set1(float v) { return _mm_set1_ps(v); }
+    static Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+    static Reg abs(Reg a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+};
+
+static const AudioKernels SSE2_AUDIO_KERNELS = SimdKernels<Sse2Traits>::kernels();
+#endif
+
+#ifdef MU_AUDIO_KERNELS_NEON
+struct NeonTraits {
+    using Reg = float32x4_t;
+    static constexpr size_t WIDTH = 4;
+
+    static Reg load(const float* p) { return vld1q_f32(p); }
+    static Reg loadu(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, Reg r) { vst1q_f32(p, r); }
+    static void storeu(float* p, Reg r) { vst1q_f32(p, r); }
+    static Reg zero() { return vdupq_n_f32(0.f); }
+    static Reg set1(float v) { return vdupq_n_f32(v); }
+    static Reg add(Reg a, Reg b) { return vaddq_f32(a, b); }
+    static Reg mul(Reg a, Reg b) { return vmulq_f32(a, b); }
+    static Reg max(Reg a, Reg b) { return vmaxq_f32(a, b); }
+    static Reg abs(Reg a) { return vabsq_f32(a); }
+};
+
+static const AudioKernels NEON_AUDIO_KERNELS = SimdKernels<NeonTraits>::kernels();
+#endif
+
+#ifdef MU_AUDIO_KERNELS_AVX2
+static bool cpuSupportsAvx2()
+{
+#ifdef _MSC_VER
+    int info[4] = { 0 };
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+
+    __cpuid(info, 1);
+    bool osUsesXSave = info[2] & (1 << 27);
+    bool cpuSupportsAvx = info[2] & (1 << 28);
+    if (!osUsesXSave || !cpuSupportsAvx) {
+        return false;
+    }
+
+    //! NOTE Check that the OS saves the AVX registers
+    if ((_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return info[1] & (1 << 5);
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+static KernelsInstructionSet bestInstructionSet()
+{
+#ifdef MU_AUDIO_KERNELS_AVX2
+    if (cpuSupportsAvx2()) {
+        return KernelsInstructionSet::AVX2;
+    }
+#endif
+
+#if defined(MU_AUDIO_KERNELS_SSE2)
+    return KernelsInstructionSet::SSE2;
+#elif defined(MU_AUDIO_KERNELS_NEON)
+    return KernelsInstructionSet::NEON;
+#else
+    return KernelsInstructionSet::Scalar;
+#endif
+}
+}
+
+const AudioKernels& mu::audio::dsp::audioKernels()
+{
+    static const AudioKernels* kernels = audioKernels(audioKernelsInstructionSet());
+    return *kernels;
+}
+
+KernelsInstructionSet mu::audio::dsp::audioKernelsInstructionSet()
+{
+    static const KernelsInstructionSet instructionSet = bestInstructionSet();
+    return instructionSet;
+}
+
+const AudioKernels* mu::audio::dsp::audioKernels(KernelsInstructionSet instructionSet)
+{
+    switch (instructionSet) {
+    case KernelsInstructionSet::Scalar:
+        return &SCALAR_AUDIO_KERNELS;
+    case KernelsInstructionSet::SSE2:
+#ifdef MU_AUDIO_KERNELS_SSE2
+        return &SSE2_AUDIO_KERNELS;
+#else
+        return nullptr;
+#endif
+    case KernelsInstructionSet::AVX2:
+#ifdef MU_AUDIO_KERNELS_AVX2
+        return cpuSupportsAvx2() ? &AVX2_AUDIO_KERNELS : nullptr;
+#else
+        return nullptr;
+#endif
+    case KernelsInstructionSet::NEON:
+#ifdef MU_AUDIO_KERNELS_NEON
+        return &NEON_AUDIO_KERNELS;
+#else
+        return nullptr;
+#endif
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,64 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_AUDIOKERNELS_H
+#define MU_AUDIO_AUDIOKERNELS_H
+
+#include <cstddef>
+
+//! NOTE This header is also included by the translation unit compiled with AVX2 enabled,
+//! so it must not include anything that may emit inline code or static initializers
+
+namespace mu::audio::dsp {
+enum class KernelsInstructionSet {
+    Scalar = 0,
+    SSE2,
+    AVX2,
+    NEON
+};
+
+//! NOTE Vectorized kernels for interleaved float buffers.
+//! The instruction set is chosen once at runtime, according to the CPU
+struct AudioKernels {
+    //! NOTE Multiplies every sample by the gain of its audio channel (so volume and balance at once),
+    //! stores the sum of squares and the peak (max absolute value) of the result for each audio channel
+    void (* applyGainAndMeasure)(float* buffer, size_t audioChannelsCount, size_t samplesPerChannel,
+                                 const float* channelGains, float* squaredSums, float* peaks);
+
+    //! NOTE dst[i] += src[i]
+    void (* mixAccumulate)(float* dst, const float* src, size_t samplesCount);
+
+    //! NOTE buffer[i] *= multiplier
+    void (* multiply)(float* buffer, size_t samplesCount, float multiplier);
+
+    //! NOTE Returns the sum of a[i] * b[i]
+    float (* dotProduct)(const float* a, const float* b, size_t samplesCount);
+};
+
+const AudioKernels& audioKernels();
+KernelsInstructionSet audioKernelsInstructionSet();
+
+//! NOTE Returns nullptr if the instruction set isn't supported by the CPU or by the build
+const AudioKernels* audioKernels(KernelsInstructionSet instructionSet);
+}
+
+#endif // MU_AUDIO_AUDIOKERNELS_H
@@ -0,0 +1,49 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+//! NOTE This file is compiled with AVX2 enabled (see CMakeLists.txt), but its code is only called
+//! if the CPU supports AVX2. So it must not include headers with inline functions which may be
+//! used by other translation units (the linker could pick the AVX2 version of them)
+
+#include <immintrin.h>
+
+#include "audiokernelsimpl.h"
+
+namespace mu::audio::dsp::kernels {
+struct Avx2Traits {
+    using Reg = __m256;
+    static constexpr size_t WIDTH = 8;
+
+    static Reg load(const float* p) { return _mm256_load_ps(p); }
+    static Reg loadu(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, Reg r) { _mm256_store_ps(p, r); }
+    static void storeu(float* p, Reg r) { _mm256_storeu_ps(p, r); }
+    static Reg zero() { return _mm256_setzero_ps(); }
+    static Reg set1(float v) { return _mm256_set1_ps(v); }
+    static Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+    static Reg abs(Reg a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a); }
+};
+
+extern const AudioKernels AVX2_AUDIO_KERNELS = SimdKernels<Avx2Traits>::kernels();
+}
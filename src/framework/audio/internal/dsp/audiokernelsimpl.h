@@ -0,0 +1,188 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_AUDIOKERNELSIMPL_H
+#define MU_AUDIO_AUDIOKERNELSIMPL_H
+
+#include "audiokernels.h"
+
+//! NOTE Shared by all instruction sets, the SIMD code is instantiated with the register traits
+//! of each instruction set in its own translation unit. Same as audiokernels.h, nothing that may
+//! emit inline code must be included here (see audiokernelsavx2.cpp)
+
+namespace mu::audio::dsp::kernels {
+void scalarApplyGainAndMeasure(float* buffer, size_t audioChannelsCount, size_t samplesPerChannel,
+                               const float* channelGains, float* squaredSums, float* peaks);
+void scalarMixAccumulate(float* dst, const float* src, size_t samplesCount);
+void scalarMultiply(float* buffer, size_t samplesCount, float multiplier);
+float scalarDotProduct(const float* a, const float* b, size_t samplesCount);
+
+#ifdef MU_AUDIO_KERNELS_AVX2
+extern const AudioKernels AVX2_AUDIO_KERNELS;
+#endif
+
+//! NOTE The traits V provide the register type Reg, its WIDTH (floats per register)
+//! and the load/loadu/store/storeu/zero/set1/add/mul/max/abs operations
+template<typename V>
+struct SimdKernels
+{
+    using Reg = typename V::Reg;
+
+    static constexpr size_t WIDTH = V::WIDTH;
+
+    static void applyGainAndMeasure(float* buffer, size_t audioChannelsCount, size_t samplesPerChannel,
+                                    const float* channelGains, float* squaredSums, float* peaks)
+    {
+        //! NOTE Each lane must always hold the samples of the same audio channel
+        if (audioChannelsCount == 0 || WIDTH % audioChannelsCount != 0) {
+            scalarApplyGainAndMeasure(buffer, audioChannelsCount, samplesPerChannel, channelGains, squaredSums, peaks);
+            return;
+        }
+
+        alignas(32) float lanes[WIDTH];
+
+        for (size_t l = 0; l < WIDTH; ++l) {
+            lanes[l] = channelGains[l % audioChannelsCount];
+        }
+
+        const Reg gain = V::load(lanes);
+        Reg sum1 = V::zero();
+        Reg sum2 = V::zero();
+        Reg peak1 = V::zero();
+        Reg peak2 = V::zero();
+
+        const size_t samplesCount = samplesPerChannel * audioChannelsCount;
+        size_t i = 0;
+
+        for (; i + 2 * WIDTH <= samplesCount; i += 2 * WIDTH) {
+            Reg s1 = V::mul(V::loadu(buffer + i), gain);
+            Reg s2 = V::mul(V::loadu(buffer + i + WIDTH), gain);
+            V::storeu(buffer + i, s1);
+            V::storeu(buffer + i + WIDTH, s2);
+
+            sum1 = V::add(sum1, V::mul(s1, s1));
+            sum2 = V::add(sum2, V::mul(s2, s2));
+            peak1 = V::max(peak1, V::abs(s1));
+            peak2 = V::max(peak2, V::abs(s2));
+        }
+
+        for (; i + WIDTH <= samplesCount; i += WIDTH) {
+            Reg s = V::mul(V::loadu(buffer + i), gain);
+            V::storeu(buffer + i, s);
+
+            sum1 = V::add(sum1, V::mul(s, s));
+            peak1 = V::max(peak1, V::abs(s));
+        }
+
+        for (size_t c = 0; c < audioChannelsCount; ++c) {
+            squaredSums[c] = 0.f;
+            peaks[c] = 0.f;
+        }
+
+        V::store(lanes, V::add(sum1, sum2));
+        for (size_t l = 0; l < WIDTH; ++l) {
+            squaredSums[l % audioChannelsCount] += lanes[l];
+        }
+
+        V::store(lanes, V::max(peak1, peak2));
+        for (size_t l = 0; l < WIDTH; ++l) {
+            float& p = peaks[l % audioChannelsCount];
+            p = lanes[l] > p ? lanes[l] : p;
+        }
+
+        //! NOTE i is a multiple of WIDTH here, so the tail starts with the first audio channel
+        for (; i < samplesCount; ++i) {
+            size_t c = i % audioChannelsCount;
+            float s = buffer[i] * channelGains[c];
+            buffer[i] = s;
+
+            squaredSums[c] += s * s;
+            float a = s < 0.f ? -s : s;
+            peaks[c] = a > peaks[c] ? a : peaks[c];
+        }
+    }
+
+    static void mixAccumulate(float* dst, const float* src, size_t samplesCount)
+    {
+        size_t i = 0;
+
+        for (; i + WIDTH <= samplesCount; i += WIDTH) {
+            V::storeu(dst + i, V::add(V::loadu(dst + i), V::loadu(src + i)));
+        }
+
+        for (; i < samplesCount; ++i) {
+            dst[i] += src[i];
+        }
+    }
+
+    static void multiply(float* buffer, size_t samplesCount, float multiplier)
+    {
+        const Reg m = V::set1(multiplier);
+        size_t i = 0;
+
+        for (; i + WIDTH <= samplesCount; i += WIDTH) {
+            V::storeu(buffer + i, V::mul(V::loadu(buffer + i), m));
+        }
+
+        for (; i < samplesCount; ++i) {
+            buffer[i] *= multiplier;
+        }
+    }
+
+    static float dotProduct(const float* a, const float* b, size_t samplesCount)
+    {
+        Reg sum1 = V::zero();
+        Reg sum2 = V::zero();
+        size_t i = 0;
+
+        for (; i + 2 * WIDTH <= samplesCount; i += 2 * WIDTH) {
+            sum1 = V::add(sum1, V::mul(V::loadu(a + i), V::loadu(b + i)));
+            sum2 = V::add(sum2, V::mul(V::loadu(a + i + WIDTH), V::loadu(b + i + WIDTH)));
+        }
+
+        for (; i + WIDTH <= samplesCount; i += WIDTH) {
+            sum1 = V::add(sum1, V::mul(V::loadu(a + i), V::loadu(b + i)));
+        }
+
+        alignas(32) float lanes[WIDTH];
+        V::store(lanes, V::add(sum1, sum2));
+
+        float result = 0.f;
+        for (size_t l = 0; l < WIDTH; ++l) {
+            result += lanes[l];
+        }
+
+        for (; i < samplesCount; ++i) {
+            result += a[i] * b[i];
+        }
+
+        return result;
+    }
+
+    static constexpr AudioKernels kernels()
+    {
+        return { &applyGainAndMeasure, &mixAccumulate, &multiply, &dotProduct };
+    }
+};
+}
+
+#endif // MU_AUDIO_AUDIOKERNELSIMPL_H
@@ -22,6 +22,11 @@
 
 #include "soundtrackwriter.h"
 
+#include <chrono>
+
+#include "defer.h"
+#include "log.h"
+
 #include "internal/worker/audioengine.h"
 #include "internal/encoders/mp3encoder.h"
 #include "internal/encoders/oggencoder.h"
@@ -70,21 +75,33 @@ bool SoundTrackWriter::write()
     m_source->setSampleRate(m_encoderPtr->format().sampleRate);
     m_source->setIsActive(true);
 
+    DEFER {
+        m_source->setSampleRate(AudioEngine::instance()->sampleRate());
+        m_source->setIsActive(false);
+
+        AudioEngine::instance()->setMode(AudioEngine::Mode::RealTimeMode);
+    };
+
+    auto renderStart = std::chrono::steady_clock::now();
+
     if (!prepareInputBuffer()) {
         return false;
     }
 
+    auto renderDuration = std::chrono::duration<double>(std::chrono::steady_clock::now() - renderStart);
+
+    //! NOTE Offline rendering throughput, e.g. "x40" means that one second of audio was rendered in 25 ms
+    double renderedFrames = m_inputBuffer.size() / static_cast<double>(SUPPORTED_AUDIO_CHANNELS_COUNT);
+    double audioDuration = renderedFrames / m_encoderPtr->format().sampleRate;
+    LOGI() << "Rendered " << audioDuration << " sec of audio in " << renderDuration.count() << " sec, x"
+           << (renderDuration.count() > 0 ? audioDuration / renderDuration.count() : 0) << " realtime";
+
     if (m_encoderPtr->encode(m_inputBuffer.size() / sizeof(float), m_inputBuffer.data()) == 0) {
         return false;
     }
 
     m_encoderPtr->flush();
 
-    m_source->setSampleRate(AudioEngine::instance()->sampleRate());
-    m_source->setIsActive(false);
-
-    AudioEngine::instance()->setMode(AudioEngine::Mode::RealTimeMode);
-
     return true;
 }
 
@@ -291,8 +291,8 @@ void FluidSynth::revokePlayingNotes()
 
         const NoteEvent& noteEvent = std::get<NoteEvent>(event);
 
-        handleNoteOffEvents(event, noteEvent.arrangementCtx().actualTimestamp,
-                            noteEvent.arrangementCtx().actualTimestamp + noteEvent.arrangementCtx().actualDuration);
+        timestamp_t timestampTo = noteEvent.arrangementCtx().actualTimestamp + noteEvent.arrangementCtx().actualDuration;
+        handleNoteOffEvents(event, noteEvent.arrangementCtx().actualTimestamp, timestampTo + 1);
     }
 
     m_playingEvents.clear();
@@ -385,60 +385,51 @@ samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
         return 0;
     }
 
-    msecs_t nextMsecs = samplesToMsecs(samplesPerChannel, m_sampleRate);
+    msecs_t blockEnd = framesToMsecs(m_playbackPositionFrames + samplesPerChannel);
 
-    if (!hasAnythingToPlayback(m_playbackPosition, m_playbackPosition + nextMsecs)) {
+    if (!hasAnythingToPlayback(m_playbackPosition, blockEnd)) {
         if (isActive()) {
-            setPlaybackPosition(m_playbackPosition + nextMsecs);
+            advancePlaybackPosition(samplesPerChannel);
         }
         return 0;
     }
 
-    if (isActive()) {
-        handleMainStreamEvents(nextMsecs);
-    } else {
-        handleOffStreamEvents(nextMsecs);
+    if (!isActive()) {
+        handleOffStreamEvents(samplesPerChannel * 1000 / m_sampleRate);
+
+        return writeFrames(buffer, 0, samplesPerChannel) ? samplesPerChannel : 0;
     }
 
-    int result = fluid_synth_write_float(m_fluid->synth, samplesPerChannel,
-                                         buffer, 0, audioChannelsCount(),
-                                         buffer, 1, audioChannelsCount());
+    //! NOTE The block is split at the frames where events start or end
+    samples_t offset = 0;
 
-    if (result != FLUID_OK) {
-        return 0;
+    while (offset < samplesPerChannel) {
+        samples_t framesCount = handleMainStreamEvents(samplesPerChannel - offset);
+
+        if (!writeFrames(buffer, offset, framesCount)) {
+            return 0;
+        }
+
+        offset += framesCount;
     }
 
     return samplesPerChannel;
 }
 
-async::Channel<unsigned int> FluidSynth::audioChannelsCountChanged() const
-{
-    return m_streamsCountChanged;
-}
-
-void FluidSynth::handleMainStreamEvents(const msecs_t nextMsecs)
+bool FluidSynth::writeFrames(float* buffer, const samples_t offset, const samples_t framesCount)
 {
-    msecs_t from = m_playbackPosition;
-
-    if (m_playbackPosition == 0) {
-        from = actualPlaybackPositionStart();
-    }
+    unsigned int channelsCount = audioChannelsCount();
 
-    msecs_t to = from + nextMsecs;
+    int result = fluid_synth_write_float(m_fluid->synth, static_cast<int>(framesCount),
+                                         buffer, static_cast<int>(offset * channelsCount), channelsCount,
+                                         buffer, static_cast<int>(offset * channelsCount + 1), channelsCount);
 
-    EventsMapIteratorList range = m_mainStreamEvents.findEventsRange(from, to);
-
-    for (const auto& it : range) {
-        for (const PlaybackEvent& event : it->second) {
-            if (handleNoteOnEvents(event, from, from + nextMsecs)) {
-                m_playingEvents.emplace_back(event);
-            }
-        }
-    }
-
-    handleAlreadyPlayingEvents(from, from + nextMsecs);
+    return result == FLUID_OK;
+}
 
-    setPlaybackPosition(to);
+async::Channel<unsigned int> FluidSynth::audioChannelsCountChanged() const
+{
+    return m_streamsCountChanged;
 }
 
 void FluidSynth::handleOffStreamEvents(const msecs_t nextMsecs)
@@ -464,18 +455,6 @@ void FluidSynth::handleOffStreamEvents(const msecs_t nextMsecs)
     }
 }
 
-void FluidSynth::handleAlreadyPlayingEvents(const msecs_t from, const msecs_t to)
-{
-    auto it = m_playingEvents.cbegin();
-    while (it != m_playingEvents.cend()) {
-        if (handleNoteOffEvents(*it, from, to)) {
-            it = m_playingEvents.erase(it);
-        } else {
-            ++it;
-        }
-    }
-}
-
 void FluidSynth::handleDynamicLevel(const msecs_t from, const msecs_t to)
 {
     if (m_dynamicLevelMap.empty()) {
@@ -563,7 +542,7 @@ bool FluidSynth::handleNoteOffEvents(const mpe::PlaybackEvent& event, const msec
     handleAftertouch(noteEvent, channelIdx, from, to);
     handleDynamicLevel(from, to);
 
-    if (timestampTo <= from || timestampTo > to) {
+    if (timestampTo < from || timestampTo >= to) {
         return false;
     }
 
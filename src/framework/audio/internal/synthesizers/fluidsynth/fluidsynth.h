@@ -71,13 +71,13 @@ public:
 private:
     Ret init();
 
-    void handleMainStreamEvents(const msecs_t nextMsecs);
+    bool writeFrames(float* buffer, const samples_t offset, const samples_t framesCount);
+
     void handleOffStreamEvents(const msecs_t nextMsecs);
-    void handleAlreadyPlayingEvents(const msecs_t from, const msecs_t to);
 
     void handleDynamicLevel(const msecs_t from, const msecs_t to);
-    bool handleNoteOnEvents(const mpe::PlaybackEvent& event, const msecs_t from, const msecs_t to);
-    bool handleNoteOffEvents(const mpe::PlaybackEvent& event, const msecs_t from, const msecs_t to);
+    bool handleNoteOnEvents(const mpe::PlaybackEvent& event, const msecs_t from, const msecs_t to) override;
+    bool handleNoteOffEvents(const mpe::PlaybackEvent& event, const msecs_t from, const msecs_t to) override;
 
     void handlePitchBendControl(const mpe::NoteEvent& noteEvent, const midi::channel_t channelIdx, const msecs_t from, const msecs_t to);
     void handleAftertouch(const mpe::NoteEvent& noteEvent, const midi::channel_t channelIdx, const msecs_t from, const msecs_t to);
@@ -135,7 +135,6 @@ private:
 
     mutable std::unordered_map<midi::channel_t, ControllersModeContext> m_controllersModeMap;
 
-    std::list<mpe::PlaybackEvent> m_playingEvents;
     int m_currentExpressionLevel = 0;
 };
 
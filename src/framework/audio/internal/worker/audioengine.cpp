@@ -134,6 +134,8 @@ void AudioEngine::setMode(const Mode newMode)
 
     m_currentMode = newMode;
 
+    m_mixer->setIsOfflineMode(m_currentMode == Mode::OfflineMode);
+
     if (m_currentMode == Mode::RealTimeMode) {
         m_buffer->setSource(m_mixer->mixedSource());
     } else {
@@ -49,8 +49,8 @@ public:
 
     async::Promise<AudioResourceMetaList> availableOutputResources() const override;
 
-    async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const override;
-    async::Promise<AudioSignalChanges> masterSignalChanges() const override;
+    async::Promise<AudioSignalsSnapshotPtr> signalsSnapshot(const TrackSequenceId sequenceId, const TrackId trackId) const override;
+    async::Promise<AudioSignalsSnapshotPtr> masterSignalsSnapshot() const override;
 
     async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                         const SoundTrackFormat& format) override;
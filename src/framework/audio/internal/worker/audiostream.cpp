@@ -38,8 +38,20 @@
 using namespace mu::audio;
 
 AudioStream::AudioStream()
-    : m_src(m_data, 0, 1, 1)
+    : m_src(0, 1, 1)
 {
+    m_src.setReader([this](float* buffer, samples_t samplesPerChannel) {
+        samples_t framesCount = m_data.size() / m_channels;
+        if (m_srcReadPosition >= framesCount) {
+            return samples_t(0);
+        }
+
+        samples_t framesToCopy = std::min(samplesPerChannel, framesCount - m_srcReadPosition);
+        std::copy_n(m_data.begin() + m_srcReadPosition * m_channels, framesToCopy * m_channels, buffer);
+        m_srcReadPosition += framesToCopy;
+
+        return framesToCopy;
+    });
 }
 
 bool AudioStream::loadFile(const io::path_t& path)
@@ -48,6 +60,7 @@ bool AudioStream::loadFile(const io::path_t& path)
     if (loaded) {
         m_src.setChannelCount(m_channels);
         m_src.setSampleRateIn(m_sampleRate);
+        m_srcSampleRate = 0;
     }
     return loaded;
 }
@@ -55,9 +68,11 @@ bool AudioStream::loadFile(const io::path_t& path)
 void AudioStream::convertSampleRate(unsigned int sampleRate)
 {
     if (sampleRate != m_sampleRate) {
-        auto src = new SampleRateConvertor(m_data, m_channels, m_sampleRate, sampleRate);
-        m_data = src->convert();
+        m_data = SampleRateConvertor::convert(m_data, m_channels, m_sampleRate, sampleRate);
         m_sampleRate = sampleRate;
+
+        m_src.setSampleRateIn(m_sampleRate);
+        m_srcSampleRate = 0;
     }
 }
 
@@ -74,9 +89,20 @@ unsigned int AudioStream::sampleRate() const
 unsigned int AudioStream::copySamplesToBuffer(float* buffer, unsigned int fromSample, unsigned int sampleCount, unsigned int sampleRate)
 {
     if (m_sampleRate != sampleRate) {
-        m_src.setSampleRateOut(sampleRate);
+        //! NOTE The convertor is streaming, it is restarted only if the requested samples don't follow the previous ones
+        if (m_srcSampleRate != sampleRate || m_srcNextFrame != fromSample) {
+            m_src.setSampleRateOut(sampleRate);
+            m_src.reset();
+
+            m_srcSampleRate = sampleRate;
+            m_srcReadPosition = static_cast<samples_t>(fromSample) * m_sampleRate / sampleRate;
+            m_srcNextFrame = fromSample;
+        }
+
+        samples_t convertedFramesCount = m_src.process(buffer, sampleCount);
+        m_srcNextFrame += convertedFramesCount;
 
-        return m_src.convert(buffer, fromSample, sampleCount);
+        return static_cast<unsigned int>(convertedFramesCount);
     }
 
     auto from = fromSample * m_channels;
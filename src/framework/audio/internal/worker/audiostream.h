@@ -56,7 +56,11 @@ private:
     unsigned int m_channels = 1;
     unsigned int m_sampleRate = 1;
     std::vector<float> m_data = {};
+
     SampleRateConvertor m_src;
+    unsigned int m_srcSampleRate = 0;
+    samples_t m_srcReadPosition = 0;
+    samples_t m_srcNextFrame = 0;
 };
 }
 
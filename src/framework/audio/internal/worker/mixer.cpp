@@ -24,11 +24,21 @@
 #include "async/async.h"
 #include "log.h"
 
+#include <algorithm>
 #include <limits>
+#include <array>
+#include <cmath>
+
+//TODO: remove with global clearing of Q_OS_*** defines
+#include <QtGlobal>
+#ifndef Q_OS_WASM
+#include <QtConcurrent>
+#endif
 
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/audiokernels.h"
 #include "audioerrors.h"
 
 using namespace mu;
@@ -36,6 +46,7 @@ using namespace mu::audio;
 using namespace mu::async;
 
 Mixer::Mixer()
+    : m_audioSignals(std::make_shared<AudioSignalsSnapshot>())
 {
     ONLY_AUDIO_WORKER_THREAD;
 }
@@ -92,6 +103,18 @@ void Mixer::setAudioChannelsCount(const audioch_t count)
     m_audioChannelsCount = count;
 }
 
+void Mixer::setIsOfflineMode(bool arg)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_isOfflineMode = arg;
+
+    if (!m_isOfflineMode) {
+        m_channelOutputs.clear();
+        m_channelOutputs.shrink_to_fit();
+    }
+}
+
 void Mixer::setSampleRate(unsigned int sampleRate)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -122,6 +145,30 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 
     std::fill(outBuffer, outBuffer + samplesPerChannel * audioChannelsCount(), 0.f);
 
+    samples_t masterChannelSampleCount = m_isOfflineMode
+                                         ? processChannelsConcurrently(outBuffer, samplesPerChannel)
+                                         : processChannels(outBuffer, samplesPerChannel);
+
+    if (m_masterParams.muted || masterChannelSampleCount == 0) {
+        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+            updateAudioSignals(audioChNum, 0.f, 0.f);
+        }
+        return 0;
+    }
+
+    completeOutput(outBuffer, samplesPerChannel);
+
+    for (IFxProcessorPtr& fxProcessor : m_masterFxProcessors) {
+        if (fxProcessor->active()) {
+            fxProcessor->process(outBuffer, samplesPerChannel);
+        }
+    }
+
+    return masterChannelSampleCount;
+}
+
+samples_t Mixer::processChannels(float* outBuffer, samples_t samplesPerChannel)
+{
     if (m_writeCacheBuff.size() != samplesPerChannel * audioChannelsCount()) {
         m_writeCacheBuff.resize(samplesPerChannel * audioChannelsCount(), 0.f);
     }
@@ -136,22 +183,49 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
         masterChannelSampleCount = std::max(processedSamplesCount, masterChannelSampleCount);
     }
 
-    if (m_masterParams.muted || masterChannelSampleCount == 0) {
-        for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-            notifyAboutAudioSignalChanges(audioChNum, 0);
-        }
-        return 0;
+    return masterChannelSampleCount;
+}
+
+//! NOTE In the offline mode there are no real-time constraints, so every channel (its synth and fx chain)
+//! is processed on its own thread into its own buffer. Then the buffers are mixed in the same order as
+//! in processChannels(), so the result is exactly the same
+samples_t Mixer::processChannelsConcurrently(float* outBuffer, samples_t samplesPerChannel)
+{
+#ifdef Q_OS_WASM
+    return processChannels(outBuffer, samplesPerChannel);
+#else
+    if (m_mixerChannels.size() < 2) {
+        return processChannels(outBuffer, samplesPerChannel);
     }
 
-    completeOutput(outBuffer, samplesPerChannel);
+    const size_t bufferSize = samplesPerChannel * audioChannelsCount();
 
-    for (IFxProcessorPtr& fxProcessor : m_masterFxProcessors) {
-        if (fxProcessor->active()) {
-            fxProcessor->process(outBuffer, samplesPerChannel);
-        }
+    m_channelOutputs.resize(m_mixerChannels.size());
+
+    size_t outputIdx = 0;
+    for (auto& channel : m_mixerChannels) {
+        ChannelOutput& output = m_channelOutputs[outputIdx++];
+        output.channel = channel.second.get();
+        output.buffer.assign(bufferSize, 0.f);
+        output.processedSamplesCount = 0;
+    }
+
+    QtConcurrent::blockingMap(m_channelOutputs, [samplesPerChannel](ChannelOutput& output) {
+        AudioSanitizer::setIsWorkerHelperThread(true);
+        output.processedSamplesCount = output.channel->process(output.buffer.data(), samplesPerChannel);
+        AudioSanitizer::setIsWorkerHelperThread(false);
+    });
+
+    samples_t masterChannelSampleCount = 0;
+
+    for (ChannelOutput& output : m_channelOutputs) {
+        mixOutputFromChannel(outBuffer, output.buffer.data(), output.processedSamplesCount);
+
+        masterChannelSampleCount = std::max(output.processedSamplesCount, masterChannelSampleCount);
     }
 
     return masterChannelSampleCount;
+#endif
 }
 
 void Mixer::setIsActive(bool arg)
@@ -210,9 +284,9 @@ Channel<AudioOutputParams> Mixer::masterOutputParamsChanged() const
     return m_masterOutputParamsChanged;
 }
 
-async::Channel<audioch_t, AudioSignalVal> Mixer::masterAudioSignalChanges() const
+AudioSignalsSnapshotPtr Mixer::masterAudioSignalsSnapshot() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_audioSignals;
 }
 
 void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount)
@@ -225,13 +299,7 @@ void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int
         return;
     }
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        for (samples_t s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
-
-            outBuffer[idx] += inBuffer[idx];
-        }
-    }
+    dsp::audioKernels().mixAccumulate(outBuffer, inBuffer, samplesCount * audioChannelsCount());
 }
 
 void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
@@ -240,37 +308,57 @@ void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
         return;
     }
 
+    const audioch_t channelsCount = audioChannelsCount();
+
+    gain_t volumeGain = dsp::linearFromDecibels(m_masterParams.volume);
     float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
+    if (channelsCount <= AudioSignalsSnapshot::MAX_CHANNELS) {
+        std::array<gain_t, AudioSignalsSnapshot::MAX_CHANNELS> gains;
+        std::array<float, AudioSignalsSnapshot::MAX_CHANNELS> squaredSums;
+        std::array<float, AudioSignalsSnapshot::MAX_CHANNELS> peaks;
 
-        gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * dsp::linearFromDecibels(m_masterParams.volume);
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            gains[audioChNum] = dsp::balanceGain(m_masterParams.balance, audioChNum) * volumeGain;
+        }
 
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+        dsp::audioKernels().applyGainAndMeasure(buffer, channelsCount, samplesPerChannel, gains.data(), squaredSums.data(), peaks.data());
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            totalSquaredSum += squaredSums[audioChNum];
 
-            float squaredSample = resultSample * resultSample;
-            totalSquaredSum += squaredSample;
-            singleChannelSquaredSum += squaredSample;
+            float rms = dsp::samplesRootMeanSquare(squaredSums[audioChNum], samplesPerChannel);
+            updateAudioSignals(audioChNum, rms, peaks[audioChNum]);
+        }
+    } else {
+        //! NOTE The kernels only take up to MAX_CHANNELS gains, so wider outputs are mixed channel by channel
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            gain_t gain = dsp::balanceGain(m_masterParams.balance, audioChNum) * volumeGain;
+            float squaredSum = 0.f;
+            float peak = 0.f;
+
+            for (samples_t s = 0; s < samplesPerChannel; ++s) {
+                float& sample = buffer[s * channelsCount + audioChNum];
+                sample *= gain;
+
+                squaredSum += sample * sample;
+                peak = std::max(peak, std::abs(sample));
+            }
+
+            totalSquaredSum += squaredSum;
+            updateAudioSignals(audioChNum, dsp::samplesRootMeanSquare(squaredSum, samplesPerChannel), peak);
         }
-
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
-        notifyAboutAudioSignalChanges(audioChNum, rms);
     }
 
     if (!m_limiter->isActive()) {
         return;
     }
 
-    float totalRms = dsp::samplesRootMeanSquare(totalSquaredSum, samplesPerChannel * audioChannelsCount());
-    m_limiter->process(totalRms, buffer, audioChannelsCount(), samplesPerChannel);
+    float totalRms = dsp::samplesRootMeanSquare(totalSquaredSum, samplesPerChannel * channelsCount);
+    m_limiter->process(totalRms, buffer, channelsCount, samplesPerChannel);
 }
 
-void Mixer::notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const
+void Mixer::updateAudioSignals(const audioch_t audioChannelNumber, const float linearRms, const float peak)
 {
-    m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
+    m_audioSignals->update(audioChannelNumber, linearRms, peak, dsp::dbFromSample(linearRms));
 }
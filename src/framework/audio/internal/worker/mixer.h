@@ -48,6 +48,7 @@ public:
     Ret removeChannel(const TrackId id);
 
     void setAudioChannelsCount(const audioch_t count);
+    void setIsOfflineMode(bool arg);
 
     void addClock(IClockPtr clock);
     void removeClock(IClockPtr clock);
@@ -56,7 +57,7 @@ public:
     void setMasterOutputParams(const AudioOutputParams& params);
     async::Channel<AudioOutputParams> masterOutputParamsChanged() const;
 
-    async::Channel<audioch_t, AudioSignalVal> masterAudioSignalChanges() const;
+    AudioSignalsSnapshotPtr masterAudioSignalsSnapshot() const;
 
     // IAudioSource
     void setSampleRate(unsigned int sampleRate) override;
@@ -65,9 +66,18 @@ public:
     void setIsActive(bool arg) override;
 
 private:
+    struct ChannelOutput {
+        MixerChannel* channel = nullptr;
+        std::vector<float> buffer;
+        samples_t processedSamplesCount = 0;
+    };
+
+    samples_t processChannels(float* outBuffer, samples_t samplesPerChannel);
+    samples_t processChannelsConcurrently(float* outBuffer, samples_t samplesPerChannel);
+
     void mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount);
     void completeOutput(float* buffer, const samples_t& samplesPerChannel);
-    void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
+    void updateAudioSignals(const audioch_t audioChannelNumber, const float linearRms, const float peak);
 
     std::vector<float> m_writeCacheBuff;
 
@@ -81,7 +91,10 @@ private:
     std::set<IClockPtr> m_clocks;
     audioch_t m_audioChannelsCount = 0;
 
-    mutable AudioSignalsNotifier m_audioSignalNotifier;
+    bool m_isOfflineMode = false;
+    std::vector<ChannelOutput> m_channelOutputs;
+
+    AudioSignalsSnapshotPtr m_audioSignals = nullptr;
 };
 
 using MixerPtr = std::shared_ptr<Mixer>;
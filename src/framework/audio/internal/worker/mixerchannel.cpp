@@ -22,10 +22,13 @@
 #include "mixerchannel.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 
 #include "log.h"
 
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/audiokernels.h"
 #include "internal/audiosanitizer.h"
 
 using namespace mu;
@@ -36,7 +39,8 @@ MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const
     : m_trackId(trackId),
     m_sampleRate(sampleRate),
     m_audioSource(std::move(source)),
-    m_compressor(std::make_unique<dsp::Compressor>(sampleRate))
+    m_compressor(std::make_unique<dsp::Compressor>(sampleRate)),
+    m_audioSignals(std::make_shared<AudioSignalsSnapshot>())
 {
     ONLY_AUDIO_WORKER_THREAD;
 
@@ -97,9 +101,9 @@ async::Channel<AudioOutputParams> MixerChannel::outputParamsChanged() const
     return m_paramsChanges;
 }
 
-async::Channel<audioch_t, AudioSignalVal> MixerChannel::audioSignalChanges() const
+AudioSignalsSnapshotPtr MixerChannel::audioSignalsSnapshot() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_audioSignals;
 }
 
 bool MixerChannel::isActive() const
@@ -175,7 +179,7 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
         std::fill(buffer, buffer + samplesPerChannel * audioChannelsCount(), 0.f);
 
         for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-            notifyAboutAudioSignalChanges(audioChNum, 0.f);
+            updateAudioSignals(audioChNum, 0.f, 0.f);
         }
 
         return processedSamplesCount;
@@ -193,40 +197,59 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
     return processedSamplesCount;
 }
 
-void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) const
+void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount)
 {
+    const audioch_t channelsCount = audioChannelsCount();
+
+    gain_t volumeGain = dsp::linearFromDecibels(m_params.volume);
     float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
+    if (channelsCount <= AudioSignalsSnapshot::MAX_CHANNELS) {
+        std::array<gain_t, AudioSignalsSnapshot::MAX_CHANNELS> gains;
+        std::array<float, AudioSignalsSnapshot::MAX_CHANNELS> squaredSums;
+        std::array<float, AudioSignalsSnapshot::MAX_CHANNELS> peaks;
 
-        gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * dsp::linearFromDecibels(m_params.volume);
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            gains[audioChNum] = dsp::balanceGain(m_params.balance, audioChNum) * volumeGain;
+        }
 
-        for (unsigned int s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+        dsp::audioKernels().applyGainAndMeasure(buffer, channelsCount, samplesCount, gains.data(), squaredSums.data(), peaks.data());
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            totalSquaredSum += squaredSums[audioChNum];
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
+            float rms = dsp::samplesRootMeanSquare(squaredSums[audioChNum], samplesCount);
+            updateAudioSignals(audioChNum, rms, peaks[audioChNum]);
         }
+    } else {
+        //! NOTE Too many audio channels for the per-channel arrays, so they are processed one by one
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            gain_t gain = dsp::balanceGain(m_params.balance, audioChNum) * volumeGain;
+            float squaredSum = 0.f;
+            float peak = 0.f;
+
+            for (samples_t s = 0; s < samplesCount; ++s) {
+                float& sample = buffer[s * channelsCount + audioChNum];
+                sample *= gain;
+
+                squaredSum += sample * sample;
+                peak = std::max(peak, std::abs(sample));
+            }
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
-
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+            totalSquaredSum += squaredSum;
+            updateAudioSignals(audioChNum, dsp::samplesRootMeanSquare(squaredSum, samplesCount), peak);
+        }
     }
 
     if (!m_compressor->isActive()) {
         return;
     }
 
-    float totalRms = dsp::samplesRootMeanSquare(totalSquaredSum, samplesCount * audioChannelsCount());
-    m_compressor->process(totalRms, buffer, audioChannelsCount(), samplesCount);
+    float totalRms = dsp::samplesRootMeanSquare(totalSquaredSum, samplesCount * channelsCount);
+    m_compressor->process(totalRms, buffer, channelsCount, samplesCount);
 }
 
-void MixerChannel::notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const
+void MixerChannel::updateAudioSignals(const audioch_t audioChannelNumber, const float linearRms, const float peak)
 {
-    m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
+    m_audioSignals->update(audioChannelNumber, linearRms, peak, dsp::dbFromSample(linearRms));
 }
@@ -43,7 +43,7 @@ public:
     void applyOutputParams(const AudioOutputParams& requiredParams) override;
     async::Channel<AudioOutputParams> outputParamsChanged() const override;
 
-    async::Channel<audioch_t, AudioSignalVal> audioSignalChanges() const override;
+    AudioSignalsSnapshotPtr audioSignalsSnapshot() const override;
 
     bool isActive() const override;
     void setIsActive(bool arg) override;
@@ -54,8 +54,8 @@ public:
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
 private:
-    void completeOutput(float* buffer, unsigned int samplesCount) const;
-    void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
+    void completeOutput(float* buffer, unsigned int samplesCount);
+    void updateAudioSignals(const audioch_t audioChannelNumber, const float linearRms, const float peak);
 
     TrackId m_trackId = -1;
 
@@ -68,7 +68,7 @@ private:
     dsp::CompressorPtr m_compressor = nullptr;
 
     mutable async::Channel<AudioOutputParams> m_paramsChanges;
-    mutable AudioSignalsNotifier m_audioSignalNotifier;
+    AudioSignalsSnapshotPtr m_audioSignals = nullptr;
 };
 
 using MixerChannelPtr = std::shared_ptr<MixerChannel>;
@@ -20,74 +20,84 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include "samplerateconvertor.h"
-#include "log.h"
+
+#include <algorithm>
 #include <cmath>
+#include <numeric>
+
+#include "internal/dsp/audiokernels.h"
+
+#include "log.h"
 
 using namespace mu::audio;
 
-SampleRateConvertor::SampleRateConvertor(const std::vector<float>& data,
-                                         unsigned int channelsCount,
-                                         unsigned int sampleRateIn,
-                                         unsigned int sampleRateOut)
-    : m_data(data), m_fir(), m_channelsCount(channelsCount), m_sampleRateIn(sampleRateIn), m_sampleRateOut(sampleRateOut)
+//! NOTE If L is bigger (e.g. 44100 -> 44101), the coefficients are interpolated between the phases
+static constexpr size_t MAX_PHASES_COUNT = 1024;
+static constexpr samples_t READ_FRAMES_COUNT = 1024;
+
+struct FilterParams {
+    size_t halfTapsCount = 0; //!< per side, at the lower of the two rates
+    double kaiserBeta = 0.0;
+    double rolloff = 0.0; //!< cutoff, relative to the lower Nyquist frequency
+};
+
+static FilterParams filterParams(SampleRateConvertor::Quality quality)
 {
-    m_fir.resize(FIR_LENGTH, 0);
-    m_y.resize(FIR_LENGTH, 0);
-    initWindow();
+    switch (quality) {
+    case SampleRateConvertor::Quality::Low: return { 16, 6.0, 0.85 };
+    case SampleRateConvertor::Quality::Medium: return { 32, 8.0, 0.90 };
+    case SampleRateConvertor::Quality::High: return { 64, 10.0, 0.95 };
+    }
+
+    return { 32, 8.0, 0.90 };
 }
 
-std::vector<float> SampleRateConvertor::convert()
+//! NOTE Modified Bessel function of the first kind, order 0
+static double besselI0(double x)
 {
-    std::vector<float> out;
-    auto resultSamples = m_data.size() * m_sampleRateOut / (m_channelsCount * m_sampleRateIn);
+    double sum = 1.0;
+    double term = 1.0;
+    double halfX = x / 2.0;
 
-    out.resize(resultSamples * m_channelsCount);
-    for (unsigned sample = 0; sample < resultSamples; ++sample) {
-        for (unsigned int channel = 0; channel < m_channelsCount; ++channel) {
-            out[sample * m_channelsCount + channel] = y(sample, channel);
+    for (int k = 1; k < 64; ++k) {
+        term *= halfX / k;
+        double squaredTerm = term * term;
+        sum += squaredTerm;
+
+        if (squaredTerm < sum * 1e-12) {
+            break;
         }
     }
 
-    return out;
+    return sum;
 }
 
-unsigned int SampleRateConvertor::convert(float* buffer, unsigned int from, unsigned int count)
+SampleRateConvertor::SampleRateConvertor(unsigned int channelsCount, unsigned int sampleRateIn, unsigned int sampleRateOut,
+                                         Reader reader, Quality quality)
+    : m_channelsCount(channelsCount), m_sampleRateIn(sampleRateIn), m_sampleRateOut(sampleRateOut), m_quality(quality),
+    m_reader(std::move(reader))
 {
-    unsigned int sample = from;
-    unsigned int converted = 0;
-
-    for (converted = 0; converted < count; ++converted, ++sample) {
-        for (unsigned int channel = 0; channel < m_channelsCount; ++channel) {
-            if (!availableSamples(sample)) {
-                return converted;
-            }
-            buffer[converted * m_channelsCount + channel] = y(sample, channel);
-        }
-    }
-    return converted;
+    initFilter();
 }
 
-float SampleRateConvertor::y(unsigned int sample, unsigned int channel) const
+void SampleRateConvertor::setReader(Reader reader)
 {
-    switch (m_method) {
-    case SINC:
-        return ySinc(sample, channel);
-    case FIR:
-        return yFIR(sample, channel);
-    }
-    return 0.f;
+    m_reader = std::move(reader);
 }
 
 void SampleRateConvertor::setChannelCount(unsigned int count)
 {
-    m_channelsCount = count;
+    if (m_channelsCount != count) {
+        m_channelsCount = count;
+        initFilter();
+    }
 }
 
 void SampleRateConvertor::setSampleRateIn(unsigned int sampleRate)
 {
     if (m_sampleRateIn != sampleRate) {
         m_sampleRateIn = sampleRate;
-        initWindow();
+        initFilter();
     }
 }
 
@@ -95,116 +105,242 @@ void SampleRateConvertor::setSampleRateOut(unsigned int sampleRate)
 {
     if (m_sampleRateOut != sampleRate) {
         m_sampleRateOut = sampleRate;
-        initWindow();
+        initFilter();
     }
 }
 
-float SampleRateConvertor::ySinc(unsigned int sample, unsigned int channel) const
+void SampleRateConvertor::setQuality(Quality quality)
 {
-    double currentOutputSampleTime = sample / static_cast<double>(m_sampleRateOut);
-    auto zeroInputSample = std::floor(currentOutputSampleTime * m_sampleRateIn);
+    if (m_quality != quality) {
+        m_quality = quality;
+        initFilter();
+    }
+}
 
-    float out = 0.f;
-    for (unsigned int i = 0; i < USE_SAMPLES; ++i) {
-        int currentSample = zeroInputSample + i - USE_SAMPLES / 2;
-        double currentInputSampleTime = currentSample / static_cast<double>(m_sampleRateIn);
+void SampleRateConvertor::reset()
+{
+    //! NOTE The history starts with zeros before the first input frame,
+    //! so the first output frame corresponds exactly to the first input frame
+    size_t leadingFramesCount = m_tapsCount > 0 ? m_tapsCount / 2 - 1 : 0;
 
-        if (currentSample < 0 || currentSample * m_channelsCount + channel >= m_data.size()) {
-            continue;
-        }
-        out += m_data.at(currentSample * m_channelsCount + channel) * sinc(currentOutputSampleTime - currentInputSampleTime);
-    }
-    return out;
+    m_history.assign(m_channelsCount, std::vector<float>(leadingFramesCount, 0.f));
+    m_historyStart = -static_cast<int64_t>(leadingFramesCount);
+    m_historyFramesCount = leadingFramesCount;
+
+    m_inputPosition = 0;
+    m_phase = 0;
+    m_inputFramesCount = 0;
+    m_inputEnded = false;
+}
+
+samples_t SampleRateConvertor::outputFramesCount(samples_t inputFramesCount) const
+{
+    return (inputFramesCount * m_L + m_M - 1) / m_M;
 }
 
-float SampleRateConvertor::yFIR(unsigned int sample, unsigned int channel) const
+void SampleRateConvertor::initFilter()
 {
-    auto x = [this, &channel](int m) -> float {
-        int pos = m * m_M / m_L * m_channelsCount + channel;
-        if (pos >= 0 && pos < static_cast<int>(m_data.size())) {
-            return m_data.at(pos);
+    m_tapsCount = 0;
+    m_phasesCount = 0;
+    m_coefficients.clear();
+
+    if (m_channelsCount == 0 || m_sampleRateIn == 0 || m_sampleRateOut == 0) {
+        reset();
+        return;
+    }
+
+    unsigned int divider = std::gcd(m_sampleRateIn, m_sampleRateOut);
+    m_L = m_sampleRateOut / divider;
+    m_M = m_sampleRateIn / divider;
+
+    FilterParams params = filterParams(m_quality);
+
+    //! NOTE When downsampling, the cutoff is below the input Nyquist frequency, so the filter
+    //! is stretched in time (more input taps) to keep the same quality
+    double ratio = std::min(1.0, m_sampleRateOut / static_cast<double>(m_sampleRateIn));
+    double cutoff = m_sampleRateIn == m_sampleRateOut ? 1.0 : ratio * params.rolloff;
+    size_t halfTapsCount = static_cast<size_t>(std::ceil(params.halfTapsCount / ratio));
+
+    m_tapsCount = 2 * halfTapsCount;
+    m_phasesCount = std::min<size_t>(m_L, MAX_PHASES_COUNT);
+    m_coefficients.resize((m_phasesCount + 1) * m_tapsCount);
+    m_interpolatedCoefficients.resize(m_tapsCount);
+
+    double besselBeta = besselI0(params.kaiserBeta);
+
+    for (size_t phase = 0; phase <= m_phasesCount; ++phase) {
+        float* row = m_coefficients.data() + phase * m_tapsCount;
+        double fraction = phase / static_cast<double>(m_phasesCount);
+        double sum = 0.0;
+
+        for (size_t tap = 0; tap < m_tapsCount; ++tap) {
+            //! NOTE Distance (in input frames) between the output frame and the input frame of this tap
+            double t = fraction + static_cast<double>(halfTapsCount) - 1.0 - static_cast<double>(tap);
+            double x = M_PI * cutoff * t;
+            double sinc = t == 0.0 ? 1.0 : std::sin(x) / x;
+
+            double w = t / halfTapsCount;
+            double window = std::abs(w) >= 1.0 ? 0.0 : besselI0(params.kaiserBeta * std::sqrt(1.0 - w * w)) / besselBeta;
+
+            double value = cutoff * sinc * window;
+            row[tap] = static_cast<float>(value);
+            sum += value;
         }
-        return 0.f;
-    };
 
-    float y = 0.f;
-    for (unsigned int i = 0; i < FIR_LENGTH; ++i) {
-        int t = sample - static_cast<int>(i);
-        y += x(t) * m_fir[i];
+        //! NOTE Unity gain for DC in every phase
+        for (size_t tap = 0; tap < m_tapsCount; ++tap) {
+            row[tap] = static_cast<float>(row[tap] / sum);
+        }
     }
-    return y;
+
+    m_readBuffer.resize(READ_FRAMES_COUNT * m_channelsCount);
+
+    reset();
 }
 
-bool SampleRateConvertor::availableSamples(unsigned int sample) const
+const float* SampleRateConvertor::phaseCoefficients()
 {
-    float currentOutputSampleTime = sample / static_cast<float>(m_sampleRateOut);
-    auto firstInputSample = std::floor(currentOutputSampleTime * m_sampleRateIn) - USE_SAMPLES / 2;
+    if (m_phasesCount == m_L) {
+        return m_coefficients.data() + m_phase * m_tapsCount;
+    }
 
-    // first sample for conversion points out of the input buffer
-    if (firstInputSample * m_channelsCount >= m_data.size()) {
-        return false;
+    double position = static_cast<double>(m_phase) * m_phasesCount / m_L;
+    size_t phase = static_cast<size_t>(position);
+    float fraction = static_cast<float>(position - phase);
+
+    const float* row1 = m_coefficients.data() + phase * m_tapsCount;
+    const float* row2 = row1 + m_tapsCount;
+
+    for (size_t tap = 0; tap < m_tapsCount; ++tap) {
+        m_interpolatedCoefficients[tap] = row1[tap] + (row2[tap] - row1[tap]) * fraction;
     }
-    return true;
+
+    return m_interpolatedCoefficients.data();
 }
 
-inline double zeroBessel(double x)
+bool SampleRateConvertor::fillHistory(int64_t untilInputFrame)
 {
-    //return std::cyl_bessel_i(0, x);
+    if (untilInputFrame <= m_historyStart + static_cast<int64_t>(m_historyFramesCount)) {
+        return true;
+    }
 
-    double s = 1, y = 1;
-    int m = 1;
+    //! NOTE Drop the frames which won't be used anymore
+    int64_t firstNeededFrame = untilInputFrame - static_cast<int64_t>(m_tapsCount);
+    size_t dropFramesCount = static_cast<size_t>(std::clamp<int64_t>(firstNeededFrame - m_historyStart, 0,
+                                                                     static_cast<int64_t>(m_historyFramesCount)));
 
-    while (y > std::numeric_limits<float>::min()) {
-        m += 2;
-        y *= x * x / (4 * m * m);
-        s += s * y;
+    if (dropFramesCount > 0) {
+        for (std::vector<float>& channel : m_history) {
+            channel.erase(channel.begin(), channel.begin() + dropFramesCount);
+        }
+
+        m_historyStart += dropFramesCount;
+        m_historyFramesCount -= dropFramesCount;
     }
 
-    return s;
-}
+    while (m_historyStart + static_cast<int64_t>(m_historyFramesCount) < untilInputFrame) {
+        samples_t framesRead = 0;
 
-void SampleRateConvertor::initWindow()
-{
-    int max = std::max(m_sampleRateIn, m_sampleRateOut), min = std::min(m_sampleRateIn, m_sampleRateOut);
-    int maxCommonDivider = 1;
-    while (max % min != 0) {
-        maxCommonDivider = max % min;
-        max = min;
-        min = maxCommonDivider;
+        if (!m_inputEnded) {
+            if (!m_reader) {
+                return false;
+            }
+
+            framesRead = std::min(m_reader(m_readBuffer.data(), READ_FRAMES_COUNT), READ_FRAMES_COUNT);
+            m_inputEnded = framesRead == 0;
+        }
+
+        if (framesRead > 0) {
+            for (unsigned int ch = 0; ch < m_channelsCount; ++ch) {
+                std::vector<float>& channel = m_history[ch];
+
+                for (samples_t frame = 0; frame < framesRead; ++frame) {
+                    channel.push_back(m_readBuffer[frame * m_channelsCount + ch]);
+                }
+            }
+
+            m_inputFramesCount += framesRead;
+            m_historyFramesCount += framesRead;
+            continue;
+        }
+
+        //! NOTE After the end of the input, the filter is flushed with zeros
+        size_t zerosCount = untilInputFrame - (m_historyStart + static_cast<int64_t>(m_historyFramesCount));
+        for (std::vector<float>& channel : m_history) {
+            channel.resize(channel.size() + zerosCount, 0.f);
+        }
+
+        m_historyFramesCount += zerosCount;
     }
-    m_M = m_sampleRateIn / maxCommonDivider;
-    m_L = m_sampleRateOut / maxCommonDivider;
-    double fStop = std::min(m_sampleRateIn, m_sampleRateOut) / 2,
-           fIntermediateSampleRate = m_sampleRateIn * m_M,
-           attenuation = 96 /*dB*/;
-    int M = FIR_LENGTH;
-    int Np = (M - 1) / 2;
 
-    double alpha = 0.1102 * (attenuation - 8.7);
-    double A[FIR_LENGTH];
+    return true;
+}
 
-    A[0] = 2 * fStop / fIntermediateSampleRate;
-    for (int j = 1; j <= Np; j++) {
-        A[j]  = std::sin(2 * j * M_PI * fStop / fIntermediateSampleRate) / j * M_PI;
+samples_t SampleRateConvertor::process(float* buffer, samples_t samplesPerChannel)
+{
+    IF_ASSERT_FAILED(buffer) {
+        return 0;
     }
 
-    for (int j = 0; j <= Np; j++) {
-        m_fir[Np + j]  = A[j];
-        m_fir[Np + j] *= zeroBessel(alpha * std::sqrt(1 - (j * j / (Np * Np))));
-        m_fir[Np + j] /= zeroBessel(alpha);
+    if (m_tapsCount == 0) {
+        return 0;
     }
 
-    for (int j = 0; j < Np; j++) {
-        m_fir[j] = m_fir[M - 1 - j];
+    const dsp::AudioKernels& kernels = dsp::audioKernels();
+    const int64_t leadingFramesCount = static_cast<int64_t>(m_tapsCount / 2) - 1;
+
+    samples_t frame = 0;
+
+    for (; frame < samplesPerChannel; ++frame) {
+        int64_t firstInputFrame = m_inputPosition - leadingFramesCount;
+
+        if (!fillHistory(firstInputFrame + static_cast<int64_t>(m_tapsCount))) {
+            break;
+        }
+
+        if (m_inputEnded && m_inputPosition >= m_inputFramesCount) {
+            break;
+        }
+
+        const float* coefficients = phaseCoefficients();
+        size_t historyOffset = static_cast<size_t>(firstInputFrame - m_historyStart);
+        float* out = buffer + frame * m_channelsCount;
+
+        for (unsigned int ch = 0; ch < m_channelsCount; ++ch) {
+            out[ch] = kernels.dotProduct(m_history[ch].data() + historyOffset, coefficients, m_tapsCount);
+        }
+
+        m_phase += m_M;
+        m_inputPosition += m_phase / m_L;
+        m_phase %= m_L;
     }
+
+    return frame;
 }
 
-double SampleRateConvertor::sinc(double value) const
+std::vector<float> SampleRateConvertor::convert(const std::vector<float>& data, unsigned int channelsCount, unsigned int sampleRateIn,
+                                                unsigned int sampleRateOut, Quality quality)
 {
-    if (value == 0) {
-        return 1.f;
+    if (channelsCount == 0) {
+        return {};
     }
-    double sincArg = M_PI * value * m_sampleRateIn;
-    double gain = std::min(1.0, m_sampleRateOut / static_cast<double>(m_sampleRateIn));
-    return gain * std::sin(sincArg) / sincArg;
+
+    const samples_t inputFramesCount = data.size() / channelsCount;
+    samples_t readPosition = 0;
+
+    auto reader = [&data, channelsCount, inputFramesCount, &readPosition](float* buffer, samples_t samplesPerChannel) {
+        samples_t framesCount = std::min(samplesPerChannel, inputFramesCount - readPosition);
+        std::copy_n(data.begin() + readPosition * channelsCount, framesCount * channelsCount, buffer);
+        readPosition += framesCount;
+
+        return framesCount;
+    };
+
+    SampleRateConvertor convertor(channelsCount, sampleRateIn, sampleRateOut, reader, quality);
+
+    std::vector<float> result(convertor.outputFramesCount(inputFramesCount) * channelsCount);
+    samples_t framesCount = convertor.process(result.data(), result.size() / channelsCount);
+    result.resize(framesCount * channelsCount);
+
+    return result;
 }
@@ -22,57 +22,84 @@
 #ifndef MU_AUDIO_SAMPLERATECONVERTOR_H
 #define MU_AUDIO_SAMPLERATECONVERTOR_H
 
+#include <functional>
 #include <vector>
-#include <deque>
+
+#include "audiotypes.h"
+
 namespace mu::audio {
+//! NOTE Streaming polyphase resampler (Kaiser windowed sinc).
+//! The coefficients of every phase are computed once, when the rates or the quality change.
+//! The input is pulled block by block from the reader, so the whole input is never needed
 class SampleRateConvertor
 {
 public:
-    enum Method {
-        SINC, FIR
+    enum class Quality {
+        Low = 0,
+        Medium,
+        High
     };
-    explicit SampleRateConvertor(const std::vector<float>& data, unsigned int channelsCount, unsigned int sampleRateIn,
-                                 unsigned int sampleRateOut);
 
-    //! offline convert full data set
-    std::vector<float> convert();
+    //! NOTE Same as IAudioSource::process: fills the buffer with interleaved input frames,
+    //! returns the number of frames. Returning 0 means the end of the input
+    using Reader = std::function<samples_t (float* buffer, samples_t samplesPerChannel)>;
 
-    //! online convert
-    unsigned int convert(float* buffer, unsigned int from, unsigned int count);
+    SampleRateConvertor(unsigned int channelsCount, unsigned int sampleRateIn, unsigned int sampleRateOut,
+                        Reader reader = nullptr, Quality quality = Quality::Medium);
 
+    void setReader(Reader reader);
     void setChannelCount(unsigned int count);
     void setSampleRateIn(unsigned int sampleRate);
     void setSampleRateOut(unsigned int sampleRate);
+    void setQuality(Quality quality);
 
-private:
+    //! NOTE Drops the history, the next processed frame corresponds to the next frame of the reader
+    void reset();
 
-    //! return value of sinc function (LPF) with consideration of used sampleRates
-    double sinc(double value) const;
+    //! NOTE Fills the buffer with interleaved output frames, returns the number of frames.
+    //! It is less than samplesPerChannel only at the end of the input
+    samples_t process(float* buffer, samples_t samplesPerChannel);
 
-    //! output sample value
-    float y(unsigned int sample, unsigned int channel) const;
-    float ySinc(unsigned int sample, unsigned int channel) const;
-    float yFIR(unsigned int sample, unsigned int channel) const;
+    //! NOTE Number of output frames for the given number of input frames
+    samples_t outputFramesCount(samples_t inputFramesCount) const;
+
+    //! NOTE Offline conversion of the whole interleaved data
+    static std::vector<float> convert(const std::vector<float>& data, unsigned int channelsCount, unsigned int sampleRateIn,
+                                      unsigned int sampleRateOut, Quality quality = Quality::Medium);
+
+private:
+    void initFilter();
+    bool fillHistory(int64_t untilInputFrame);
+    const float* phaseCoefficients();
 
-    //! return true if there are samples in input buffer for conversion
-    bool availableSamples(unsigned int sample) const;
+    unsigned int m_channelsCount = 0;
+    unsigned int m_sampleRateIn = 0;
+    unsigned int m_sampleRateOut = 0;
+    Quality m_quality = Quality::Medium;
+    Reader m_reader = nullptr;
 
-    //! calculate window function values
-    void initWindow();
+    //! NOTE The output rate is L/M of the input one. The position of the next output frame
+    //! is m_inputPosition + m_phase / L (in input frames)
+    unsigned int m_L = 1;
+    unsigned int m_M = 1;
+    int64_t m_inputPosition = 0;
+    unsigned int m_phase = 0;
 
-    const static unsigned int USE_SAMPLES = 16; //!< this value defines the quality and complexity of SRC.
-    const std::vector<float>& m_data;
+    //! NOTE m_phasesCount + 1 rows of m_tapsCount coefficients, if L is too big
+    //! the coefficients are interpolated between the neighbouring rows
+    size_t m_tapsCount = 0;
+    size_t m_phasesCount = 0;
+    std::vector<float> m_coefficients;
+    std::vector<float> m_interpolatedCoefficients;
 
-    //! values of window function for USE_SAMPLES
-    const static unsigned int FIR_LENGTH = 33;
-    unsigned int m_M = 1, m_L = 1;
-    std::vector<float> m_fir;
-    mutable std::deque<float> m_y;
+    //! NOTE Planar input history, the first frame is the input frame m_historyStart
+    std::vector<std::vector<float> > m_history;
+    int64_t m_historyStart = 0;
+    size_t m_historyFramesCount = 0;
 
-    unsigned int m_channelsCount;
-    unsigned int m_sampleRateIn;
-    unsigned int m_sampleRateOut;
-    Method m_method = FIR;
+    std::vector<float> m_readBuffer;
+    int64_t m_inputFramesCount = 0;
+    bool m_inputEnded = false;
 };
 }
 
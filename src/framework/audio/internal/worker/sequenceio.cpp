@@ -144,7 +144,7 @@ Channel<TrackId, AudioOutputParams> SequenceIO::outputParamsChanged() const
     return m_outputParamsChanged;
 }
 
-Channel<audioch_t, AudioSignalVal> SequenceIO::audioSignalChanges(const TrackId id) const
+AudioSignalsSnapshotPtr SequenceIO::audioSignalsSnapshot(const TrackId id) const
 {
     ONLY_AUDIO_WORKER_THREAD;
 
@@ -154,8 +154,8 @@ Channel<audioch_t, AudioSignalVal> SequenceIO::audioSignalChanges(const TrackId
 
     TrackPtr track = m_getTracks->track(id);
     IF_ASSERT_FAILED(track) {
-        return Channel<audioch_t, AudioSignalVal>();
+        return nullptr;
     }
 
-    return track->outputHandler->audioSignalChanges();
+    return track->outputHandler->audioSignalsSnapshot();
 }
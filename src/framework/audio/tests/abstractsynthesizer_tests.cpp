@@ -0,0 +1,262 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "audio/abstractsynthesizer.h"
+#include "audio/internal/audiosanitizer.h"
+
+using namespace mu;
+using namespace mu::audio;
+using namespace mu::audio::synth;
+
+class TestSynthesizer : public AbstractSynthesizer
+{
+public:
+    struct HandledEvent {
+        samples_t frame = 0;
+        bool noteOn = false;
+        mpe::pitch_level_t pitchLevel = 0;
+    };
+
+    TestSynthesizer()
+        : AbstractSynthesizer(AudioInputParams()) {}
+
+    std::string name() const override { return "test"; }
+    AudioSourceType type() const override { return AudioSourceType::Undefined; }
+    void setupSound(const mpe::PlaybackSetupData&) override {}
+    void flushSound() override {}
+    bool isValid() const override { return true; }
+
+    void setSampleRate(unsigned int sampleRate) override { m_sampleRate = sampleRate; }
+    unsigned int audioChannelsCount() const override { return 2; }
+    async::Channel<unsigned int> audioChannelsCountChanged() const override { return async::Channel<unsigned int>(); }
+
+    samples_t process(float*, samples_t samplesPerChannel) override
+    {
+        samples_t offset = 0;
+
+        while (offset < samplesPerChannel) {
+            samples_t framesCount = handleMainStreamEvents(samplesPerChannel - offset);
+            m_subBlocks.push_back(framesCount);
+            offset += framesCount;
+        }
+
+        return samplesPerChannel;
+    }
+
+    using AbstractSynthesizer::loadMainStreamEvents;
+    using AbstractSynthesizer::nextEventsFrameOffset;
+    using AbstractSynthesizer::msecsToFrames;
+    using AbstractSynthesizer::framesToMsecs;
+    using AbstractSynthesizer::advancePlaybackPosition;
+
+    const std::vector<HandledEvent>& handledEvents() const { return m_handledEvents; }
+    const std::vector<samples_t>& subBlocks() const { return m_subBlocks; }
+
+protected:
+    bool handleNoteOnEvents(const mpe::PlaybackEvent& event, const msecs_t from, const msecs_t to) override
+    {
+        const mpe::NoteEvent& noteEvent = std::get<mpe::NoteEvent>(event);
+        msecs_t timestamp = noteEvent.arrangementCtx().actualTimestamp;
+
+        if (timestamp < from || timestamp >= to) {
+            return false;
+        }
+
+        m_handledEvents.push_back({ m_playbackPositionFrames, true, noteEvent.pitchCtx().nominalPitchLevel });
+        return true;
+    }
+
+    bool handleNoteOffEvents(const mpe::PlaybackEvent& event, const msecs_t from, const msecs_t to) override
+    {
+        const mpe::NoteEvent& noteEvent = std::get<mpe::NoteEvent>(event);
+        msecs_t timestamp = noteEvent.arrangementCtx().actualTimestamp + noteEvent.arrangementCtx().actualDuration;
+
+        if (timestamp < from || timestamp >= to) {
+            return false;
+        }
+
+        m_handledEvents.push_back({ m_playbackPositionFrames, false, noteEvent.pitchCtx().nominalPitchLevel });
+        return true;
+    }
+
+private:
+    std::vector<HandledEvent> m_handledEvents;
+    std::vector<samples_t> m_subBlocks;
+};
+
+class Audio_AbstractSynthesizerTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+    }
+
+    static mpe::PlaybackEvent noteEvent(const msecs_t timestamp, const msecs_t duration, const mpe::pitch_level_t pitchLevel)
+    {
+        mpe::ArrangementContext arrangementCtx;
+        arrangementCtx.nominalTimestamp = timestamp;
+        arrangementCtx.actualTimestamp = timestamp;
+        arrangementCtx.nominalDuration = duration;
+        arrangementCtx.actualDuration = duration;
+
+        mpe::PitchContext pitchCtx;
+        pitchCtx.nominalPitchLevel = pitchLevel;
+
+        return mpe::NoteEvent(std::move(arrangementCtx), std::move(pitchCtx), mpe::ExpressionContext());
+    }
+
+    static mpe::PlaybackEventsMap eventsMap(const std::vector<mpe::PlaybackEvent>& events)
+    {
+        mpe::PlaybackEventsMap result;
+
+        for (const mpe::PlaybackEvent& event : events) {
+            result[std::get<mpe::NoteEvent>(event).arrangementCtx().actualTimestamp].push_back(event);
+        }
+
+        return result;
+    }
+};
+
+TEST_F(Audio_AbstractSynthesizerTests, MsecsFramesRoundTrip)
+{
+    for (unsigned int sampleRate : { 44100u, 48000u, 96000u }) {
+        //! [GIVEN] A synthesizer with the sample rate
+        TestSynthesizer synth;
+        synth.setSampleRate(sampleRate);
+
+        //! [THEN] Every millisecond converted to frames and back is the same millisecond
+        for (msecs_t msecs = 0; msecs < 2000; ++msecs) {
+            EXPECT_EQ(synth.framesToMsecs(synth.msecsToFrames(msecs)), msecs);
+        }
+
+        //! [THEN] The frame of the millisecond is the first frame in it
+        for (msecs_t msecs = 1; msecs < 2000; ++msecs) {
+            EXPECT_EQ(synth.framesToMsecs(synth.msecsToFrames(msecs) - 1), msecs - 1);
+        }
+    }
+}
+
+TEST_F(Audio_AbstractSynthesizerTests, PlaybackPositionDoesNotDrift)
+{
+    for (samples_t blockSize : { 64u, 512u, 1024u }) {
+        //! [GIVEN] A synthesizer at 44.1 kHz, the block duration isn't a whole number of milliseconds
+        TestSynthesizer synth;
+        synth.setSampleRate(44100);
+
+        //! [WHEN] Process a minute of blocks
+        samples_t blocksCount = 60 * 44100 / blockSize;
+        for (samples_t block = 1; block <= blocksCount; ++block) {
+            synth.process(nullptr, blockSize);
+
+            //! [THEN] The position at every block boundary is the one of its first frame
+            ASSERT_EQ(synth.playbackPosition(), static_cast<msecs_t>(block * blockSize * 1000 / 44100));
+        }
+
+        //! [WHEN] Set the position and process a block
+        synth.setPlaybackPosition(1000);
+        synth.process(nullptr, blockSize);
+
+        //! [THEN] The position is advanced by the duration of the block
+        EXPECT_EQ(synth.playbackPosition(), static_cast<msecs_t>((44100 + blockSize) * 1000 / 44100));
+    }
+}
+
+TEST_F(Audio_AbstractSynthesizerTests, NextEventsFrameOffset)
+{
+    //! [GIVEN] A synthesizer at 48 kHz (48 frames per millisecond) with notes at 10 and 20 ms
+    TestSynthesizer synth;
+    synth.setSampleRate(48000);
+    synth.loadMainStreamEvents(eventsMap({ noteEvent(10, 5, 1), noteEvent(20, 100, 2) }));
+
+    //! [THEN] The offset from the beginning is the frame of the first note
+    EXPECT_EQ(synth.nextEventsFrameOffset(0, 1024), 480u);
+
+    //! [THEN] It is limited by the block size
+    EXPECT_EQ(synth.nextEventsFrameOffset(0, 256), 256u);
+
+    //! [WHEN] The position is the frame of the first note
+    synth.advancePlaybackPosition(480);
+
+    //! [THEN] The next offset is the end of the first note, which is turned on in this block
+    EXPECT_EQ(synth.nextEventsFrameOffset(10, 1024), 240u);
+
+    //! [WHEN] The position is the end of the first note
+    synth.advancePlaybackPosition(240);
+
+    //! [THEN] The next offset is the frame of the second note
+    EXPECT_EQ(synth.nextEventsFrameOffset(15, 1024), 240u);
+
+    //! [WHEN] The position is after all of the notes start
+    synth.advancePlaybackPosition(240);
+
+    //! [THEN] The next offset is the block size
+    EXPECT_EQ(synth.nextEventsFrameOffset(20, 1024), 1024u);
+}
+
+TEST_F(Audio_AbstractSynthesizerTests, NextEventsFrameOffset_PlayingEvents)
+{
+    //! [GIVEN] A synthesizer at 48 kHz with a playing note which ends at 15 ms
+    TestSynthesizer synth;
+    synth.setSampleRate(48000);
+    synth.loadMainStreamEvents(eventsMap({ noteEvent(10, 5, 1), noteEvent(30, 10, 2) }));
+    synth.process(nullptr, 600);
+
+    ASSERT_EQ(synth.handledEvents().size(), 1u);
+
+    //! [THEN] The next offset is the end of the playing note, not the start of the next one
+    EXPECT_EQ(synth.nextEventsFrameOffset(synth.playbackPosition(), 1024), 720u - 600u);
+}
+
+TEST_F(Audio_AbstractSynthesizerTests, NoteOffBeforeNoteOnAtSameFrame)
+{
+    //! [GIVEN] A synthesizer at 48 kHz with a repeated note, the second one starts when the first one ends
+    TestSynthesizer synth;
+    synth.setSampleRate(48000);
+    synth.loadMainStreamEvents(eventsMap({ noteEvent(0, 10, 1), noteEvent(10, 10, 1) }));
+
+    //! [WHEN] Process a block which contains both of the notes
+    synth.process(nullptr, 1024);
+
+    //! [THEN] The block is split at the frames of the events
+    std::vector<samples_t> expectedSubBlocks = { 480, 480, 64 };
+    EXPECT_EQ(synth.subBlocks(), expectedSubBlocks);
+
+    //! [THEN] Every event is handled at its frame, the first note is turned off before the second one is turned on
+    const std::vector<TestSynthesizer::HandledEvent>& events = synth.handledEvents();
+    ASSERT_EQ(events.size(), 4u);
+
+    EXPECT_TRUE(events[0].noteOn);
+    EXPECT_EQ(events[0].frame, 0u);
+
+    EXPECT_FALSE(events[1].noteOn);
+    EXPECT_EQ(events[1].frame, 480u);
+
+    EXPECT_TRUE(events[2].noteOn);
+    EXPECT_EQ(events[2].frame, 480u);
+
+    EXPECT_FALSE(events[3].noteOn);
+    EXPECT_EQ(events[3].frame, 960u);
+}
@@ -0,0 +1,223 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "audio/internal/dsp/audiokernels.h"
+
+using namespace mu::audio::dsp;
+
+static const std::vector<KernelsInstructionSet> SIMD_INSTRUCTION_SETS = {
+    KernelsInstructionSet::SSE2,
+    KernelsInstructionSet::AVX2,
+    KernelsInstructionSet::NEON
+};
+
+static const char* instructionSetName(KernelsInstructionSet instructionSet)
+{
+    switch (instructionSet) {
+    case KernelsInstructionSet::Scalar: return "Scalar";
+    case KernelsInstructionSet::SSE2: return "SSE2";
+    case KernelsInstructionSet::AVX2: return "AVX2";
+    case KernelsInstructionSet::NEON: return "NEON";
+    }
+
+    return "";
+}
+
+class Audio_KernelsTests : public ::testing::Test
+{
+public:
+    static std::vector<float> randomSamples(size_t count)
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+        std::vector<float> samples(count);
+        for (float& s : samples) {
+            s = distribution(generator);
+        }
+
+        return samples;
+    }
+
+    const AudioKernels* scalar() const
+    {
+        return audioKernels(KernelsInstructionSet::Scalar);
+    }
+};
+
+TEST_F(Audio_KernelsTests, SupportedInstructionSet)
+{
+    //! [GIVEN] The instruction set chosen for this CPU
+
+    //! [THEN] It is supported
+    EXPECT_NE(audioKernels(audioKernelsInstructionSet()), nullptr);
+    EXPECT_NE(scalar(), nullptr);
+}
+
+TEST_F(Audio_KernelsTests, ApplyGainAndMeasure)
+{
+    const std::vector<size_t> channelsCounts = { 1, 2, 3, 4 };
+    const std::vector<size_t> samplesPerChannelCounts = { 0, 1, 3, 7, 64, 513, 1024 };
+    const float gains[] = { 0.5f, 1.25f, 0.75f, 2.f };
+
+    for (KernelsInstructionSet instructionSet : SIMD_INSTRUCTION_SETS) {
+        const AudioKernels* kernels = audioKernels(instructionSet);
+        if (!kernels) {
+            continue;
+        }
+
+        for (size_t channels : channelsCounts) {
+            for (size_t samplesPerChannel : samplesPerChannelCounts) {
+                SCOPED_TRACE(std::string(instructionSetName(instructionSet))
+                             + ", channels: " + std::to_string(channels)
+                             + ", samples: " + std::to_string(samplesPerChannel));
+
+                //! [GIVEN] The same interleaved buffer
+                std::vector<float> expectedBuffer = randomSamples(channels * samplesPerChannel);
+                std::vector<float> buffer = expectedBuffer;
+
+                float expectedSquaredSums[4] = {};
+                float expectedPeaks[4] = {};
+                float squaredSums[4] = {};
+                float peaks[4] = {};
+
+                //! [WHEN] Apply the gains by the scalar and the SIMD kernels
+                scalar()->applyGainAndMeasure(expectedBuffer.data(), channels, samplesPerChannel, gains,
+                                              expectedSquaredSums, expectedPeaks);
+                kernels->applyGainAndMeasure(buffer.data(), channels, samplesPerChannel, gains, squaredSums, peaks);
+
+                //! [THEN] The samples and the peaks are exactly the same
+                EXPECT_EQ(buffer, expectedBuffer);
+
+                for (size_t c = 0; c < channels; ++c) {
+                    EXPECT_EQ(peaks[c], expectedPeaks[c]);
+
+                    //! [THEN] The sums differ only by the order of additions
+                    EXPECT_NEAR(squaredSums[c], expectedSquaredSums[c], expectedSquaredSums[c] * 1e-5f);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(Audio_KernelsTests, MixAccumulateAndMultiply)
+{
+    const std::vector<size_t> samplesCounts = { 0, 1, 5, 16, 1023 };
+
+    for (KernelsInstructionSet instructionSet : SIMD_INSTRUCTION_SETS) {
+        const AudioKernels* kernels = audioKernels(instructionSet);
+        if (!kernels) {
+            continue;
+        }
+
+        for (size_t count : samplesCounts) {
+            SCOPED_TRACE(std::string(instructionSetName(instructionSet)) + ", samples: " + std::to_string(count));
+
+            //! [GIVEN] Two buffers
+            std::vector<float> src = randomSamples(count);
+            std::vector<float> expected(count, 0.25f);
+            std::vector<float> dst = expected;
+
+            //! [WHEN] Mix and multiply them by the scalar and the SIMD kernels
+            scalar()->mixAccumulate(expected.data(), src.data(), count);
+            scalar()->multiply(expected.data(), count, 0.8f);
+
+            kernels->mixAccumulate(dst.data(), src.data(), count);
+            kernels->multiply(dst.data(), count, 0.8f);
+
+            //! [THEN] The results are exactly the same
+            EXPECT_EQ(dst, expected);
+        }
+    }
+}
+
+TEST_F(Audio_KernelsTests, DotProduct)
+{
+    const std::vector<size_t> samplesCounts = { 0, 1, 5, 16, 33, 1023 };
+
+    for (KernelsInstructionSet instructionSet : SIMD_INSTRUCTION_SETS) {
+        const AudioKernels* kernels = audioKernels(instructionSet);
+        if (!kernels) {
+            continue;
+        }
+
+        for (size_t count : samplesCounts) {
+            SCOPED_TRACE(std::string(instructionSetName(instructionSet)) + ", samples: " + std::to_string(count));
+
+            //! [GIVEN] Two buffers
+            std::vector<float> a = randomSamples(count);
+            std::vector<float> b = randomSamples(count * 2);
+
+            //! [WHEN] Compute their dot product by the scalar and the SIMD kernels
+            float expected = scalar()->dotProduct(a.data(), b.data() + count, count);
+            float result = kernels->dotProduct(a.data(), b.data() + count, count);
+
+            //! [THEN] The results differ only by the order of additions
+            EXPECT_NEAR(result, expected, 1e-4f);
+        }
+    }
+}
+
+//! NOTE Microbenchmark, run with --gtest_also_run_disabled_tests
+TEST_F(Audio_KernelsTests, DISABLED_Benchmark)
+{
+    constexpr size_t CHANNELS = 2;
+    constexpr size_t SAMPLES_PER_CHANNEL = 512;
+    constexpr int ITERATIONS = 200000;
+
+    const float gains[CHANNELS] = { 0.9f, 1.1f };
+
+    std::vector<KernelsInstructionSet> instructionSets = SIMD_INSTRUCTION_SETS;
+    instructionSets.insert(instructionSets.begin(), KernelsInstructionSet::Scalar);
+
+    for (KernelsInstructionSet instructionSet : instructionSets) {
+        const AudioKernels* kernels = audioKernels(instructionSet);
+        if (!kernels) {
+            continue;
+        }
+
+        std::vector<float> buffer = randomSamples(CHANNELS * SAMPLES_PER_CHANNEL);
+        std::vector<float> src = randomSamples(CHANNELS * SAMPLES_PER_CHANNEL);
+        float squaredSums[CHANNELS] = {};
+        float peaks[CHANNELS] = {};
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < ITERATIONS; ++i) {
+            kernels->mixAccumulate(buffer.data(), src.data(), buffer.size());
+            kernels->applyGainAndMeasure(buffer.data(), CHANNELS, SAMPLES_PER_CHANNEL, gains, squaredSums, peaks);
+            kernels->multiply(buffer.data(), buffer.size(), 0.5f);
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << instructionSetName(instructionSet) << ": "
+                  << elapsed.count() / ITERATIONS << " ns per block of "
+                  << SAMPLES_PER_CHANNEL << " stereo samples (peak " << peaks[0] << ")" << std::endl;
+    }
+}
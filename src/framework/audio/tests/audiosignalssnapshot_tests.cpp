@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+
+#include "audio/audiotypes.h"
+
+using namespace mu::audio;
+
+class Audio_AudioSignalsSnapshotTests : public ::testing::Test
+{
+};
+
+TEST_F(Audio_AudioSignalsSnapshotTests, PublishAndRead)
+{
+    //! [GIVEN] An empty snapshot
+    AudioSignalsSnapshot snapshot;
+    EXPECT_EQ(snapshot.audioChannelsCount(), 0);
+
+    //! [WHEN] Publish the values of a stereo output
+    snapshot.update(0, 0.25f, 0.5f, -12.f);
+    snapshot.update(1, 0.75f, 1.f, -3.f);
+
+    //! [THEN] The values are read back per channel
+    AudioSignalVal left = snapshot.value(0);
+    EXPECT_FLOAT_EQ(left.amplitude, 0.25f);
+    EXPECT_FLOAT_EQ(left.peak, 0.5f);
+    EXPECT_FLOAT_EQ(left.pressure, -12.f);
+
+    AudioSignalVal right = snapshot.value(1);
+    EXPECT_FLOAT_EQ(right.amplitude, 0.75f);
+    EXPECT_FLOAT_EQ(right.peak, 1.f);
+    EXPECT_FLOAT_EQ(right.pressure, -3.f);
+
+    //! [THEN] The channels count is known
+    EXPECT_EQ(snapshot.audioChannelsCount(), 2);
+
+    //! [WHEN] Publish new values
+    snapshot.update(0, 0.f, 0.f, -40.f);
+
+    //! [THEN] Only the latest ones are read
+    EXPECT_FLOAT_EQ(snapshot.value(0).pressure, -40.f);
+    EXPECT_FLOAT_EQ(snapshot.value(1).pressure, -3.f);
+    EXPECT_EQ(snapshot.audioChannelsCount(), 2);
+}
+
+TEST_F(Audio_AudioSignalsSnapshotTests, MonoOutput)
+{
+    //! [GIVEN] A mono output
+    AudioSignalsSnapshot snapshot;
+
+    //! [WHEN] Publish its values
+    snapshot.update(0, 0.5f, 0.5f, -6.f);
+
+    //! [THEN] There is only one channel
+    EXPECT_EQ(snapshot.audioChannelsCount(), 1);
+    EXPECT_FLOAT_EQ(snapshot.value(0).pressure, -6.f);
+}
+
+TEST_F(Audio_AudioSignalsSnapshotTests, PressureIsLimited)
+{
+    //! [GIVEN] An empty snapshot
+    AudioSignalsSnapshot snapshot;
+
+    //! [THEN] The pressure of channels which are not published yet is the minimal one, not zero
+    EXPECT_LT(snapshot.value(0).pressure, -60.f);
+
+    //! [WHEN] Publish the pressure of silence
+    snapshot.update(0, 0.f, 0.f, -std::numeric_limits<float>::infinity());
+
+    //! [THEN] It is limited to the minimal one
+    EXPECT_FLOAT_EQ(snapshot.value(0).pressure, AudioSignalsSnapshot().value(0).pressure);
+}
+
+TEST_F(Audio_AudioSignalsSnapshotTests, OutOfRangeChannel)
+{
+    //! [GIVEN] An empty snapshot
+    AudioSignalsSnapshot snapshot;
+
+    //! [WHEN] Publish the values of a channel which is not supported
+    snapshot.update(AudioSignalsSnapshot::MAX_CHANNELS, 1.f, 1.f, 0.f);
+
+    //! [THEN] They are ignored
+    EXPECT_EQ(snapshot.audioChannelsCount(), 0);
+
+    AudioSignalVal value = snapshot.value(AudioSignalsSnapshot::MAX_CHANNELS);
+    EXPECT_FLOAT_EQ(value.amplitude, 0.f);
+    EXPECT_FLOAT_EQ(value.peak, 0.f);
+}
+
+TEST_F(Audio_AudioSignalsSnapshotTests, NoTornReads)
+{
+    //! [GIVEN] A snapshot, the writer publishes the values which are consistent with each other
+    AudioSignalsSnapshot snapshot;
+    std::atomic<bool> finished = false;
+
+    std::thread writer([&snapshot, &finished]() {
+        for (int i = 1; i <= 100000; ++i) {
+            float v = static_cast<float>(i);
+            snapshot.update(0, v, v * 2.f, -v);
+        }
+
+        finished = true;
+    });
+
+    //! [WHEN] Read the values while they are published
+    //! [THEN] Every read is a whole published set of values
+    while (!finished) {
+        AudioSignalVal value = snapshot.value(0);
+        if (value.amplitude == 0.f) {
+            continue;
+        }
+
+        ASSERT_FLOAT_EQ(value.peak, value.amplitude * 2.f);
+        ASSERT_FLOAT_EQ(value.pressure, std::max(-value.amplitude, -100.f));
+    }
+
+    writer.join();
+
+    //! [THEN] The last published values are read
+    EXPECT_FLOAT_EQ(snapshot.value(0).amplitude, 100000.f);
+}
@@ -0,0 +1,159 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "audio/internal/worker/mixer.h"
+#include "audio/internal/worker/abstractaudiosource.h"
+#include "audio/internal/audiosanitizer.h"
+
+using namespace mu::audio;
+
+static constexpr unsigned int SAMPLE_RATE = 48000;
+static constexpr audioch_t CHANNELS = 2;
+static constexpr samples_t BLOCK_SIZE = 512;
+
+//! NOTE Stereo sine, its amplitude changes slowly, so that the compressors and the limiter are engaged from time to time
+class SineSource : public AbstractAudioSource
+{
+public:
+    explicit SineSource(double freq)
+        : m_freq(freq) {}
+
+    unsigned int audioChannelsCount() const override
+    {
+        return CHANNELS;
+    }
+
+    samples_t process(float* buffer, samples_t samplesPerChannel) override
+    {
+        for (samples_t frame = 0; frame < samplesPerChannel; ++frame, ++m_frame) {
+            double t = static_cast<double>(m_frame) / m_sampleRate;
+            double amplitude = 0.5 + 0.45 * std::sin(2 * M_PI * 0.5 * t);
+            float sample = static_cast<float>(amplitude * std::sin(2 * M_PI * m_freq * t));
+
+            buffer[frame * CHANNELS] = sample;
+            buffer[frame * CHANNELS + 1] = -sample;
+        }
+
+        return samplesPerChannel;
+    }
+
+private:
+    double m_freq = 0;
+    samples_t m_frame = 0;
+};
+
+//! NOTE Constant signal with any number of interleaved audio channels
+class ConstantSource : public AbstractAudioSource
+{
+public:
+    ConstantSource(audioch_t channelsCount, float value)
+        : m_channelsCount(channelsCount), m_value(value) {}
+
+    unsigned int audioChannelsCount() const override
+    {
+        return m_channelsCount;
+    }
+
+    samples_t process(float* buffer, samples_t samplesPerChannel) override
+    {
+        std::fill(buffer, buffer + samplesPerChannel * m_channelsCount, m_value);
+
+        return samplesPerChannel;
+    }
+
+private:
+    audioch_t m_channelsCount = 0;
+    float m_value = 0.f;
+};
+
+class Audio_MixerTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+    }
+
+    static std::vector<float> render(bool offlineMode, size_t tracksCount, size_t blocksCount)
+    {
+        MixerPtr mixer = std::make_shared<Mixer>();
+        mixer->setSampleRate(SAMPLE_RATE);
+        mixer->setAudioChannelsCount(CHANNELS);
+        mixer->setIsOfflineMode(offlineMode);
+
+        for (size_t i = 0; i < tracksCount; ++i) {
+            IAudioSourcePtr source = std::make_shared<SineSource>(110.0 * (i + 1));
+            mixer->addChannel(static_cast<TrackId>(i), source);
+        }
+
+        std::vector<float> result(blocksCount * BLOCK_SIZE * CHANNELS, 0.f);
+
+        for (size_t block = 0; block < blocksCount; ++block) {
+            mixer->process(result.data() + block * BLOCK_SIZE * CHANNELS, BLOCK_SIZE);
+        }
+
+        return result;
+    }
+};
+
+TEST_F(Audio_MixerTests, OfflineRenderingIsIdenticalToRealTime)
+{
+    for (size_t tracksCount : { 1, 2, 7 }) {
+        //! [GIVEN] A few seconds of several tracks rendered serially (real-time mode)
+        std::vector<float> serial = render(false, tracksCount, 500);
+
+        //! [WHEN] Render them with the channels processed concurrently (offline mode)
+        std::vector<float> concurrent = render(true, tracksCount, 500);
+
+        //! [THEN] The result is the same to the last bit
+        ASSERT_EQ(concurrent.size(), serial.size());
+        EXPECT_TRUE(std::equal(serial.begin(), serial.end(), concurrent.begin())) << "tracks count: " << tracksCount;
+
+        //! [THEN] There is something rendered
+        EXPECT_TRUE(std::any_of(serial.begin(), serial.end(), [](float sample) { return sample != 0.f; }));
+    }
+}
+
+TEST_F(Audio_MixerTests, GainIsAppliedToMoreChannelsThanTheKernelsSupport)
+{
+    //! [GIVEN] A mixer with more audio channels than the snapshot and the kernels can hold
+    const audioch_t channelsCount = AudioSignalsSnapshot::MAX_CHANNELS + 2;
+
+    MixerPtr mixer = std::make_shared<Mixer>();
+    mixer->setSampleRate(SAMPLE_RATE);
+    mixer->setAudioChannelsCount(channelsCount);
+    mixer->addChannel(0, std::make_shared<ConstantSource>(channelsCount, 0.2f));
+
+    //! [WHEN] Render a block
+    std::vector<float> result(BLOCK_SIZE * channelsCount, 0.f);
+    mixer->process(result.data(), BLOCK_SIZE);
+
+    //! [THEN] Both the channel and the master gain (0.5 each at the centre balance) are applied to every channel
+    for (size_t i = 0; i < result.size(); ++i) {
+        ASSERT_FLOAT_EQ(result[i], 0.05f) << "sample: " << i;
+    }
+}
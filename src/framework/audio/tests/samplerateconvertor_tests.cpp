@@ -0,0 +1,214 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "audio/internal/worker/samplerateconvertor.h"
+
+using namespace mu::audio;
+
+struct SampleRates {
+    unsigned int in = 0;
+    unsigned int out = 0;
+};
+
+static const std::vector<SampleRates> SAMPLE_RATES = {
+    { 44100, 48000 },
+    { 48000, 44100 },
+    { 48000, 96000 },
+    { 96000, 48000 },
+    { 44100, 96000 },
+    { 96000, 44100 },
+    { 44100, 44101 }
+};
+
+static constexpr unsigned int CHANNELS = 2;
+
+class Audio_SampleRateConvertorTests : public ::testing::Test
+{
+public:
+    //! NOTE Interleaved stereo sine, the frequency of the second channel is freq2
+    static std::vector<float> sine(unsigned int sampleRate, size_t framesCount, double freq1, double freq2)
+    {
+        std::vector<float> samples(framesCount * CHANNELS);
+
+        for (size_t frame = 0; frame < framesCount; ++frame) {
+            samples[frame * CHANNELS] = 0.5f * static_cast<float>(std::sin(2 * M_PI * freq1 * frame / sampleRate));
+            samples[frame * CHANNELS + 1] = 0.5f * static_cast<float>(std::sin(2 * M_PI * freq2 * frame / sampleRate));
+        }
+
+        return samples;
+    }
+
+    //! NOTE Signal to noise ratio (dB) of the channel, compared with the ideal sine, skipping the edges
+    static double snr(const std::vector<float>& samples, unsigned int channel, unsigned int sampleRate, double freq)
+    {
+        const size_t framesCount = samples.size() / CHANNELS;
+        const size_t skippedFramesCount = 500;
+
+        double signal = 0.0;
+        double noise = 0.0;
+
+        for (size_t frame = skippedFramesCount; frame + skippedFramesCount < framesCount; ++frame) {
+            double expected = 0.5 * std::sin(2 * M_PI * freq * frame / sampleRate);
+            double diff = samples[frame * CHANNELS + channel] - expected;
+
+            signal += expected * expected;
+            noise += diff * diff;
+        }
+
+        return 10.0 * std::log10(signal / noise);
+    }
+};
+
+TEST_F(Audio_SampleRateConvertorTests, OutputFramesCount)
+{
+    for (const SampleRates& rates : SAMPLE_RATES) {
+        SCOPED_TRACE(std::to_string(rates.in) + " -> " + std::to_string(rates.out));
+
+        //! [GIVEN] One second of audio
+        std::vector<float> input = sine(rates.in, rates.in, 440.0, 440.0);
+
+        //! [WHEN] Convert it
+        std::vector<float> output = SampleRateConvertor::convert(input, CHANNELS, rates.in, rates.out);
+
+        //! [THEN] There is one second of audio at the new rate
+        EXPECT_EQ(output.size(), rates.out * CHANNELS);
+    }
+}
+
+TEST_F(Audio_SampleRateConvertorTests, SameSampleRate)
+{
+    //! [GIVEN] Some audio
+    std::vector<float> input = sine(44100, 1000, 440.0, 10000.0);
+
+    //! [WHEN] Convert it to the same sample rate
+    std::vector<float> output = SampleRateConvertor::convert(input, CHANNELS, 44100, 44100);
+
+    //! [THEN] The audio is not changed
+    ASSERT_EQ(output.size(), input.size());
+
+    for (size_t i = 0; i < input.size(); ++i) {
+        EXPECT_NEAR(output[i], input[i], 1e-6f);
+    }
+}
+
+TEST_F(Audio_SampleRateConvertorTests, Quality)
+{
+    for (const SampleRates& rates : SAMPLE_RATES) {
+        SCOPED_TRACE(std::to_string(rates.in) + " -> " + std::to_string(rates.out));
+
+        //! [GIVEN] Sines of 1 kHz and 15 kHz
+        std::vector<float> input = sine(rates.in, rates.in, 1000.0, 15000.0);
+
+        //! [WHEN] Convert them
+        std::vector<float> output = SampleRateConvertor::convert(input, CHANNELS, rates.in, rates.out);
+
+        //! [THEN] The result is close to the ideal sines at the new rate
+        EXPECT_GT(snr(output, 0, rates.out, 1000.0), 85.0);
+        EXPECT_GT(snr(output, 1, rates.out, 15000.0), 85.0);
+    }
+}
+
+TEST_F(Audio_SampleRateConvertorTests, Streaming)
+{
+    for (const SampleRates& rates : SAMPLE_RATES) {
+        SCOPED_TRACE(std::to_string(rates.in) + " -> " + std::to_string(rates.out));
+
+        //! [GIVEN] Some noise
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+        std::vector<float> input(10000 * CHANNELS);
+        for (float& s : input) {
+            s = distribution(generator);
+        }
+
+        std::vector<float> expected = SampleRateConvertor::convert(input, CHANNELS, rates.in, rates.out);
+
+        //! [GIVEN] The reader returns blocks of different sizes
+        samples_t readPosition = 0;
+        samples_t readCallsCount = 0;
+
+        auto reader = [&](float* buffer, samples_t samplesPerChannel) {
+            samples_t framesCount = std::min<samples_t>({ samplesPerChannel, 1 + (readCallsCount++ * 37) % 300,
+                                                          input.size() / CHANNELS - readPosition });
+            std::copy_n(input.begin() + readPosition * CHANNELS, framesCount * CHANNELS, buffer);
+            readPosition += framesCount;
+
+            return framesCount;
+        };
+
+        SampleRateConvertor convertor(CHANNELS, rates.in, rates.out, reader);
+
+        //! [WHEN] Convert the noise block by block, with blocks of different sizes
+        std::vector<float> output;
+        std::vector<float> block(1024 * CHANNELS);
+        samples_t blockSize = 1;
+
+        while (true) {
+            samples_t framesCount = convertor.process(block.data(), blockSize);
+            output.insert(output.end(), block.begin(), block.begin() + framesCount * CHANNELS);
+
+            if (framesCount < blockSize) {
+                break;
+            }
+
+            blockSize = blockSize * 3 % 1021 + 1;
+        }
+
+        //! [THEN] The result is exactly the same as converted at once
+        EXPECT_EQ(output, expected);
+    }
+}
+
+//! NOTE Quality and throughput benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(Audio_SampleRateConvertorTests, DISABLED_Benchmark)
+{
+    const std::vector<std::pair<SampleRateConvertor::Quality, const char*> > qualities = {
+        { SampleRateConvertor::Quality::Low, "Low" },
+        { SampleRateConvertor::Quality::Medium, "Medium" },
+        { SampleRateConvertor::Quality::High, "High" }
+    };
+
+    constexpr unsigned int SECONDS = 10;
+
+    for (const auto& quality : qualities) {
+        for (const SampleRates& rates : SAMPLE_RATES) {
+            std::vector<float> input = sine(rates.in, rates.in * SECONDS, 1000.0, 15000.0);
+
+            auto start = std::chrono::steady_clock::now();
+            std::vector<float> output = SampleRateConvertor::convert(input, CHANNELS, rates.in, rates.out, quality.first);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            std::cout << quality.second << " " << rates.in << " -> " << rates.out
+                      << ": x" << static_cast<int>(SECONDS / elapsed.count()) << " realtime (stereo)"
+                      << ", SNR 1 kHz " << snr(output, 0, rates.out, 1000.0) << " dB"
+                      << ", SNR 15 kHz " << snr(output, 1, rates.out, 15000.0) << " dB" << std::endl;
+        }
+    }
+}
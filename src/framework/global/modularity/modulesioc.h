@@ -23,9 +23,12 @@
 #ifndef MU_MODULARITY_MODULESIOC_H
 #define MU_MODULARITY_MODULESIOC_H
 
+#include <functional>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <cassert>
 #include <iostream>
 #include "imoduleexport.h"
@@ -77,6 +80,22 @@ public:
         registerService(module, I::interfaceId(), std::static_pointer_cast<IModuleExportInterface>(p), nullptr);
     }
 
+    //! NOTE The service is created on the first resolve, then the same instance is returned.
+    //! It is for the services which are expensive to start and aren't needed in every run mode.
+    //! The creator runs once, the concurrent resolves wait for it.
+    //! A resolve of the same service from the creator itself returns nullptr
+    template<class I>
+    void registerLazyExport(const std::string& module, const std::function<std::shared_ptr<I>()>& creator)
+    {
+        if (!creator) {
+            assert(creator);
+            return;
+        }
+        registerService(module, I::interfaceId(), std::shared_ptr<IModuleExportInterface>(), nullptr, [creator]() {
+            return std::static_pointer_cast<IModuleExportInterface>(creator());
+        });
+    }
+
     template<class I>
     void unregisterExport(const std::string& /*module*/)
     {
@@ -131,10 +150,22 @@ private:
         m_map.erase(id);
     }
 
+    using LazyCreator = std::function<std::shared_ptr<IModuleExportInterface>()>;
+
+    struct LazyService {
+        LazyCreator creator;
+        std::once_flag created;
+        std::shared_ptr<IModuleExportInterface> p;
+
+        std::mutex mutex;
+        std::thread::id creatingThread;
+    };
+
     void registerService(const std::string& module,
                          const std::string& id,
                          std::shared_ptr<IModuleExportInterface> p,
-                         IModuleExportCreator* c)
+                         IModuleExportCreator* c,
+                         const LazyCreator& lazyCreator = nullptr)
     {
         auto foundIt = m_map.find(id);
         if (foundIt != m_map.end()) {
@@ -147,6 +178,10 @@ private:
         inj.sourceModule = module;
         inj.c = c;
         inj.p = p;
+        if (lazyCreator) {
+            inj.lazy = std::make_shared<LazyService>();
+            inj.lazy->creator = lazyCreator;
+        }
         m_map[id] = inj;
     }
 
@@ -167,13 +202,46 @@ private:
             return inj.c->create();
         }
 
+        if (inj.lazy) {
+            return doResolveLazy(id, inj.lazy);
+        }
+
         return nullptr;
     }
 
+    std::shared_ptr<IModuleExportInterface> doResolveLazy(const std::string& id, std::shared_ptr<LazyService> lazy)
+    {
+        //! NOTE call_once would deadlock on a resolve from the creator
+        {
+            std::lock_guard<std::mutex> lock(lazy->mutex);
+            if (lazy->creatingThread == std::this_thread::get_id()) {
+                std::cout << "recursive resolve from the creator of: " << id << std::endl;
+                return nullptr;
+            }
+        }
+
+        //! NOTE The map isn't locked while the creator runs, it may resolve other services
+        std::call_once(lazy->created, [&lazy]() {
+            {
+                std::lock_guard<std::mutex> lock(lazy->mutex);
+                lazy->creatingThread = std::this_thread::get_id();
+            }
+
+            lazy->p = lazy->creator();
+            lazy->creator = nullptr;
+
+            std::lock_guard<std::mutex> lock(lazy->mutex);
+            lazy->creatingThread = std::thread::id();
+        });
+
+        return lazy->p;
+    }
+
     struct Service {
         IModuleExportCreator* c = nullptr;
         std::string sourceModule;
         std::shared_ptr<IModuleExportInterface> p;
+        std::shared_ptr<LazyService> lazy;
     };
 
     std::map<std::string, Service > m_map;
@@ -0,0 +1,220 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "thirdparty/deto_async/async/async.h"
+#include "thirdparty/deto_async/async/internal/queuedinvoker.h"
+
+using namespace deto::async;
+
+namespace {
+//! NOTE Processes the queued messages on request or continuously
+class ReceiverThread
+{
+public:
+    ReceiverThread(bool continuous = false)
+        : m_continuous(continuous)
+    {
+        m_thread = std::thread([this]() {
+            m_id = std::this_thread::get_id();
+            m_started = true;
+
+            while (!m_stop) {
+                size_t requested = m_requested.load();
+                if (m_continuous || m_processed.load() != requested) {
+                    QueuedInvoker::instance()->processEvents();
+                    m_processed.store(requested);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        while (!m_started) {
+            std::this_thread::yield();
+        }
+    }
+
+    ~ReceiverThread()
+    {
+        stop();
+    }
+
+    std::thread::id id() const
+    {
+        return m_id;
+    }
+
+    //! NOTE Returns after all the messages queued before have been processed
+    void processEvents()
+    {
+        size_t requested = ++m_requested;
+        while (m_processed.load() < requested) {
+            std::this_thread::yield();
+        }
+    }
+
+    void stop()
+    {
+        if (m_thread.joinable()) {
+            m_stop = true;
+            m_thread.join();
+        }
+    }
+
+private:
+    std::thread m_thread;
+    std::thread::id m_id;
+    bool m_continuous = false;
+    std::atomic<bool> m_started { false };
+    std::atomic<bool> m_stop { false };
+    std::atomic<size_t> m_requested { 0 };
+    std::atomic<size_t> m_processed { 0 };
+};
+
+std::vector<int> sequence(int from, int to)
+{
+    std::vector<int> result;
+    for (int i = from; i < to; ++i) {
+        result.push_back(i);
+    }
+    return result;
+}
+}
+
+class Global_AsyncTests : public ::testing::Test
+{
+public:
+    void send(const ReceiverThread& receiver, int from, int to)
+    {
+        for (int i = from; i < to; ++i) {
+            QueuedInvoker::instance()->invoke(receiver.id(), [this, i]() { m_received.push_back(i); });
+        }
+    }
+
+protected:
+    std::vector<int> m_received; //! NOTE Written only by the receiver thread
+};
+
+TEST_F(Global_AsyncTests, Queue_FifoAcrossOverflow)
+{
+    //! GIVEN A receiver that doesn't process events yet
+    ReceiverThread receiver;
+
+    //! DO Send more messages than fit into the queue
+    send(receiver, 0, 1000);
+    receiver.processEvents();
+
+    //! CHECK All the messages, from the queue and the overflow, are received in order
+    EXPECT_EQ(m_received, sequence(0, 1000));
+}
+
+TEST_F(Global_AsyncTests, Queue_OverflowRecovery)
+{
+    //! GIVEN A queue that has overflowed and has been drained
+    ReceiverThread receiver;
+    send(receiver, 0, 300);
+    receiver.processEvents();
+    ASSERT_EQ(m_received, sequence(0, 300));
+
+    //! DO Send less messages than fit into the queue, then overflow it again
+    send(receiver, 300, 400);
+    receiver.processEvents();
+    send(receiver, 400, 1000);
+    receiver.processEvents();
+
+    //! CHECK All the messages are received in order
+    EXPECT_EQ(m_received, sequence(0, 1000));
+}
+
+TEST_F(Global_AsyncTests, Queue_ConcurrentSendAndReceive)
+{
+    //! GIVEN A receiver processing events all the time
+    ReceiverThread receiver(true);
+
+    //! DO Send a lot of messages, so that the queue overflows and recovers many times
+    send(receiver, 0, 100000);
+    receiver.processEvents();
+
+    //! CHECK All the messages are received in order
+    EXPECT_EQ(m_received, sequence(0, 100000));
+}
+
+TEST_F(Global_AsyncTests, Queue_FinishedThreadsAreRemoved)
+{
+    size_t queuesCount = QueuedInvoker::instance()->queuesCount();
+
+    //! GIVEN A receiver
+    ReceiverThread receiver;
+
+    //! DO Send messages from threads that finish
+    for (int i = 0; i < 20; ++i) {
+        std::thread sender([this, &receiver, i]() { send(receiver, i, i + 1); });
+        sender.join();
+    }
+    receiver.processEvents();
+
+    //! CHECK The messages are received and the queues of the finished senders are removed
+    EXPECT_EQ(m_received, sequence(0, 20));
+    EXPECT_EQ(QueuedInvoker::instance()->queuesCount(), queuesCount);
+
+    //! DO Send a message from this thread, then finish the receiver
+    send(receiver, 20, 21);
+    EXPECT_EQ(QueuedInvoker::instance()->queuesCount(), queuesCount + 1);
+    receiver.stop();
+
+    //! CHECK The queue to the finished receiver is removed
+    EXPECT_EQ(QueuedInvoker::instance()->queuesCount(), queuesCount);
+}
+
+TEST_F(Global_AsyncTests, Async_CallSkippedForDestroyedCaller)
+{
+    //! GIVEN A receiver and two callers
+    ReceiverThread receiver;
+    std::atomic<int> calledCount { 0 };
+
+    Asyncable caller;
+    auto destroyedCaller = std::make_unique<Asyncable>();
+
+    //! DO Queue calls from both, then destroy one of them before the calls are processed
+    Async::call(&caller, [&calledCount]() { ++calledCount; }, receiver.id());
+    Async::call(destroyedCaller.get(), [&calledCount](int n) { calledCount += n; }, 10, receiver.id());
+    destroyedCaller.reset();
+
+    receiver.processEvents();
+
+    //! CHECK Only the call of the alive caller is done
+    EXPECT_EQ(calledCount, 1);
+
+    //! DO Queue a call, then disconnect the caller
+    Async::call(&caller, [&calledCount]() { ++calledCount; }, receiver.id());
+    Async::disconnectAsync(&caller);
+    Async::call(&caller, [&calledCount]() { ++calledCount; }, receiver.id());
+    receiver.processEvents();
+
+    //! CHECK Only the call queued after the disconnection is done
+    EXPECT_EQ(calledCount, 2);
+}
@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "modularity/ioc.h"
+
+using namespace mu::modularity;
+
+namespace {
+class ILazyService : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(ILazyService)
+
+public:
+    virtual ~ILazyService() = default;
+};
+
+class LazyService : public ILazyService
+{
+};
+}
+
+class Global_ModulesIoCTests : public ::testing::Test
+{
+public:
+    void TearDown() override
+    {
+        ioc()->unregisterExport<ILazyService>("tests");
+    }
+};
+
+TEST_F(Global_ModulesIoCTests, LazyExport_CreatedOnce)
+{
+    //! GIVEN A lazy export
+    int createdCount = 0;
+    ioc()->registerLazyExport<ILazyService>("tests", [&createdCount]() {
+        ++createdCount;
+        return std::make_shared<LazyService>();
+    });
+
+    //! CHECK Isn't created by the registration
+    EXPECT_EQ(createdCount, 0);
+
+    //! DO Resolve twice
+    std::shared_ptr<ILazyService> first = ioc()->resolve<ILazyService>("tests");
+    std::shared_ptr<ILazyService> second = ioc()->resolve<ILazyService>("tests");
+
+    //! CHECK The same instance is returned
+    EXPECT_TRUE(first);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(createdCount, 1);
+}
+
+TEST_F(Global_ModulesIoCTests, LazyExport_ConcurrentResolve)
+{
+    //! GIVEN A lazy export with a slow creator
+    std::atomic<int> createdCount { 0 };
+    ioc()->registerLazyExport<ILazyService>("tests", [&createdCount]() {
+        ++createdCount;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return std::make_shared<LazyService>();
+    });
+
+    //! DO Resolve it from two threads at the same time
+    std::shared_ptr<ILazyService> first;
+    std::shared_ptr<ILazyService> second;
+
+    std::thread firstThread([&first]() { first = ioc()->resolve<ILazyService>("tests"); });
+    std::thread secondThread([&second]() { second = ioc()->resolve<ILazyService>("tests"); });
+    firstThread.join();
+    secondThread.join();
+
+    //! CHECK Both threads get the same instance, created once
+    EXPECT_TRUE(first);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(createdCount, 1);
+}
+
+TEST_F(Global_ModulesIoCTests, LazyExport_RecursiveResolve)
+{
+    //! GIVEN A lazy export whose creator resolves the same export
+    std::shared_ptr<ILazyService> recursive = std::make_shared<LazyService>();
+    ioc()->registerLazyExport<ILazyService>("tests", [&recursive]() {
+        recursive = ioc()->resolve<ILazyService>("tests");
+        return std::make_shared<LazyService>();
+    });
+
+    //! DO Resolve
+    std::shared_ptr<ILazyService> service = ioc()->resolve<ILazyService>("tests");
+
+    //! CHECK The recursive resolve gets nothing, instead of a deadlock
+    EXPECT_FALSE(recursive);
+    EXPECT_TRUE(service);
+    EXPECT_EQ(ioc()->resolve<ILazyService>("tests"), service);
+}
@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "thirdparty/haw_profiler/src/profiler.h"
+
+using namespace haw::profiler;
+
+class Global_ProfilerTraceTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        Profiler::instance()->clearTrace();
+        Profiler::setTraceEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        Profiler::setTraceEnabled(false);
+        Profiler::instance()->clearTrace();
+    }
+
+    static size_t count(const std::string& str, const std::string& sub)
+    {
+        size_t result = 0;
+        for (size_t pos = str.find(sub); pos != std::string::npos; pos = str.find(sub, pos + sub.size())) {
+            ++result;
+        }
+        return result;
+    }
+};
+
+TEST_F(Global_ProfilerTraceTests, EventsAreWritten)
+{
+    //! GIVEN Some events of the current thread
+    static const std::string FUNC("Global_ProfilerTraceTests::func");
+    static const std::string COUNTER("Global_ProfilerTraceTests::counter");
+
+    Profiler::instance()->traceBegin(FUNC);
+    Profiler::instance()->traceCounter(COUNTER, 42);
+    Profiler::instance()->traceEnd(FUNC);
+
+    //! DO Get the trace
+    std::string json = Profiler::instance()->traceJson();
+
+    //! CHECK The events are in the trace, in order
+    size_t begin = json.find("{\"name\":\"Global_ProfilerTraceTests::func\",\"ph\":\"B\"");
+    size_t counter = json.find("{\"name\":\"Global_ProfilerTraceTests::counter\",\"ph\":\"C\"");
+    size_t end = json.find("{\"name\":\"Global_ProfilerTraceTests::func\",\"ph\":\"E\"");
+    ASSERT_NE(begin, std::string::npos);
+    ASSERT_NE(counter, std::string::npos);
+    ASSERT_NE(end, std::string::npos);
+    EXPECT_LT(begin, counter);
+    EXPECT_LT(counter, end);
+    EXPECT_NE(json.find("\"args\":{\"value\":42.000}"), std::string::npos);
+
+    //! DO Clear the trace
+    Profiler::instance()->clearTrace();
+
+    //! CHECK The events are removed
+    EXPECT_EQ(Profiler::instance()->traceJson().find("Global_ProfilerTraceTests::func"), std::string::npos);
+}
+
+TEST_F(Global_ProfilerTraceTests, ThreadName)
+{
+    //! GIVEN A named thread with some events
+    static const std::string FUNC("Global_ProfilerTraceTests::threadFunc");
+
+    std::thread thread([]() {
+        Profiler::instance()->setTraceThreadName("worker \"1\"");
+        Profiler::instance()->traceInstant(FUNC);
+    });
+    thread.join();
+
+    //! DO Get the trace
+    std::string json = Profiler::instance()->traceJson();
+
+    //! CHECK The events of the finished thread are kept, with its name
+    EXPECT_NE(json.find("\"args\":{\"name\":\"worker \\\"1\\\"\"}"), std::string::npos);
+    EXPECT_NE(json.find("Global_ProfilerTraceTests::threadFunc"), std::string::npos);
+}
+
+TEST_F(Global_ProfilerTraceTests, BuffersOfFinishedThreadsAreReused)
+{
+    //! GIVEN The buffers of the threads started so far
+    static const std::string FUNC("Global_ProfilerTraceTests::reusedFunc");
+
+    std::thread([]() { Profiler::instance()->traceInstant(FUNC); }).join();
+    size_t buffersBefore = count(Profiler::instance()->traceJson(), "\"thread_name\"");
+
+    //! DO Trace in many threads, one after another
+    for (int i = 0; i < 20; ++i) {
+        std::thread([]() { Profiler::instance()->traceInstant(FUNC); }).join();
+    }
+
+    //! CHECK No new buffers are created
+    EXPECT_EQ(count(Profiler::instance()->traceJson(), "\"thread_name\""), buffersBefore);
+}
+
+TEST_F(Global_ProfilerTraceTests, ReadAndClearWhileWriting)
+{
+    //! GIVEN A thread writing events
+    static const std::string FUNC("Global_ProfilerTraceTests::busyFunc");
+
+    std::atomic<bool> stop { false };
+    std::thread writer([&stop]() {
+        while (!stop) {
+            Profiler::instance()->traceBegin(FUNC);
+            Profiler::instance()->traceEnd(FUNC);
+        }
+    });
+
+    //! DO Read and clear the trace meanwhile
+    for (int i = 0; i < 100; ++i) {
+        std::string json = Profiler::instance()->traceJson();
+
+        //! CHECK The trace is complete
+        EXPECT_EQ(json.rfind("\n]}\n"), json.size() - 4);
+
+        Profiler::instance()->clearTrace();
+    }
+
+    stop = true;
+    writer.join();
+}
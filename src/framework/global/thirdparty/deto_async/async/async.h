@@ -13,18 +13,18 @@ public:
     template<typename F>
     static void call(const Asyncable* caller, F f, const std::thread::id& th = std::this_thread::get_id())
     {
-        AsyncImpl::instance()->call(const_cast<Asyncable*>(caller), new AsyncImpl::Functor<F>(f), th);
+        AsyncImpl::call(const_cast<Asyncable*>(caller), std::move(f), th);
     }
 
     template<typename F, typename Arg1>
     static void call(const Asyncable* caller, F f, Arg1 a1, const std::thread::id& th = std::this_thread::get_id())
     {
-        AsyncImpl::instance()->call(const_cast<Asyncable*>(caller), new AsyncImpl::FunctorArg1<F, Arg1>(f, a1), th);
+        AsyncImpl::call(const_cast<Asyncable*>(caller), [f = std::move(f), a1 = std::move(a1)]() mutable { f(a1); }, th);
     }
 
     static void disconnectAsync(Asyncable* a)
     {
-        AsyncImpl::instance()->disconnectAsync(a);
+        AsyncImpl::disconnectAsync(a);
     }
 };
 }
@@ -2,6 +2,8 @@
 #define DETO_ASYNC_ASYNCABLE_H
 
 #include <set>
+#include <memory>
+#include <atomic>
 #include <cstdint>
 
 namespace deto {
@@ -47,10 +49,39 @@ public:
         }
 
         m_connects.clear();
+
+        resetAsyncAlive();
+    }
+
+    //! NOTE Shared with the pending async calls of this object.
+    //! Async calls may be made from any thread, so the pointer itself is only accessed atomically
+    std::shared_ptr<std::atomic<bool> > asyncAlive()
+    {
+        std::shared_ptr<std::atomic<bool> > alive = std::atomic_load(&m_asyncAlive);
+        if (alive) {
+            return alive;
+        }
+
+        std::shared_ptr<std::atomic<bool> > created = std::make_shared<std::atomic<bool> >(true);
+        if (std::atomic_compare_exchange_strong(&m_asyncAlive, &alive, created)) {
+            return created;
+        }
+
+        //! NOTE Created by another thread in the meantime, alive holds its flag now
+        return alive;
+    }
+
+    void resetAsyncAlive()
+    {
+        std::shared_ptr<std::atomic<bool> > alive = std::atomic_exchange(&m_asyncAlive, std::shared_ptr<std::atomic<bool> >());
+        if (alive) {
+            alive->store(false);
+        }
     }
 
 private:
     std::set<IConnectable*> m_connects;
+    std::shared_ptr<std::atomic<bool> > m_asyncAlive;
 };
 }
 }
@@ -1,6 +1,7 @@
 #include "abstractinvoker.h"
 
 #include <cassert>
+#include <algorithm>
 
 #include "queuedinvoker.h"
 #include <qlogging.h>
@@ -13,9 +14,10 @@ AbstractInvoker::AbstractInvoker()
 
 AbstractInvoker::~AbstractInvoker()
 {
-    std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-    for (QInvoker* qi : m_qInvokers) {
-        qi->invalidate();
+    for (auto it = m_callbacks.begin(); it != m_callbacks.end(); ++it) {
+        for (CallBack& c : it->second) {
+            c.alive->store(false);
+        }
     }
 }
 
@@ -33,10 +35,24 @@ void AbstractInvoker::invoke(int type, const NotifyData& data)
 
     std::thread::id threadID = std::this_thread::get_id();
 
-    //! NOTE: explicit copy because collection can be modified from elsewhere
-    CallBacks callbacks = it->second;
+    //! NOTE: explicit copy because collection can be modified from elsewhere,
+    //! on the stack for the usual small number of callbacks to not allocate
+    constexpr size_t STACK_CALLBACKS_COUNT = 8;
+    std::array<CallBack, STACK_CALLBACKS_COUNT> stackCallbacks;
+    CallBacks heapCallbacks;
+
+    const size_t count = it->second.size();
+    const CallBack* callbacks = nullptr;
+    if (count <= STACK_CALLBACKS_COUNT) {
+        std::copy(it->second.cbegin(), it->second.cend(), stackCallbacks.begin());
+        callbacks = stackCallbacks.data();
+    } else {
+        heapCallbacks = it->second;
+        callbacks = heapCallbacks.data();
+    }
 
-    for (const CallBack& c : callbacks) {
+    for (size_t i = 0; i < count; ++i) {
+        const CallBack& c = callbacks[i];
         if (!it->second.containsReceiver(c.receiver)) {
             qDebug("Skipping removed receiver");
             continue;
@@ -44,11 +60,14 @@ void AbstractInvoker::invoke(int type, const NotifyData& data)
         if (c.threadID == threadID) {
             invokeCallback(type, c, data);
         } else {
-            QInvoker* qi = new QInvoker(this, type, c, data);
-            QueuedInvoker::instance()->invoke(c.threadID, [qi]() {
-                qi->invoke();
-                delete qi;
-            });
+            //! NOTE The callback (and this invoker) may be removed before the call
+            auto call = [this, type, c, data]() {
+                if (c.alive->load()) {
+                    invokeCallback(type, c, data);
+                }
+            };
+            static_assert(sizeof(call) <= QueuedInvoker::Message::INLINE_SIZE, "queued call must not allocate");
+            QueuedInvoker::instance()->invoke(c.threadID, std::move(call));
         }
     }
 }
@@ -117,15 +136,7 @@ void AbstractInvoker::removeCallBack(int type, Asyncable* receiver)
     }
     callbacks.erase(callbacks.begin() + index);
 
-    {
-        std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-        for (QInvoker* qi : m_qInvokers) {
-            if (qi->call.call == c.call) {
-                qi->invalidate();
-                break;
-            }
-        }
-    }
+    c.alive->store(false);
 
     deleteCall(type, c.call);
 }
@@ -138,6 +149,7 @@ void AbstractInvoker::removeAllCallBacks()
                 c.receiver->disconnectAsync(this);
             }
 
+            c.alive->store(false);
             deleteCall(c.type, c.call);
         }
     }
@@ -181,15 +193,3 @@ void AbstractInvoker::disconnectAsync(Asyncable* receiver)
         removeCallBack(type, receiver);
     }
 }
-
-void AbstractInvoker::addQInvoker(QInvoker* qi)
-{
-    std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-    m_qInvokers.push_back(qi);
-}
-
-void AbstractInvoker::removeQInvoker(QInvoker* qi)
-{
-    std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-    m_qInvokers.remove(qi);
-}
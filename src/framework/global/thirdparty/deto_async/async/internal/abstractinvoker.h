@@ -2,6 +2,12 @@
 #define DETO_ASYNC_ABSTRACTINVOKER_H
 
 #include <memory>
+#include <array>
+#include <tuple>
+#include <new>
+#include <cassert>
+#include <type_traits>
+#include <atomic>
 #include <vector>
 #include <list>
 #include <iostream>
@@ -14,33 +20,42 @@
 
 namespace deto {
 namespace async {
+//! NOTE Trivially copyable arguments are stored inline, so sending them doesn't allocate
 class NotifyData
 {
 public:
+    static constexpr size_t MAX_ARGS = 3;
+    static constexpr size_t INLINE_ARG_SIZE = 24;
+
     NotifyData() {}
 
     template<typename ... T>
     void setArg(int i, const T&... val)
     {
-        IArg* p = new Arg<T...>(val ...);
-        m_args.insert(m_args.begin() + i, std::shared_ptr<IArg>(p));
+        assert(m_count < MAX_ARGS);
+        for (size_t k = m_count; k > static_cast<size_t>(i); --k) {
+            m_args[k] = m_args[k - 1];
+        }
+        m_args[i].template set<T...>(val ...);
+        ++m_count;
     }
 
     template<typename T>
     T arg(int i = 0) const
     {
-        IArg* p = m_args.at(i).get();
-        if (!p) {
-            return {};
-        }
-        Arg<T>* d = reinterpret_cast<Arg<T>*>(p);
-        return std::get<0>(d->val);
+        return std::get<0>(args<T>(i));
     }
 
     template<typename ... T>
     std::tuple<T...> args(int i = 0) const
     {
-        IArg* p = m_args.at(i).get();
+        assert(static_cast<size_t>(i) < m_count);
+        const ArgSlot& slot = m_args[i];
+        if (slot.copy) {
+            return *reinterpret_cast<const std::tuple<T...>*>(slot.data);
+        }
+
+        IArg* p = slot.ptr.get();
         if (!p) {
             return {};
         }
@@ -60,7 +75,56 @@ public:
     };
 
 private:
-    std::vector<std::shared_ptr<IArg> > m_args;
+
+    template<typename ... T>
+    static constexpr bool isInlineArg()
+    {
+        using Tuple = std::tuple<T...>;
+        return (std::is_trivially_copyable<T>::value && ...)
+               && sizeof(Tuple) <= INLINE_ARG_SIZE
+               && alignof(Tuple) <= alignof(double);
+    }
+
+    struct ArgSlot {
+        using CopyFunc = void (*)(void* dst, const void* src);
+
+        alignas(double) unsigned char data[INLINE_ARG_SIZE];
+        CopyFunc copy = nullptr; //! NOTE Set if the arg is stored inline
+        std::shared_ptr<IArg> ptr;
+
+        ArgSlot() = default;
+        ArgSlot(const ArgSlot& s) noexcept
+        {
+            *this = s;
+        }
+
+        ArgSlot& operator=(const ArgSlot& s) noexcept
+        {
+            copy = s.copy;
+            ptr = s.ptr;
+            if (copy) {
+                copy(data, s.data);
+            }
+            return *this;
+        }
+
+        template<typename ... T>
+        void set(const T&... val)
+        {
+            using Tuple = std::tuple<T...>;
+            if constexpr (isInlineArg<T...>()) {
+                new (data) Tuple(val ...);
+                copy = [](void* dst, const void* src) { new (dst) Tuple(*static_cast<const Tuple*>(src)); };
+                ptr.reset();
+            } else {
+                copy = nullptr;
+                ptr = std::make_shared<Arg<T...> >(val ...);
+            }
+        }
+    };
+
+    std::array<ArgSlot, MAX_ARGS> m_args;
+    size_t m_count = 0;
 };
 
 class QueuedInvoker;
@@ -89,9 +153,11 @@ protected:
         int type = 0;
         Asyncable* receiver = nullptr;
         void* call = nullptr;
+        //! NOTE Reset when the callback is removed, checked by the queued invocations
+        std::shared_ptr<std::atomic<bool> > alive;
         CallBack() {}
         CallBack(std::thread::id threadID, int t, Asyncable* cr, void* c)
-            : threadID(threadID), type(t), receiver(cr), call(c) {}
+            : threadID(threadID), type(t), receiver(cr), call(c), alive(std::make_shared<std::atomic<bool> >(true)) {}
     };
 
     class CallBacks : public std::vector<CallBack>
@@ -101,60 +167,13 @@ protected:
         bool containsReceiver(Asyncable* receiver) const;
     };
 
-    struct QInvoker
-    {
-        std::mutex mutex;
-        AbstractInvoker* invoker = nullptr;
-        int type = -1;
-        CallBack call;
-        NotifyData data;
-
-        QInvoker(AbstractInvoker* i, int t, CallBack c, NotifyData d)
-            : invoker(i), type(t), call(c), data(d)
-        {
-            invoker->addQInvoker(this);
-        }
-
-        ~QInvoker()
-        {
-            if (invoker) {
-                invoker->removeQInvoker(this);
-            }
-        }
-
-        void invoke()
-        {
-            AbstractInvoker* inv = nullptr;
-            {
-                std::lock_guard<std::mutex> lock(mutex);
-                inv = invoker;
-            }
-
-            if (inv) {
-                inv->invokeCallback(type, call, data);
-            }
-        }
-
-        void invalidate()
-        {
-            std::lock_guard<std::mutex> lock(mutex);
-            invoker = nullptr;
-        }
-    };
-
     void invokeCallback(int type, const CallBack& c, const NotifyData& data);
 
     void addCallBack(int type, Asyncable* receiver, void* call, Asyncable::AsyncMode mode = Asyncable::AsyncMode::AsyncSetRepeat);
     void removeCallBack(int type, Asyncable* receiver);
     void removeAllCallBacks();
 
-    void addQInvoker(QInvoker* qi);
-    void removeQInvoker(QInvoker* qi);
-
     std::map<int /*type*/, CallBacks > m_callbacks;
-
-    std::mutex m_qInvokersMutex;
-    std::list<QInvoker*> m_qInvokers;
 };
 
 inline void processEvents()
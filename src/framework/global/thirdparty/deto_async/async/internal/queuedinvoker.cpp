@@ -8,39 +8,214 @@ QueuedInvoker* QueuedInvoker::instance()
     return &i;
 }
 
-void QueuedInvoker::invoke(const std::thread::id& th, const Functor& f, bool isAlwaysQueued)
+QueuedInvoker::ThreadData& QueuedInvoker::threadData()
 {
-    if (m_onMainThreadInvoke) {
-        if (th == m_mainThreadID) {
-            m_onMainThreadInvoke(f, isAlwaysQueued);
+    thread_local ThreadData data;
+    return data;
+}
+
+QueuedInvoker::ThreadData::~ThreadData()
+{
+    QueuedInvoker::instance()->onThreadFinished(*this);
+}
+
+QueuedInvoker::Queue* QueuedInvoker::queue(const std::thread::id& receiverTh)
+{
+    ThreadData& data = threadData();
+    auto it = data.queues.find(receiverTh);
+    if (it != data.queues.end()) {
+        if (!it->second->receiverFinished.load(std::memory_order_acquire)) {
+            return it->second.get();
         }
+
+        //! NOTE The receiver has finished, a new thread can get the same id
+        data.queues.erase(it);
     }
 
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    m_queues[th].push(f);
+    //! NOTE Release the queues of other finished receivers too, they are not used anymore
+    for (auto qit = data.queues.begin(); qit != data.queues.end();) {
+        if (qit->second->receiverFinished.load(std::memory_order_acquire)) {
+            qit = data.queues.erase(qit);
+        } else {
+            ++qit;
+        }
+    }
+
+    const std::thread::id senderTh = std::this_thread::get_id();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::shared_ptr<Queue>& q = m_queues[{ senderTh, receiverTh }];
+    if (!q) {
+        q = std::make_shared<Queue>();
+        q->sender = senderTh;
+        q->receiver = receiverTh;
+
+        Receiver& r = m_receivers[receiverTh];
+        q->next = r.queues.load(std::memory_order_relaxed);
+        r.queues.store(q.get(), std::memory_order_release);
+    } else {
+        //! NOTE Left by a finished thread with the same id and not removed by the receiver yet
+        q->senderFinished.store(false, std::memory_order_release);
+    }
+
+    data.queues[receiverTh] = q;
+    return q.get();
+}
+
+void QueuedInvoker::scheduleMainThreadEvents()
+{
+    //! NOTE One call of the main thread invoker per batch of messages
+    if (m_mainThreadEventsScheduled.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    m_onMainThreadInvoke([this]() {
+        m_mainThreadEventsScheduled.store(false, std::memory_order_release);
+        processEvents();
+    }, true);
 }
 
 void QueuedInvoker::processEvents()
 {
-    Queue q;
-    {
-        std::lock_guard<std::recursive_mutex> lock(m_mutex);
-        auto n = m_queues.extract(std::this_thread::get_id());
-        if (!n.empty()) {
-            q = n.mapped();
+    ThreadData& data = threadData();
+    if (!data.receiver) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        data.receiver = &m_receivers[std::this_thread::get_id()];
+    }
+
+    bool hasFinishedSenders = false;
+
+    ++data.processingDepth;
+
+    Message m;
+    for (Queue* q = data.receiver->queues.load(std::memory_order_acquire); q; q = q->next) {
+        //! NOTE Only the messages queued before, the new ones will be processed by the next call
+        size_t count = q->size();
+        while (count > 0 && q->pop(m)) {
+            --count;
+            m.call();
+            m.reset();
+        }
+
+        if (q->senderFinished.load(std::memory_order_acquire)) {
+            hasFinishedSenders = true;
         }
     }
-    while (!q.empty()) {
-        const auto& f = q.front();
-        if (f) {
-            f();
+
+    --data.processingDepth;
+
+    //! NOTE Not from a nested call, the outer one may still iterate over the queues
+    if (hasFinishedSenders && data.processingDepth == 0) {
+        removeFinishedSenders(data.receiver);
+    }
+}
+
+void QueuedInvoker::removeFinishedSenders(Receiver* r)
+{
+    //! NOTE Only the receiver iterates over its queues, so they can be unlinked here,
+    //! the lock is needed against the senders adding new queues and reusing finished ones
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Queue* prev = nullptr;
+    Queue* q = r->queues.load(std::memory_order_relaxed);
+    while (q) {
+        Queue* next = q->next;
+        if (q->senderFinished.load(std::memory_order_relaxed) && q->size() == 0) {
+            if (prev) {
+                prev->next = next;
+            } else {
+                r->queues.store(next, std::memory_order_release);
+            }
+
+            m_queues.erase({ q->sender, q->receiver });
+        } else {
+            prev = q;
         }
-        q.pop();
+        q = next;
     }
 }
 
+void QueuedInvoker::onThreadFinished(ThreadData& data)
+{
+    const std::thread::id th = std::this_thread::get_id();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    //! NOTE As sender, the queues are removed by the receivers when they are drained
+    for (auto& p : data.queues) {
+        p.second->senderFinished.store(true, std::memory_order_release);
+    }
+    data.queues.clear();
+
+    //! NOTE As receiver, the queues are removed now, the senders still holding them
+    //! drop the messages and release them on the next send
+    auto rit = m_receivers.find(th);
+    if (rit == m_receivers.end()) {
+        return;
+    }
+
+    for (Queue* q = rit->second.queues.load(std::memory_order_relaxed); q; q = q->next) {
+        q->receiverFinished.store(true, std::memory_order_release);
+    }
+
+    for (auto it = m_queues.begin(); it != m_queues.end();) {
+        if (it->first.second == th) {
+            it = m_queues.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    m_receivers.erase(rit);
+    data.receiver = nullptr;
+}
+
 void QueuedInvoker::onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f)
 {
     m_onMainThreadInvoke = f;
     m_mainThreadID = std::this_thread::get_id();
 }
+
+size_t QueuedInvoker::queuesCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queues.size();
+}
+
+bool QueuedInvoker::Queue::pop(Message& m)
+{
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h != tail.load(std::memory_order_acquire)) {
+        //! NOTE Moved out before calling, so it is safe to process events from a message
+        m.moveFrom(ring[h % QUEUE_CAPACITY]);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    if (!overflowing.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(overflowMutex);
+    if (overflow.empty()) {
+        return false;
+    }
+
+    m.moveFrom(overflow.front());
+    overflow.pop_front();
+    if (overflow.empty()) {
+        overflowing.store(false, std::memory_order_release);
+    }
+
+    return true;
+}
+
+size_t QueuedInvoker::Queue::size()
+{
+    size_t count = tail.load(std::memory_order_acquire) - head.load(std::memory_order_relaxed);
+    if (overflowing.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        count += overflow.size();
+    }
+    return count;
+}
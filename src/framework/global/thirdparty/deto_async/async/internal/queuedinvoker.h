@@ -2,13 +2,23 @@
 #define DETO_ASYNC_QUEUEDINVOKER_H
 
 #include <functional>
-#include <queue>
+#include <deque>
 #include <map>
+#include <memory>
+#include <new>
 #include <mutex>
+#include <atomic>
 #include <thread>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
 
 namespace deto {
 namespace async {
+//! NOTE Messages are passed through a bounded lock-free queue per pair of threads (sender -> receiver),
+//! with a single producer (the sender) and a single consumer (the receiver).
+//! The mutex is only locked when a pair of threads communicates for the first time,
+//! when a thread finishes and when a queue is full, in that case the message is stored in the overflow list of the queue
 class QueuedInvoker
 {
 public:
@@ -17,21 +27,211 @@ public:
 
     using Functor = std::function<void ()>;
 
-    void invoke(const std::thread::id& th, const Functor& f, bool isAlwaysQueued = false);
+    template<typename Func>
+    void invoke(const std::thread::id& th, Func&& f, bool isAlwaysQueued = false)
+    {
+        if (!isCallable(f)) {
+            return;
+        }
+
+        bool isMainThread = m_onMainThreadInvoke && th == m_mainThreadID;
+        if (isMainThread && !isAlwaysQueued && std::this_thread::get_id() == th) {
+            f();
+            return;
+        }
+
+        queue(th)->push(std::forward<Func>(f));
+
+        if (isMainThread) {
+            scheduleMainThreadEvents();
+        }
+    }
+
     void processEvents();
     void onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f);
 
+    //! NOTE For tests and diagnostics
+    size_t queuesCount();
+
+    //! NOTE Type-erased functor, stored without allocation if it fits into the inline buffer
+    class Message
+    {
+    public:
+        static constexpr size_t INLINE_SIZE = 256;
+
+        Message() = default;
+        ~Message() { reset(); }
+
+        Message(const Message&) = delete;
+        Message& operator=(const Message&) = delete;
+
+        template<typename Func>
+        void set(Func&& f)
+        {
+            using F = typename std::decay<Func>::type;
+
+            reset();
+
+            if constexpr (isInline<F>()) {
+                new (m_data) F(std::forward<Func>(f));
+                m_ops = &inlineOps<F>;
+            } else {
+                F* p = new F(std::forward<Func>(f));
+                new (m_data) F*(p);
+                m_ops = &heapOps<F>;
+            }
+        }
+
+        void moveFrom(Message& other)
+        {
+            reset();
+            if (other.m_ops) {
+                other.m_ops->move(m_data, other.m_data);
+                m_ops = other.m_ops;
+                other.m_ops = nullptr;
+            }
+        }
+
+        void call()
+        {
+            if (m_ops) {
+                m_ops->call(m_data);
+            }
+        }
+
+        void reset()
+        {
+            if (m_ops) {
+                m_ops->destroy(m_data);
+                m_ops = nullptr;
+            }
+        }
+
+        bool isEmpty() const { return m_ops == nullptr; }
+
+    private:
+
+        struct Ops {
+            void (* call)(void* data);
+            void (* move)(void* dst, void* src); //! NOTE Move constructs dst and destroys src
+            void (* destroy)(void* data);
+        };
+
+        template<typename F>
+        static constexpr bool isInline()
+        {
+            return sizeof(F) <= INLINE_SIZE
+                   && alignof(F) <= alignof(std::max_align_t)
+                   && std::is_nothrow_move_constructible<F>::value;
+        }
+
+        template<typename F>
+        static inline const Ops inlineOps = {
+            [](void* data) { (*static_cast<F*>(data))(); },
+            [](void* dst, void* src) {
+                new (dst) F(std::move(*static_cast<F*>(src)));
+                static_cast<F*>(src)->~F();
+            },
+            [](void* data) { static_cast<F*>(data)->~F(); }
+        };
+
+        template<typename F>
+        static inline const Ops heapOps = {
+            [](void* data) { (**static_cast<F**>(data))(); },
+            [](void* dst, void* src) { new (dst) F*(*static_cast<F**>(src)); },
+            [](void* data) { delete *static_cast<F**>(data); }
+        };
+
+        alignas(std::max_align_t) unsigned char m_data[INLINE_SIZE];
+        const Ops* m_ops = nullptr;
+    };
+
 private:
 
     QueuedInvoker() = default;
 
-    using Queue = std::queue<Functor>;
+    static constexpr size_t QUEUE_CAPACITY = 256;
+
+    struct Queue {
+        std::thread::id sender;
+        std::thread::id receiver;
+
+        std::unique_ptr<Message[]> ring = std::make_unique<Message[]>(QUEUE_CAPACITY);
+        std::atomic<size_t> head{ 0 }; //! NOTE Written only by the receiver
+        std::atomic<size_t> tail{ 0 }; //! NOTE Written only by the sender
+
+        std::mutex overflowMutex;
+        std::deque<Message> overflow;
+        std::atomic<bool> overflowing{ false }; //! NOTE Set by the sender, reset by the receiver when the overflow is drained
+
+        std::atomic<bool> senderFinished{ false };
+        std::atomic<bool> receiverFinished{ false };
+
+        Queue* next = nullptr; //! NOTE Next queue of the same receiver
+
+        template<typename Func>
+        void push(Func&& f)
+        {
+            //! NOTE Nobody will process it
+            if (receiverFinished.load(std::memory_order_acquire)) {
+                return;
+            }
+
+            if (!overflowing.load(std::memory_order_acquire)) {
+                size_t t = tail.load(std::memory_order_relaxed);
+                if (t - head.load(std::memory_order_acquire) < QUEUE_CAPACITY) {
+                    ring[t % QUEUE_CAPACITY].set(std::forward<Func>(f));
+                    tail.store(t + 1, std::memory_order_release);
+                    return;
+                }
+            }
+
+            //! NOTE Once overflowing, all messages go to the overflow list until it is emptied, to keep the order
+            std::lock_guard<std::mutex> lock(overflowMutex);
+            overflow.emplace_back().set(std::forward<Func>(f));
+            overflowing.store(true, std::memory_order_release);
+        }
+
+        bool pop(Message& m);
+        size_t size();
+    };
+
+    struct Receiver {
+        std::atomic<Queue*> queues{ nullptr };
+    };
+
+    template<typename Func>
+    static bool isCallable(const Func& f)
+    {
+        if constexpr (std::is_same<typename std::decay<Func>::type, Functor>::value) {
+            return static_cast<bool>(f);
+        } else {
+            return true;
+        }
+    }
+
+    //! NOTE Queues and receiver of the current thread, released when the thread finishes
+    struct ThreadData {
+        std::map<std::thread::id, std::shared_ptr<Queue> > queues; //! NOTE As sender, by receiver thread
+        Receiver* receiver = nullptr;
+        int processingDepth = 0;
+        ~ThreadData();
+    };
+
+    static ThreadData& threadData();
+
+    Queue* queue(const std::thread::id& receiverTh);
+    void removeFinishedSenders(Receiver* r);
+    void onThreadFinished(ThreadData& data);
+    void scheduleMainThreadEvents();
 
-    std::recursive_mutex m_mutex;
-    std::map<std::thread::id, Queue > m_queues;
+    std::mutex m_mutex; //! NOTE Only for registration and removal of receivers and queues
+    std::map<std::thread::id, Receiver> m_receivers;
+    std::map<std::pair<std::thread::id, std::thread::id>, std::shared_ptr<Queue> > m_queues;
 
     std::function<void(const std::function<void()>&, bool)> m_onMainThreadInvoke;
     std::thread::id m_mainThreadID;
+    std::atomic<bool> m_mainThreadEventsScheduled{ false };
 };
 }
 }
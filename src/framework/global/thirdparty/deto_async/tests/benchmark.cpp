@@ -0,0 +1,134 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+#include "../async/channel.h"
+#include "../async/internal/abstractinvoker.h"
+
+using namespace deto::async;
+
+//! NOTE Measures the throughput and the latency of messages sent through channels
+//! between a "GUI" thread and an "audio" thread that spends most of its cycle in processing
+
+using clock_type = std::chrono::steady_clock;
+
+static int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now().time_since_epoch()).count();
+}
+
+static void simulateAudioLoad(std::chrono::microseconds duration)
+{
+    auto end = clock_type::now() + duration;
+    volatile double acc = 0.;
+    while (clock_type::now() < end) {
+        for (int i = 0; i < 100; ++i) {
+            acc = acc + i * 0.5;
+        }
+    }
+}
+
+struct LatencyStats {
+    std::atomic<int64_t> count{ 0 };
+    std::atomic<int64_t> sumNs{ 0 };
+    std::atomic<int64_t> maxNs{ 0 };
+
+    void add(int64_t latencyNs)
+    {
+        count.fetch_add(1);
+        sumNs.fetch_add(latencyNs);
+        int64_t prev = maxNs.load();
+        while (latencyNs > prev && !maxNs.compare_exchange_weak(prev, latencyNs)) {
+        }
+    }
+
+    void print(const std::string& title, double elapsedSec) const
+    {
+        int64_t c = count.load();
+        std::cout << title << ":\n"
+                  << "  received: " << c << " messages, " << static_cast<int64_t>(c / elapsedSec) << " messages/sec\n"
+                  << "  latency avg: " << (c ? sumNs.load() / c / 1000. : 0.) << " us"
+                  << ", max: " << maxNs.load() / 1000. << " us\n";
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    const int messagesCount = argc > 1 ? std::atoi(argv[1]) : 200000;
+    const std::chrono::microseconds audioLoad(1500); //! NOTE of the 2 ms audio cycle
+
+    Channel<int64_t> toAudio;
+    Channel<int64_t> toGui;
+
+    LatencyStats guiToAudio;
+    LatencyStats audioToGui;
+
+    std::atomic<bool> audioReady{ false };
+    std::atomic<bool> running{ true };
+
+    //! NOTE Subscribed before the audio thread starts sending
+    toGui.onReceive(nullptr, [&audioToGui](int64_t sentNs) {
+        audioToGui.add(nowNs() - sentNs);
+    });
+
+    std::thread audio([&]() {
+        toAudio.onReceive(nullptr, [&guiToAudio](int64_t sentNs) {
+            guiToAudio.add(nowNs() - sentNs);
+        });
+        audioReady = true;
+
+        while (running) {
+            processEvents();
+
+            simulateAudioLoad(audioLoad);
+
+            //! NOTE Like audio signals notifications
+            for (int i = 0; i < 10; ++i) {
+                toGui.send(nowNs());
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+
+        processEvents();
+    });
+
+    while (!audioReady) {
+        std::this_thread::yield();
+    }
+
+    auto start = clock_type::now();
+
+    int64_t maxSendNs = 0;
+    for (int i = 0; i < messagesCount; ++i) {
+        int64_t before = nowNs();
+        toAudio.send(before);
+        maxSendNs = std::max(maxSendNs, nowNs() - before);
+
+        if (i % 100 == 0) {
+            processEvents();
+        }
+    }
+
+    double sendSec = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    while (guiToAudio.count.load() < messagesCount) {
+        processEvents();
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    running = false;
+    audio.join();
+    processEvents();
+
+    double elapsedSec = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    std::cout << "send: " << messagesCount << " messages, " << static_cast<int64_t>(messagesCount / sendSec) << " messages/sec"
+              << ", max send time: " << maxSendNs / 1000. << " us\n";
+    guiToAudio.print("gui -> audio", elapsedSec);
+    audioToGui.print("audio -> gui", elapsedSec);
+
+    return 0;
+}
@@ -10,6 +10,7 @@
 using namespace haw::profiler;
 
 Profiler::Options Profiler::m_options;
+std::atomic<bool> Profiler::s_traceEnabled{ false };
 
 constexpr int MAIN_THREAD_INDEX(0);
 
@@ -78,6 +79,10 @@ void Profiler::stepTime(const std::string& tag, const std::string& info, bool is
 
     printer()->printStep(tag, timer->beginMs(), timer->stepMs(), info);
 
+    if (isTraceEnabled()) {
+        traceInstant(traceName(tag + ": " + info));
+    }
+
     timer->nextStep();
 }
 
@@ -170,6 +175,8 @@ void Profiler::clear()
         }
         m_steps.timers.clear();
     }
+
+    clearTrace();
 }
 
 Profiler::Data Profiler::threadsData(Data::Mode mode) const
@@ -253,6 +260,279 @@ bool Profiler::save(const std::string& filePath)
     return ok;
 }
 
+void Profiler::setTraceEnabled(bool enabled)
+{
+    s_traceEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::traceBegin(const std::string& name)
+{
+    trace(TraceEvent::Begin, &name);
+}
+
+void Profiler::traceEnd(const std::string& name)
+{
+    trace(TraceEvent::End, &name);
+}
+
+void Profiler::traceCounter(const std::string& name, double value)
+{
+    trace(TraceEvent::Counter, &name, value);
+}
+
+void Profiler::traceInstant(const std::string& name)
+{
+    trace(TraceEvent::Instant, &name);
+}
+
+void Profiler::trace(TraceEvent::Type type, const std::string* name, double value)
+{
+    TraceBuffer* buffer = threadTraceBuffer();
+    if (!buffer) {
+        return;
+    }
+
+    std::chrono::nanoseconds time = std::chrono::steady_clock::now() - m_trace.epoch;
+    buffer->push(type, name, static_cast<int64_t>(time.count()), value);
+}
+
+Profiler::TraceBufferOwner::~TraceBufferOwner()
+{
+    if (buffer) {
+        Profiler::instance()->releaseTraceBuffer(buffer);
+    }
+}
+
+Profiler::TraceBufferOwner& Profiler::threadTraceBufferOwner()
+{
+    thread_local TraceBufferOwner owner;
+    return owner;
+}
+
+Profiler::TraceBuffer* Profiler::threadTraceBuffer()
+{
+    //! NOTE Buffers are never removed, so the pointer stays valid until the thread finishes
+    TraceBufferOwner& owner = threadTraceBufferOwner();
+    if (owner.buffer) {
+        return owner.buffer;
+    }
+
+    std::lock_guard<std::mutex> lock(m_trace.mutex);
+    if (m_options.traceBufferSize == 0) {
+        return nullptr;
+    }
+
+    //! NOTE The events of a finished thread are kept until its buffer is reused
+    TraceBuffer* buffer = nullptr;
+    for (TraceBuffer& b : m_trace.buffers) {
+        if (!b.inUse) {
+            buffer = &b;
+            break;
+        }
+    }
+
+    if (!buffer) {
+        m_trace.buffers.emplace_back();
+        buffer = &m_trace.buffers.back();
+        buffer->index = m_trace.buffers.size() - 1;
+    }
+
+    //! NOTE The previous owner has finished, so nobody writes to the buffer now
+    buffer->inUse = true;
+    buffer->threadName = owner.threadName;
+    if (buffer->size != m_options.traceBufferSize) {
+        buffer->slots.reset(new TraceSlot[m_options.traceBufferSize]);
+        buffer->size = m_options.traceBufferSize;
+    }
+    buffer->written.store(0, std::memory_order_relaxed);
+    buffer->clearedAt.store(0, std::memory_order_relaxed);
+
+    owner.buffer = buffer;
+    return buffer;
+}
+
+void Profiler::releaseTraceBuffer(TraceBuffer* buffer)
+{
+    std::lock_guard<std::mutex> lock(m_trace.mutex);
+    buffer->inUse = false;
+}
+
+void Profiler::setTraceThreadName(const std::string& name)
+{
+    TraceBufferOwner& owner = threadTraceBufferOwner();
+    owner.threadName = name;
+
+    if (owner.buffer) {
+        std::lock_guard<std::mutex> lock(m_trace.mutex);
+        owner.buffer->threadName = name;
+    }
+}
+
+const std::string& Profiler::traceName(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_trace.mutex);
+    auto ins = m_trace.names.insert(name);
+    return *ins.first;
+}
+
+void Profiler::TraceBuffer::push(TraceEvent::Type type, const std::string* name, int64_t timeNs, double value)
+{
+    uint64_t pos = written.load(std::memory_order_relaxed);
+    TraceSlot& slot = slots[pos % size];
+    slot.type.store(type, std::memory_order_relaxed);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.timeNs.store(timeNs, std::memory_order_relaxed);
+    slot.value.store(value, std::memory_order_relaxed);
+    written.store(pos + 1, std::memory_order_release);
+}
+
+std::vector<Profiler::TraceEvent> Profiler::TraceBuffer::snapshot() const
+{
+    std::vector<TraceEvent> events;
+    if (size == 0) {
+        return events;
+    }
+
+    uint64_t end = written.load(std::memory_order_acquire);
+    uint64_t begin = std::max(clearedAt.load(std::memory_order_relaxed), end > size ? end - size : 0);
+    if (begin >= end) {
+        return events;
+    }
+
+    events.resize(end - begin);
+    for (uint64_t pos = begin; pos < end; ++pos) {
+        const TraceSlot& slot = slots[pos % size];
+        TraceEvent& ev = events[pos - begin];
+        ev.type = static_cast<TraceEvent::Type>(slot.type.load(std::memory_order_relaxed));
+        ev.name = slot.name.load(std::memory_order_relaxed);
+        ev.timeNs = slot.timeNs.load(std::memory_order_relaxed);
+        ev.value = slot.value.load(std::memory_order_relaxed);
+    }
+
+    //! NOTE While copying, the writer may have overwritten the oldest slots (up to the one it writes now)
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t writtenAfter = written.load(std::memory_order_relaxed);
+    if (writtenAfter + 1 > begin + size) {
+        uint64_t firstValid = writtenAfter + 1 - size;
+        events.erase(events.begin(), events.begin() + static_cast<ptrdiff_t>(std::min(firstValid, end) - begin));
+    }
+
+    return events;
+}
+
+static std::string jsonEscaped(const std::string& str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (char c : str) {
+        switch (c) {
+        case '"':
+            escaped.append("\\\"");
+            break;
+        case '\\':
+            escaped.append("\\\\");
+            break;
+        case '\n':
+            escaped.append("\\n");
+            break;
+        case '\t':
+            escaped.append("\\t");
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                escaped.append(" ");
+            } else {
+                escaped.push_back(c);
+            }
+            break;
+        }
+    }
+    return escaped;
+}
+
+std::string Profiler::traceJson() const
+{
+    struct ThreadTrace {
+        size_t index = 0;
+        std::string threadName;
+        std::vector<TraceEvent> events;
+    };
+
+    //! NOTE Only the copying is done under the lock, the writers are never blocked by the readout
+    std::vector<ThreadTrace> threads;
+    {
+        std::lock_guard<std::mutex> lock(m_trace.mutex);
+        threads.reserve(m_trace.buffers.size());
+        for (const TraceBuffer& buffer : m_trace.buffers) {
+            ThreadTrace thread;
+            thread.index = buffer.index;
+            thread.threadName = buffer.threadName.empty()
+                                ? std::string("Thread ") + std::to_string(buffer.index)
+                                : buffer.threadName;
+            thread.events = buffer.snapshot();
+            threads.push_back(std::move(thread));
+        }
+    }
+
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    bool first = true;
+    auto beginEvent = [&stream, &first](const std::string& name, char phase, size_t tid) {
+        if (!first) {
+            stream << ",\n";
+        }
+        first = false;
+        stream << "{\"name\":\"" << jsonEscaped(name) << "\",\"ph\":\"" << phase << "\",\"pid\":1,\"tid\":" << tid;
+    };
+
+    for (const ThreadTrace& thread : threads) {
+        beginEvent("thread_name", 'M', thread.index);
+        stream << ",\"args\":{\"name\":\"" << jsonEscaped(thread.threadName) << "\"}}";
+
+        for (const TraceEvent& ev : thread.events) {
+            if (!ev.name) {
+                continue;
+            }
+
+            beginEvent(*ev.name, static_cast<char>(ev.type), thread.index);
+            stream << ",\"ts\":" << (static_cast<double>(ev.timeNs) / 1000.);
+
+            switch (ev.type) {
+            case TraceEvent::Counter:
+                stream << ",\"args\":{\"value\":" << ev.value << "}";
+                break;
+            case TraceEvent::Instant:
+                stream << ",\"s\":\"t\"";
+                break;
+            default:
+                break;
+            }
+
+            stream << "}";
+        }
+    }
+
+    stream << "\n]}\n";
+    return stream.str();
+}
+
+bool Profiler::saveTrace(const std::string& filePath)
+{
+    std::string content = traceJson();
+    bool ok = save_file(filePath, content);
+    return ok;
+}
+
+void Profiler::clearTrace()
+{
+    std::lock_guard<std::mutex> lock(m_trace.mutex);
+    for (TraceBuffer& buffer : m_trace.buffers) {
+        buffer.clearedAt.store(buffer.written.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
 bool Profiler::save_file(const std::string& path, const std::string& content)
 {
     FILE* pFile = fopen(path.c_str(), "w");
@@ -8,8 +8,11 @@
 #include <unordered_map>
 #include <thread>
 #include <mutex>
+#include <atomic>
 #include <chrono>
 #include <sstream>
+#include <memory>
+#include <cstdint>
 
 #define HAW_PROFILER_ENABLED
 
@@ -47,6 +50,12 @@
     { haw::profiler::Profiler::instance()->stepTime(tag, info); }
 #endif
 
+#ifndef TRACE_COUNTER
+#define TRACE_COUNTER(name, value) \
+    if (haw::profiler::Profiler::isTraceEnabled()) \
+    { static std::string __counter_name(name); haw::profiler::Profiler::instance()->traceCounter(__counter_name, value); }
+#endif
+
 #ifndef PROFILER_CLEAR
 #define PROFILER_CLEAR haw::profiler::Profiler::instance()->clear();
 #endif
@@ -55,14 +64,30 @@
 #define PROFILER_PRINT haw::profiler::Profiler::instance()->printThreadsData();
 #endif
 
+#ifndef PROFILER_TRACE_START
+#define PROFILER_TRACE_START haw::profiler::Profiler::setTraceEnabled(true);
+#endif
+
+#ifndef PROFILER_TRACE_STOP
+#define PROFILER_TRACE_STOP haw::profiler::Profiler::setTraceEnabled(false);
+#endif
+
+#ifndef PROFILER_TRACE_SAVE
+#define PROFILER_TRACE_SAVE(path) haw::profiler::Profiler::instance()->saveTrace(path);
+#endif
+
 #else
 
 #define TRACEFUNC
 #define TRACEFUNC_C(info)
 #define BEGIN_STEP_TIME
 #define STEP_TIME
+#define TRACE_COUNTER(name, value)
 #define PROFILER_CLEAR
 #define PROFILER_PRINT
+#define PROFILER_TRACE_START
+#define PROFILER_TRACE_STOP
+#define PROFILER_TRACE_SAVE(path)
 
 #endif
 
@@ -79,6 +104,7 @@ public:
         bool funcsTraceEnabled{ false };
         size_t funcsMaxThreadCount{ 100 };
         int dataTopCount{ 150 };
+        size_t traceBufferSize{ 65536 }; //! NOTE Events per thread, the oldest are overwritten
         Options() {}
     };
 
@@ -140,6 +166,20 @@ public:
             : func(f), callcount(0), sumtimeMs(0) {}
     };
 
+    struct TraceEvent {
+        enum Type : char {
+            Begin = 'B',
+            End = 'E',
+            Counter = 'C',
+            Instant = 'i'
+        };
+
+        Type type{ Begin };
+        const std::string* name{ nullptr };
+        int64_t timeNs{ 0 };
+        double value{ 0. };
+    };
+
     void setup(const Options& opt = Options(), Printer* printer = nullptr);
 
     static const Options& options();
@@ -163,6 +203,26 @@ public:
 
     bool save(const std::string& filePath);
 
+    //! NOTE Trace of timeline events, written to per thread ring buffers.
+    //! The buffer of a finished thread is reused by the next new thread.
+    //! Disabled by default, can be enabled and disabled at any time
+    static void setTraceEnabled(bool enabled);
+    static bool isTraceEnabled() { return s_traceEnabled.load(std::memory_order_relaxed); }
+
+    void traceBegin(const std::string& name);
+    void traceEnd(const std::string& name);
+    void traceCounter(const std::string& name, double value);
+    void traceInstant(const std::string& name);
+
+    //! NOTE The name of the current thread in the trace, "Thread N" by default
+    void setTraceThreadName(const std::string& name);
+
+    //! NOTE Trace in the Chrome trace event format (chrome://tracing, ui.perfetto.dev)
+    //! Can be called while tracing, the events of each thread are consistent
+    std::string traceJson() const;
+    bool saveTrace(const std::string& filePath);
+    void clearTrace();
+
 private:
     Profiler();
     ~Profiler();
@@ -199,12 +259,60 @@ private:
         int addThread(std::thread::id th);
     };
 
+    struct TraceSlot {
+        std::atomic<char> type{ TraceEvent::Begin };
+        std::atomic<const std::string*> name{ nullptr };
+        std::atomic<int64_t> timeNs{ 0 };
+        std::atomic<double> value{ 0. };
+    };
+
+    //! NOTE Single writer ring: only the owner thread pushes, without locking.
+    //! A reader copies the slots and then drops the ones the writer may have overwritten meanwhile
+    struct TraceBuffer {
+        std::unique_ptr<TraceSlot[]> slots;
+        size_t size{ 0 };
+        std::atomic<uint64_t> written{ 0 };
+        std::atomic<uint64_t> clearedAt{ 0 };
+
+        //! NOTE Guarded by TraceData::mutex
+        size_t index{ 0 };
+        std::string threadName;
+        bool inUse{ false };
+
+        void push(TraceEvent::Type type, const std::string* name, int64_t timeNs, double value);
+        std::vector<TraceEvent> snapshot() const;
+    };
+
+    //! NOTE Returns the buffer to the free list when the thread finishes
+    struct TraceBufferOwner {
+        TraceBuffer* buffer{ nullptr };
+        std::string threadName;
+
+        ~TraceBufferOwner();
+    };
+
+    struct TraceData {
+        std::mutex mutex; //! NOTE For the buffer list and names, taken before a buffer mutex
+        std::list<TraceBuffer> buffers;
+        std::set<std::string> names;
+        std::chrono::steady_clock::time_point epoch{ std::chrono::steady_clock::now() };
+    };
+
+    static TraceBufferOwner& threadTraceBufferOwner();
+    TraceBuffer* threadTraceBuffer();
+    void releaseTraceBuffer(TraceBuffer* buffer);
+    const std::string& traceName(const std::string& name);
+    void trace(TraceEvent::Type type, const std::string* name, double value = 0.);
+
     bool save_file(const std::string& path, const std::string& content);
 
+    static std::atomic<bool> s_traceEnabled;
+
     Printer* m_printer{ nullptr };
 
     StepsData m_steps;
     mutable FuncsData m_funcs;
+    mutable TraceData m_trace;
 
     size_t m_stackCounter{ 0 };
 };
@@ -217,6 +325,11 @@ struct FuncMarker
         if (Profiler::m_options.funcsTimeEnabled) {
             timer = Profiler::instance()->beginFunc(fn);
         }
+
+        if (Profiler::isTraceEnabled()) {
+            traced = true;
+            Profiler::instance()->traceBegin(fn);
+        }
     }
 
     ~FuncMarker()
@@ -224,12 +337,18 @@ struct FuncMarker
         if (Profiler::m_options.funcsTimeEnabled) {
             Profiler::instance()->endFunc(timer, func);
         }
+
+        //! NOTE Also if the trace has been disabled meanwhile, to keep begin/end balanced
+        if (traced) {
+            Profiler::instance()->traceEnd(func);
+        }
     }
 
     static std::string formatSig(const std::string& sig);
 
     Profiler::FuncTimer* timer{ nullptr };
     const std::string& func;
+    bool traced{ false };
 };
 }
 
@@ -50,6 +50,8 @@ public:
         TRACEFUNC;
         func1();
 
+        TRACE_COUNTER("counter1", 42);
+
         BEGIN_STEP_TIME("mark1");
 
         {
@@ -74,11 +76,18 @@ int main(int argc, char* argv[])
 {
     std::clog << "Hello World, I am Profiler\n";
 
+    PROFILER_TRACE_START;
+
     Example t;
     t.example();
 
+    PROFILER_TRACE_STOP;
+
     PROFILER_PRINT;
 
+    //! NOTE Open in chrome://tracing or ui.perfetto.dev
+    PROFILER_TRACE_SAVE("haw_profiler_trace.json");
+
     /* Output:
         mark1 : 0.000/0.000 ms: Begin
         mark1 : 21.582/21.545 ms: end call func2 10 times
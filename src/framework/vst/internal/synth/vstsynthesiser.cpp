@@ -97,7 +97,7 @@ void VstSynthesiser::revokePlayingNotes()
         mpe::timestamp_t from = noteEvent.arrangementCtx().actualTimestamp;
         mpe::timestamp_t to = from + noteEvent.arrangementCtx().actualDuration;
 
-        m_vstAudioClient->handleNoteOffEvents(event, from, to);
+        m_vstAudioClient->handleNoteOffEvents(event, from, to + 1);
     }
 
     m_playingEvents.clear();
@@ -157,44 +157,35 @@ audio::samples_t VstSynthesiser::process(float* buffer, audio::samples_t samples
         return 0;
     }
 
-    audio::msecs_t nextMsecs = samplesToMsecs(samplesPerChannel, m_sampleRate);
+    audio::msecs_t blockEnd = framesToMsecs(m_playbackPositionFrames + samplesPerChannel);
 
-    if (!hasAnythingToPlayback(m_playbackPosition, m_playbackPosition + nextMsecs)) {
+    if (!hasAnythingToPlayback(m_playbackPosition, blockEnd)) {
         return 0;
     }
 
-    if (isActive()) {
-        handleMainStreamEvents(nextMsecs);
-    } else {
-        handleOffStreamEvents(nextMsecs);
-    }
+    if (!isActive()) {
+        handleOffStreamEvents(samplesPerChannel * 1000 / m_sampleRate);
 
-    return m_vstAudioClient->process(buffer, samplesPerChannel);
-}
-
-void VstSynthesiser::handleMainStreamEvents(const audio::msecs_t nextMsecs)
-{
-    audio::msecs_t from = m_playbackPosition;
-
-    if (m_playbackPosition == 0) {
-        from = actualPlaybackPositionStart();
+        return m_vstAudioClient->process(buffer, samplesPerChannel);
     }
 
-    audio::msecs_t to = from + nextMsecs;
+    //! NOTE The block is split at the frames where events start or end,
+    //! so every event is passed to the plugin at the beginning of a process call
+    audio::samples_t offset = 0;
+    audio::samples_t result = 0;
+    unsigned int channelsCount = audioChannelsCount();
 
-    EventsMapIteratorList range = m_mainStreamEvents.findEventsRange(from, to);
+    while (offset < samplesPerChannel) {
+        audio::samples_t framesCount = handleMainStreamEvents(samplesPerChannel - offset);
 
-    for (const auto& it : range) {
-        for (const mpe::PlaybackEvent& event : it->second) {
-            if (m_vstAudioClient->handleNoteOnEvents(event, from, from + nextMsecs)) {
-                m_playingEvents.emplace_back(event);
-            }
+        if (m_vstAudioClient->process(buffer + offset * channelsCount, framesCount) > 0) {
+            result = samplesPerChannel;
         }
-    }
 
-    handleAlreadyPlayingEvents(from, from + nextMsecs);
+        offset += framesCount;
+    }
 
-    setPlaybackPosition(to);
+    return result;
 }
 
 void VstSynthesiser::handleOffStreamEvents(const audio::msecs_t nextMsecs)
@@ -206,7 +197,7 @@ void VstSynthesiser::handleOffStreamEvents(const audio::msecs_t nextMsecs)
 
     for (const auto& it : range) {
         for (const mpe::PlaybackEvent& event : it->second) {
-            if (m_vstAudioClient->handleNoteOnEvents(event, from, from + nextMsecs)) {
+            if (handleNoteOnEvents(event, from, from + nextMsecs)) {
                 m_playingEvents.emplace_back(event);
             }
         }
@@ -220,14 +211,12 @@ void VstSynthesiser::handleOffStreamEvents(const audio::msecs_t nextMsecs)
     }
 }
 
-void VstSynthesiser::handleAlreadyPlayingEvents(const audio::msecs_t from, const audio::msecs_t to)
+bool VstSynthesiser::handleNoteOnEvents(const mpe::PlaybackEvent& event, const audio::msecs_t from, const audio::msecs_t to)
 {
-    auto it = m_playingEvents.cbegin();
-    while (it != m_playingEvents.cend()) {
-        if (m_vstAudioClient->handleNoteOffEvents(*it, from, to)) {
-            it = m_playingEvents.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    return m_vstAudioClient->handleNoteOnEvents(event, from, to);
+}
+
+bool VstSynthesiser::handleNoteOffEvents(const mpe::PlaybackEvent& event, const audio::msecs_t from, const audio::msecs_t to)
+{
+    return m_vstAudioClient->handleNoteOffEvents(event, from, to);
 }
@@ -65,10 +65,10 @@ public:
     audio::samples_t process(float* buffer, audio::samples_t samplesPerChannel) override;
 
 private:
-    void handleMainStreamEvents(const audio::msecs_t nextMsecs);
     void handleOffStreamEvents(const audio::msecs_t nextMsecs);
 
-    void handleAlreadyPlayingEvents(const audio::msecs_t from, const audio::msecs_t to);
+    bool handleNoteOnEvents(const mpe::PlaybackEvent& event, const audio::msecs_t from, const audio::msecs_t to) override;
+    bool handleNoteOffEvents(const mpe::PlaybackEvent& event, const audio::msecs_t from, const audio::msecs_t to) override;
 
     Ret init();
 
@@ -78,8 +78,6 @@ private:
 
     async::Channel<unsigned int> m_streamsCountChanged;
     audio::samples_t m_samplesPerChannel = 0;
-
-    std::list<mpe::PlaybackEvent> m_playingEvents;
 };
 
 using VstSynthPtr = std::shared_ptr<VstSynthesiser>;
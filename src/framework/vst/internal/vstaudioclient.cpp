@@ -100,7 +100,7 @@ bool VstAudioClient::handleNoteOffEvents(const mpe::PlaybackEvent& event, const
     timestamp_t timestampFrom = noteEvent.arrangementCtx().actualTimestamp;
     timestamp_t timestampTo = timestampFrom + noteEvent.arrangementCtx().actualDuration;
 
-    if (timestampTo <= from || timestampTo > to) {
+    if (timestampTo < from || timestampTo >= to) {
         return false;
     }
 
@@ -93,3 +93,9 @@ INotationWriter::UnitType AbstractImageWriter::unitTypeFromOptions(const Options
 
     return unitType;
 }
+
+std::mutex& AbstractImageWriter::paintingMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
@@ -22,6 +22,8 @@
 #ifndef MU_IMPORTEXPORT_ABSTRACTIMAGEWRITER_H
 #define MU_IMPORTEXPORT_ABSTRACTIMAGEWRITER_H
 
+#include <mutex>
+
 #include "project/inotationwriter.h"
 
 namespace mu::iex::imagesexport {
@@ -42,6 +44,11 @@ public:
 
 protected:
     UnitType unitTypeFromOptions(const Options& options) const;
+
+    //! NOTE The painting uses the global state of the engraving (e.g. MScore::pixelRatio),
+    //! so the writers, which may be called from several threads, paint under this lock
+    static std::mutex& paintingMutex();
+
     framework::ProgressChannel m_progress;
 };
 }
@@ -25,6 +25,7 @@
 #include <QPdfWriter>
 
 #include "libmscore/masterscore.h"
+#include "engraving/infrastructure/draw/multipaintprovider.h"
 
 #include "log.h"
 
@@ -51,6 +52,9 @@ mu::Ret PdfWriter::write(INotationPtr notation, io::Device& destinationDevice, c
         return make_ret(Ret::Code::UnknownError);
     }
 
+    //! NOTE The layout of a part which isn't open may be postponed (see Ms::Score::postponeLayoutRange)
+    notation->elements()->msScore()->doPostponedLayout();
+
     QPdfWriter pdfWriter(&destinationDevice);
     preparePdfWriter(pdfWriter, notation->projectWorkTitleAndPartName(), notation->painting()->pageSizeInch().toQSizeF());
 
@@ -81,11 +85,16 @@ mu::Ret PdfWriter::writeList(const INotationPtrList& notations, io::Device& dest
         return Ret(Ret::Code::NotSupported);
     }
 
-    INotationPtr firstNotation = notations.front();
-    IF_ASSERT_FAILED(firstNotation) {
-        return make_ret(Ret::Code::UnknownError);
+    for (const INotationPtr& notation : notations) {
+        IF_ASSERT_FAILED(notation) {
+            return make_ret(Ret::Code::UnknownError);
+        }
+
+        notation->elements()->msScore()->doPostponedLayout();
     }
 
+    INotationPtr firstNotation = notations.front();
+
     QPdfWriter pdfWriter(&destinationDevice);
     preparePdfWriter(pdfWriter, firstNotation->projectWorkTitle(), firstNotation->painting()->pageSizeInch().toQSizeF());
 
@@ -94,11 +103,17 @@ mu::Ret PdfWriter::writeList(const INotationPtrList& notations, io::Device& dest
         return false;
     }
 
+    std::vector<io::Device*> partsDevices = partsDevicesFromOptions(options);
+    IF_ASSERT_FAILED(partsDevices.empty() || partsDevices.size() == notations.size()) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
     INotationPainting::Options opt;
     opt.deviceDpi = pdfWriter.logicalDpiX();
     opt.onNewPage = [&pdfWriter]() { pdfWriter.newPage(); };
 
-    for (auto notation : notations) {
+    for (size_t i = 0; i < notations.size(); ++i) {
+        INotationPtr notation = notations[i];
         IF_ASSERT_FAILED(notation) {
             return make_ret(Ret::Code::UnknownError);
         }
@@ -107,7 +122,36 @@ mu::Ret PdfWriter::writeList(const INotationPtrList& notations, io::Device& dest
             pdfWriter.newPage();
         }
 
-        notation->painting()->paintPdf(&painter, opt);
+        if (partsDevices.empty()) {
+            notation->painting()->paintPdf(&painter, opt);
+            continue;
+        }
+
+        //! NOTE The part is painted to its own document and to the common one in one pass,
+        //! instead of painting it once more by write()
+        QPdfWriter partPdfWriter(partsDevices[i]);
+        preparePdfWriter(partPdfWriter, notation->projectWorkTitleAndPartName(), notation->painting()->pageSizeInch().toQSizeF());
+
+        Painter partPainter(&partPdfWriter, "pdfwriter");
+        if (!partPainter.isActive()) {
+            return false;
+        }
+
+        //! NOTE Start from the state of a new painter, so the part document is the same as written by write()
+        painter.provider()->setTransform(Transform());
+
+        std::vector<IPaintProviderPtr> providers { painter.provider(), partPainter.provider() };
+        Painter multiPainter(std::make_shared<MultiPaintProvider>(providers), "pdfwriter");
+
+        INotationPainting::Options partOpt = opt;
+        partOpt.onNewPage = [&pdfWriter, &partPdfWriter]() {
+            pdfWriter.newPage();
+            partPdfWriter.newPage();
+        };
+
+        notation->painting()->paintPdf(&multiPainter, partOpt);
+
+        partPainter.endDraw();
     }
 
     painter.endDraw();
@@ -115,6 +159,22 @@ mu::Ret PdfWriter::writeList(const INotationPtrList& notations, io::Device& dest
     return true;
 }
 
+std::vector<mu::io::Device*> PdfWriter::partsDevicesFromOptions(const Options& options) const
+{
+    std::vector<io::Device*> devices;
+
+    const QVariantList list = options.value(OptionKey::PARTS_DEVICES, Val()).toQVariant().toList();
+    for (const QVariant& device : list) {
+        devices.push_back(qobject_cast<io::Device*>(device.value<QObject*>()));
+
+        IF_ASSERT_FAILED(devices.back()) {
+            return {};
+        }
+    }
+
+    return devices;
+}
+
 void PdfWriter::preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const
 {
     pdfWriter.setResolution(configuration()->exportPdfDpiResolution());
@@ -42,6 +42,7 @@ public:
 
 private:
     void preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const;
+    std::vector<io::Device*> partsDevicesFromOptions(const Options& options) const;
 };
 }
 
@@ -47,29 +47,40 @@ mu::Ret PngWriter::write(INotationPtr notation, Device& destinationDevice, const
         return make_ret(Ret::Code::UnknownError);
     }
 
-    const float CANVAS_DPI = configuration()->exportPngDpiResolution();
-    const SizeF pageSizeInch = notation->painting()->pageSizeInch();
+    QImage image;
 
-    int width = std::lrint(pageSizeInch.width() * CANVAS_DPI);
-    int height = std::lrint(pageSizeInch.height() * CANVAS_DPI);
+    {
+        //! NOTE Only the painting is serialized, the PNG encoding below runs in parallel
+        //! when several pages are written concurrently (see ConverterController::convertPageByPage)
+        std::lock_guard<std::mutex> lock(paintingMutex());
 
-    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
-    image.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
-    image.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
+        //! NOTE A part edited while it wasn't open is laid out before it is painted
+        notation->elements()->msScore()->doPostponedLayout();
 
-    const bool TRANSPARENT_BACKGROUND = options.value(OptionKey::TRANSPARENT_BACKGROUND, Val(false)).toBool();
-    image.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
+        const float CANVAS_DPI = configuration()->exportPngDpiResolution();
+        const SizeF pageSizeInch = notation->painting()->pageSizeInch();
 
-    mu::draw::Painter painter(&image, "pngwriter");
+        int width = std::lrint(pageSizeInch.width() * CANVAS_DPI);
+        int height = std::lrint(pageSizeInch.height() * CANVAS_DPI);
 
-    INotationPainting::Options opt;
-    opt.fromPage = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
-    opt.toPage = opt.fromPage;
-    opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
-    opt.deviceDpi = CANVAS_DPI;
-    opt.printPageBackground = false; //Already printed
+        image = QImage(width, height, QImage::Format_ARGB32_Premultiplied);
+        image.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
+        image.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
 
-    notation->painting()->paintPng(&painter, opt);
+        const bool TRANSPARENT_BACKGROUND = options.value(OptionKey::TRANSPARENT_BACKGROUND, Val(false)).toBool();
+        image.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
+
+        mu::draw::Painter painter(&image, "pngwriter");
+
+        INotationPainting::Options opt;
+        opt.fromPage = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
+        opt.toPage = opt.fromPage;
+        opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
+        opt.deviceDpi = CANVAS_DPI;
+        opt.printPageBackground = false; //Already printed
+
+        notation->painting()->paintPng(&painter, opt);
+    }
 
     image.save(&destinationDevice, "png");
 
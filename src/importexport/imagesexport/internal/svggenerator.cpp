@@ -20,9 +20,11 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <QTextStream>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+
 #include <QBuffer>
-#include <QTextCodec>
 #include <QPainterPath>
 #include <QMimeType>
 #include <QMimeDatabase>
@@ -102,46 +104,163 @@
 */
 ///////////////////////////////////////////////////////////////////////////////
 
-static void translate_color(const QColor& color, QString* color_string,
-                            QString* opacity_string)
+//! NOTE The SVG is appended to UTF-8 byte arrays, the numbers are formatted without QTextStream/QString
+class SvgBuffer
 {
-    Q_ASSERT(color_string);
-    Q_ASSERT(opacity_string);
-
-    *color_string
-        =QString::fromLatin1("#%1%2%3")
-          .arg(color.red(), 2, 16, QLatin1Char('0'))
-          .arg(color.green(), 2, 16, QLatin1Char('0'))
-          .arg(color.blue(), 2, 16, QLatin1Char('0'));
-    *opacity_string = QString::number(color.alphaF());
-}
+public:
+    //! NOTE With the reserved capacity, clear() doesn't free the memory
+    SvgBuffer() { m_data.reserve(1024); }
 
-static void translate_dashPattern(QVector<qreal> pattern, const qreal& width, QString* pattern_string)
-{
-    Q_ASSERT(pattern_string);
+    SvgBuffer& operator<<(const char* str)
+    {
+        m_data.append(str);
+        return *this;
+    }
 
-    // Note that SVG operates in absolute lengths, whereas Qt uses a length/width ratio.
-    foreach (qreal entry, pattern) {
-        *pattern_string += QString::fromLatin1("%1,").arg(entry * width);
+    SvgBuffer& operator<<(char c)
+    {
+        m_data.append(c);
+        return *this;
+    }
+
+    SvgBuffer& operator<<(const QByteArray& data)
+    {
+        m_data.append(data);
+        return *this;
+    }
+
+    SvgBuffer& operator<<(const SvgBuffer& buffer)
+    {
+        m_data.append(buffer.m_data);
+        return *this;
+    }
+
+    SvgBuffer& operator<<(const QString& str)
+    {
+        m_data.append(str.toUtf8());
+        return *this;
+    }
+
+    SvgBuffer& operator<<(int value)
+    {
+        appendNumber(value, 0);
+        return *this;
+    }
+
+    SvgBuffer& operator<<(qreal value)
+    {
+        appendNumber(value);
+        return *this;
+    }
+
+    //! NOTE Fixed point, without the trailing zeros and the leading zero (0.50 -> .5).
+    //! The coordinates are in 1/360 inch, so 2 decimals are enough for them
+    void appendNumber(qreal value, int decimals = 2)
+    {
+        static constexpr qint64 POWERS_OF_TEN[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+        decimals = qBound(0, decimals, 6);
+        if (!std::isfinite(value)) {
+            value = 0;
+        }
+
+        qint64 scaled = std::llround(value * POWERS_OF_TEN[decimals]);
+        if (scaled < 0) {
+            m_data.append('-');
+            scaled = -scaled;
+        }
+
+        char buffer[32];
+        char* end = buffer + sizeof(buffer);
+        char* p = end;
+
+        qint64 integer = scaled / POWERS_OF_TEN[decimals];
+        qint64 fraction = scaled % POWERS_OF_TEN[decimals];
+
+        if (fraction != 0) {
+            int digits = decimals;
+            while (fraction % 10 == 0) {
+                fraction /= 10;
+                --digits;
+            }
+
+            for (int i = 0; i < digits; ++i) {
+                *--p = static_cast<char>('0' + fraction % 10);
+                fraction /= 10;
+            }
+
+            *--p = '.';
+        }
+
+        if (integer != 0 || p == end) {
+            do {
+                *--p = static_cast<char>('0' + integer % 10);
+                integer /= 10;
+            } while (integer != 0);
+        }
+
+        m_data.append(p, static_cast<int>(end - p));
     }
 
-    pattern_string->chop(1);
+    //! NOTE Path data and points: the separator is omitted when it isn't needed (10 20-5 3)
+    void appendCoordinate(qreal value)
+    {
+        if (!m_data.isEmpty()) {
+            char last = m_data.at(m_data.size() - 1);
+            bool isNumberEnd = (last >= '0' && last <= '9') || last == '.';
+
+            if (isNumberEnd && std::llround(value * 100) >= 0) {
+                m_data.append(' ');
+            }
+        }
+
+        appendNumber(value);
+    }
+
+    void appendColor(const QColor& color)
+    {
+        static const char HEX_DIGITS[] = "0123456789abcdef";
+
+        const int components[] = { color.red(), color.green(), color.blue() };
+
+        m_data.append('#');
+        for (int component : components) {
+            m_data.append(HEX_DIGITS[(component >> 4) & 0xf]);
+            m_data.append(HEX_DIGITS[component & 0xf]);
+        }
+    }
+
+    void clear() { m_data.truncate(0); }
+    bool isEmpty() const { return m_data.isEmpty(); }
+    const QByteArray& data() const { return m_data; }
+
+private:
+    QByteArray m_data;
+};
+
+static void translate_dashPattern(QVector<qreal> pattern, const qreal& width, SvgBuffer& out)
+{
+    // Note that SVG operates in absolute lengths, whereas Qt uses a length/width ratio.
+    for (int i = 0; i < pattern.size(); ++i) {
+        if (i > 0) {
+            out << ',';
+        }
+
+        out << pattern.at(i) * width;
+    }
 }
 
 // Gets the contents of the SVG class attribute, based on element type/name
-static QString getClass(const Ms::EngravingItem* e)
+static const char* getClass(const Ms::EngravingItem* e)
 {
-    QString eName;
-
     // Add element type as "class"
     if (e == NULL) {
-        return eName; // e should never be null, this is extra-cautious
+        return ""; // e should never be null, this is extra-cautious
     }
-    eName = e->typeName();
 
     // Future sub-typing code goes here
 
-    return eName;
+    return e->typeName();
 }
 
 class SvgPaintEnginePrivate
@@ -168,12 +287,12 @@ public:
     QSize size;
     QRectF viewBox;
     QIODevice* outputDevice;
-    QTextStream* stream;
+    SvgBuffer* stream = nullptr;
     int resolution;
 
-    QString header;
-//    QString defs; // NEEDED FOR GRADIENTS
-    QString body;
+    SvgBuffer header;
+    SvgBuffer defs; // the reused paths (and the gradients, if they are implemented)
+    SvgBuffer body;
 
     QBrush brush;
     QPen pen;
@@ -221,10 +340,14 @@ class SvgPaintEngine : public QPaintEngine
     Q_DECLARE_PRIVATE(SvgPaintEngine)
 
 private:
-    QString stateString;
-    QTextStream stateStream;
+    SvgBuffer stateString;
     SvgPaintEnginePrivate* d_ptr;
 
+// The repeated paths (mostly the glyphs) are written once to <defs> and then referenced by <use>.
+// The key is the path data before the translation
+    std::unordered_map<std::string, int> _pathIds;
+    std::string _pathKey;
+
 // Qt translates everything. These help avoid SVG transform="translate()".
     qreal _dx { 0.0 };
     qreal _dy { 0.0 };
@@ -234,6 +357,8 @@ protected:
     const Ms::EngravingItem* _element = NULL;
 
     void writeImage(const QRectF& r, const QByteArray& imageData, const QString& mimeFormat);
+    void writePathData(SvgBuffer& out, const QPainterPath& p, qreal dx, qreal dy);
+    int reusedPathId(const QPainterPath& p);
 
 // SVG strings as constants
 #define SVG_SPACE    ' '
@@ -248,8 +373,6 @@ protected:
 #define SVG_ROUND    "round"
 #define SVG_MITER    "miter"
 #define SVG_BEVEL    "bevel"
-#define SVG_ONE      "1"
-#define SVG_BLACK    "#000000"
 
 #define SVG_BEGIN    "<svg"
 #define SVG_END      "</svg>"
@@ -279,6 +402,11 @@ protected:
 
 #define SVG_IMAGE       "<image"
 #define SVG_PATH        "<path"
+#define SVG_USE         "<use"
+#define SVG_HREF        " xlink:href=\"#p"
+#define SVG_ID          " id=\"p"
+#define SVG_DEFS_BEGIN  "<defs>\n"
+#define SVG_DEFS_END    "</defs>\n"
 #define SVG_POLYLINE    "<polyline"
 
 #define SVG_PRESERVE_ASPECT " preserveAspectRatio=\""
@@ -306,8 +434,7 @@ protected:
 
 public:
     SvgPaintEngine()
-        : QPaintEngine(svgEngineFeatures()),
-        stateStream(&stateString)
+        : QPaintEngine(svgEngineFeatures())
     {
         d_ptr = new SvgPaintEnginePrivate;
     }
@@ -464,7 +591,7 @@ public:
 // END UNUSED GRADIENT CODE
 ///////////////////////////////////////////////////////////////////////////////
 
-    inline QTextStream& stream()
+    inline SvgBuffer& stream()
     {
         return *d_func()->stream;
     }
@@ -472,17 +599,12 @@ public:
     //////////////////////////////
     // SvgPaintEngine::qpenToSVG()
     //////////////////////////////
-    const QString qpenToSvg(const QPen& spen)
+    void qpenToSvg(const QPen& spen, SvgBuffer& qts)
     {
-        QString qs;
-        QTextStream qts(&qs);
-
-        QString color, colorOpacity;
-
         // Set stroke, stroke-dasharray, stroke-dashoffset attributes
         switch (spen.style()) {
         case Qt::NoPen:
-            return qs; // Default value for stroke = "none" = Qt::NoPen = NOOP;
+            return; // Default value for stroke = "none" = Qt::NoPen = NOOP;
             break;
 
         case Qt::SolidLine:
@@ -493,14 +615,16 @@ public:
         case Qt::CustomDashLine: {
             // These values are class variables because they are needed by
             // drawTextItem(). This is the fill color/opacity for text.
-            translate_color(spen.color(), &color, &colorOpacity);
-
             // default stroke="none" is handled by case Qt::NoPen above
-            qts << SVG_STROKE << color << SVG_QUOTE;
+            qts << SVG_STROKE;
+            qts.appendColor(spen.color());
+            qts << SVG_QUOTE;
 
             // stroke-opacity is seldom used, usually set to default 1
-            if (colorOpacity != SVG_ONE) {
-                qts << SVG_STROKE_OPACITY << colorOpacity << SVG_QUOTE;
+            if (spen.color().alpha() != 255) {
+                qts << SVG_STROKE_OPACITY;
+                qts.appendNumber(spen.color().alphaF(), 3);
+                qts << SVG_QUOTE;
             }
 
             // If it's a solid line, were done for now
@@ -511,12 +635,10 @@ public:
             // It's a dashed line
             qreal penWidth = spen.width() == 0 ? qreal(1) : spen.widthF();
 
-            QString dashPattern, dashOffset;
-            translate_dashPattern(spen.dashPattern(), penWidth, &dashPattern);
-            dashOffset = QString::number(spen.dashOffset() * penWidth); // SVG uses absolute offset
-
-            qts << SVG_STROKE_DASHARRAY << dashPattern << SVG_QUOTE;
-            qts << SVG_STROKE_DASHOFFSET << dashOffset << SVG_QUOTE;
+            qts << SVG_STROKE_DASHARRAY;
+            translate_dashPattern(spen.dashPattern(), penWidth, qts);
+            qts << SVG_QUOTE;
+            qts << SVG_STROKE_DASHOFFSET << spen.dashOffset() * penWidth << SVG_QUOTE; // SVG uses absolute offset
             break;
         }
         default:
@@ -525,11 +647,7 @@ public:
         }
         // Set stroke-width attribute, unless it's zero or 1 (default is 1)
         if (spen.widthF() > 0 && spen.widthF() != 1) {
-            // Formatting for vertical alignment of elements
-            qts.setRealNumberPrecision(2); // with DPI=72 only 2 decimals necessary
-            qts.setRealNumberNotation(QTextStream::FixedNotation);
             qts << SVG_STROKE_WIDTH << spen.widthF() << SVG_QUOTE;
-            qts.setRealNumberNotation(QTextStream::SmartNotation);
         }
         // Set stroke-linecap attribute
         switch (spen.capStyle()) {
@@ -568,32 +686,27 @@ public:
         if (spen.isCosmetic()) {
             qts << SVG_VECTOR_EFFECT;
         }
-
-        return qs;
     }
 
     /////////////////////////////////
     // SvgPaintEngine::qbrushToSVG()
     /////////////////////////////////
-    const QString  qbrushToSvg(const QBrush& sbrush)
+    void qbrushToSvg(const QBrush& sbrush, SvgBuffer& qts)
     {
-        QString qs;
-        QTextStream qts(&qs);
-
-        QString color, colorOpacity;
-
         switch (sbrush.style()) {
         case Qt::SolidPattern:
-            translate_color(sbrush.color(), &color, &colorOpacity);
-
             // Default fill color is black
-            if (color != SVG_BLACK) {
-                qts << SVG_FILL << color << SVG_QUOTE;
+            if (sbrush.color().rgb() != qRgb(0, 0, 0)) {
+                qts << SVG_FILL;
+                qts.appendColor(sbrush.color());
+                qts << SVG_QUOTE;
             }
 
             // Default fill-opacity is 100%
-            if (colorOpacity != SVG_ONE) {
-                qts << SVG_FILL_OPACITY << colorOpacity << SVG_QUOTE;
+            if (sbrush.color().alpha() != 255) {
+                qts << SVG_FILL_OPACITY;
+                qts.appendNumber(sbrush.color().alphaF(), 3);
+                qts << SVG_QUOTE;
             }
 
             break;
@@ -634,7 +747,6 @@ public:
         default:
             break;
         }
-        return qs;
     }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1033,8 +1145,13 @@ bool SvgPaintEngine::begin(QPaintDevice*)
     }
 
     // Stream the headers
-    d->stream = new QTextStream(&d->header);
-    stream() << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>" << Qt::endl << SVG_BEGIN;
+    d->header.clear();
+    d->defs.clear();
+    d->body.clear();
+    _pathIds.clear();
+
+    d->stream = &d->header;
+    stream() << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n" << SVG_BEGIN;
     if (d->viewBox.isValid()) {
         // viewBox has floating point values, size width/height is integer
         stream() << SVG_WIDTH << d->viewBox.width() << SVG_PX << SVG_QUOTE
@@ -1043,24 +1160,20 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         stream() << SVG_VIEW_BOX << d->viewBox.left()
                  << SVG_SPACE << d->viewBox.top()
                  << SVG_SPACE << d->viewBox.width()
-                 << SVG_SPACE << d->viewBox.height() << SVG_QUOTE << Qt::endl;
+                 << SVG_SPACE << d->viewBox.height() << SVG_QUOTE << '\n';
     }
     stream() << " xmlns=\"http://www.w3.org/2000/svg\""
                 " xmlns:xlink=\"http://www.w3.org/1999/xlink\""
-                " version=\"1.2\" baseProfile=\"tiny\">" << Qt::endl;
+                " version=\"1.2\" baseProfile=\"tiny\">\n";
     if (!d->attributes.title.isEmpty()) {
-        stream() << SVG_TITLE_BEGIN << d->attributes.title.toHtmlEscaped() << SVG_TITLE_END << Qt::endl;
+        stream() << SVG_TITLE_BEGIN << d->attributes.title.toHtmlEscaped() << SVG_TITLE_END << '\n';
     }
     if (!d->attributes.description.isEmpty()) {
-        stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << Qt::endl;
+        stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << '\n';
     }
 
-// <defs> is currently empty. It's necessary for gradients.
-//    d->stream->setString(&d->defs);
-//    *d->stream << "<defs>\n";
-
-    // Point the stream at the body string, for other functions to populate
-    d->stream->setString(&d->body);
+    // Point the stream at the body, for other functions to populate
+    d->stream = &d->body;
     return true;
 }
 
@@ -1068,24 +1181,20 @@ bool SvgPaintEngine::end()
 {
     Q_D(SvgPaintEngine);
 
-// <defs> is currently empty
-//    d->stream->setString(&d->defs);
-//    stream() << "</defs>\n";
+    // Write our buffers out to the device (the .svg file), in order
+    QIODevice* device = d->outputDevice;
+    device->write(d->header.data());
 
-    // Point the stream at the real output device (the .svg file)
-    d->stream->setDevice(d->outputDevice);
-
-#ifndef QT_NO_TEXTCODEC
-    d->stream->setCodec(QTextCodec::codecForName("UTF-8"));
-#endif
+    if (!d->defs.isEmpty()) {
+        device->write(SVG_DEFS_BEGIN);
+        device->write(d->defs.data());
+        device->write(SVG_DEFS_END);
+    }
 
-    // Stream our strings out to the device, in order
-    stream() << d->header;
-//    stream() << d->defs;
-    stream() << d->body;
-    stream() << SVG_END << Qt::endl;
+    device->write(d->body.data());
+    device->write(SVG_END "\n");
 
-    delete d->stream;
+    d->stream = nullptr;
     return true;
 }
 
@@ -1143,7 +1252,7 @@ void SvgPaintEngine::writeImage(const QRectF& r, const QByteArray& imageData, co
              << SVG_PRESERVE_ASPECT << SVG_NONE << SVG_QUOTE;
 
     stream() << " xlink:href=\"data:" << mimeFormat << ";base64,"
-             << imageData.toBase64() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+             << imageData.toBase64() << SVG_QUOTE << SVG_ELEMENT_END << '\n';
 }
 
 void SvgPaintEngine::updateState(const QPaintEngineState& s)
@@ -1154,18 +1263,20 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
     // stateString = Attribute Settings
 
     // SVG class attribute, based on Ms::ElementType
-    stateStream << SVG_CLASS << getClass(_element) << SVG_QUOTE;
+    stateString << SVG_CLASS << getClass(_element) << SVG_QUOTE;
 
     // Brush and Pen attributes
-    stateStream << qbrushToSvg(s.brush());
-    stateStream << qpenToSvg(s.pen());
+    qbrushToSvg(s.brush(), stateString);
+    qpenToSvg(s.pen(), stateString);
 
 // TBD:  "opacity" attribute: Is it ever used?
 //       Or is opacity determined by fill-opacity & stroke-opacity instead?
 // PLUS: qFuzzyIsNull() is not officially supported in Qt.
 //       Should probably use QFuzzyCompare() instead.
     if (!qFuzzyIsNull(s.opacity() - 1)) {
-        stateStream << SVG_OPACITY << s.opacity() << SVG_QUOTE;
+        stateString << SVG_OPACITY;
+        stateString.appendNumber(s.opacity(), 3);
+        stateString << SVG_QUOTE;
     }
 
     // Translations, SVG transform="translate()", are handled separately from
@@ -1189,61 +1300,119 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
         // Other transformations are more straightforward with a full matrix
         _dx = 0;
         _dy = 0;
-        stateStream << SVG_MATRIX << t.m11() << SVG_COMMA
-                    << t.m12() << SVG_COMMA
-                    << t.m21() << SVG_COMMA
-                    << t.m22() << SVG_COMMA
-                    << t.m31() << SVG_COMMA
-                    << t.m32() << SVG_RPAREN_QUOTE;
+        // The scaling/rotation needs more decimals than the coordinates
+        stateString << SVG_MATRIX;
+        stateString.appendNumber(t.m11(), 6);
+        stateString << SVG_COMMA;
+        stateString.appendNumber(t.m12(), 6);
+        stateString << SVG_COMMA;
+        stateString.appendNumber(t.m21(), 6);
+        stateString << SVG_COMMA;
+        stateString.appendNumber(t.m22(), 6);
+        stateString << SVG_COMMA << t.m31() << SVG_COMMA << t.m32() << SVG_RPAREN_QUOTE;
     }
 }
 
-void SvgPaintEngine::drawPath(const QPainterPath& p)
+void SvgPaintEngine::writePathData(SvgBuffer& out, const QPainterPath& p, qreal dx, qreal dy)
 {
-    stream() << SVG_PATH << stateString;
+    // The command is omitted if it repeats the previous one (except after M, where it would mean L)
+    char command = 0;
 
-    // fill-rule is here because UpdateState() doesn't have a QPainterPath arg
-    // Majority of <path>s use the default value: fill-rule="nonzero"
-    if (p.fillRule() == Qt::OddEvenFill) {
-        stream() << SVG_FILL_RULE;
-    }
-
-    // Path data
-    stream() << SVG_D;
     for (int i = 0; i < p.elementCount(); ++i) {
         const QPainterPath::Element& e = p.elementAt(i);
-        qreal x = e.x + _dx;
-        qreal y = e.y + _dy;
         switch (e.type) {
         case QPainterPath::MoveToElement:
-            stream() << SVG_MOVE << x << SVG_COMMA << y;
+            command = SVG_MOVE;
+            out << SVG_MOVE;
             break;
         case QPainterPath::LineToElement:
-            stream() << SVG_LINE << x << SVG_COMMA << y;
+            if (command != SVG_LINE) {
+                command = SVG_LINE;
+                out << SVG_LINE;
+            }
             break;
         case QPainterPath::CurveToElement:
-            stream() << SVG_CURVE << x << SVG_COMMA << y;
-            ++i;
-            while (i < p.elementCount()) {
-                const QPainterPath::Element& ee = p.elementAt(i);
-                if (ee.type == QPainterPath::CurveToDataElement) {
-                    stream() << SVG_SPACE << ee.x + _dx
-                             << SVG_COMMA << ee.y + _dy;
-                    ++i;
-                } else {
-                    --i;
-                    break;
-                }
+            if (command != SVG_CURVE) {
+                command = SVG_CURVE;
+                out << SVG_CURVE;
             }
             break;
-        default:
+        case QPainterPath::CurveToDataElement:
             break;
         }
-        if (i <= p.elementCount() - 1) {
-            stream() << SVG_SPACE;
+
+        out.appendCoordinate(e.x + dx);
+        out.appendCoordinate(e.y + dy);
+    }
+}
+
+int SvgPaintEngine::reusedPathId(const QPainterPath& p)
+{
+    Q_D(SvgPaintEngine);
+
+    _pathKey.clear();
+    _pathKey.push_back(static_cast<char>(p.fillRule()));
+
+    for (int i = 0; i < p.elementCount(); ++i) {
+        const QPainterPath::Element& e = p.elementAt(i);
+        const qreal coords[] = { e.x, e.y };
+
+        _pathKey.push_back(static_cast<char>(e.type));
+        _pathKey.append(reinterpret_cast<const char*>(coords), sizeof(coords));
+    }
+
+    auto it = _pathIds.find(_pathKey);
+    if (it != _pathIds.end()) {
+        return it->second;
+    }
+
+    int id = static_cast<int>(_pathIds.size()) + 1;
+    _pathIds.emplace(_pathKey, id);
+
+    d->defs << SVG_PATH << SVG_ID << id << SVG_QUOTE;
+    if (p.fillRule() == Qt::OddEvenFill) {
+        d->defs << SVG_FILL_RULE;
+    }
+
+    d->defs << SVG_D;
+    writePathData(d->defs, p, 0, 0);
+    d->defs << SVG_QUOTE << SVG_ELEMENT_END << '\n';
+
+    return id;
+}
+
+void SvgPaintEngine::drawPath(const QPainterPath& p)
+{
+    // Glyph outlines have many elements and are painted at the origin, translated by
+    // the painter, so the same glyph always has the same path. Short paths (lines, stems,
+    // beams) are rarely repeated and are cheaper to write directly
+    static constexpr int MIN_REUSED_PATH_ELEMENTS = 8;
+
+    if (p.elementCount() >= MIN_REUSED_PATH_ELEMENTS) {
+        int id = reusedPathId(p);
+
+        stream() << SVG_USE << stateString << SVG_HREF << id << SVG_QUOTE;
+        if (_dx != 0 || _dy != 0) {
+            stream() << SVG_X << SVG_QUOTE << _dx << SVG_QUOTE
+                     << SVG_Y << SVG_QUOTE << _dy << SVG_QUOTE;
         }
+
+        stream() << SVG_ELEMENT_END << '\n';
+        return;
     }
-    stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+
+    stream() << SVG_PATH << stateString;
+
+    // fill-rule is here because UpdateState() doesn't have a QPainterPath arg
+    // Majority of <path>s use the default value: fill-rule="nonzero"
+    if (p.fillRule() == Qt::OddEvenFill) {
+        stream() << SVG_FILL_RULE;
+    }
+
+    // Path data
+    stream() << SVG_D;
+    writePathData(stream(), p, _dx, _dy);
+    stream() << SVG_QUOTE << SVG_ELEMENT_END << '\n';
 }
 
 void SvgPaintEngine::drawPolygon(const QPointF* points, int pointCount,
@@ -1251,23 +1420,21 @@ void SvgPaintEngine::drawPolygon(const QPointF* points, int pointCount,
 {
     Q_ASSERT(pointCount >= 2);
 
-    QPainterPath path(points[0]);
-    for (int i=1; i < pointCount; ++i) {
-        path.lineTo(points[i]);
-    }
-
     if (mode == PolylineMode) {
         stream() << SVG_POLYLINE << stateString
                  << SVG_POINTS;
         for (int i = 0; i < pointCount; ++i) {
             const QPointF& pt = points[i];
-            stream() << pt.x() + _dx << SVG_COMMA << pt.y() + _dy;
-            if (i != pointCount - 1) {
-                stream() << SVG_SPACE;
-            }
+            stream().appendCoordinate(pt.x() + _dx);
+            stream().appendCoordinate(pt.y() + _dy);
         }
-        stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+        stream() << SVG_QUOTE << SVG_ELEMENT_END << '\n';
     } else {
+        QPainterPath path(points[0]);
+        for (int i=1; i < pointCount; ++i) {
+            path.lineTo(points[i]);
+        }
+
         path.closeSubpath();
         drawPath(path);
     }
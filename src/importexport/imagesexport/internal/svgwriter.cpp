@@ -56,6 +56,9 @@ mu::Ret SvgWriter::write(INotationPtr notation, Device& destinationDevice, const
         return make_ret(Ret::Code::UnknownError);
     }
 
+    //! NOTE A part edited while it wasn't open is laid out first
+    score->doPostponedLayout();
+
     score->setPrinting(true); // don’t print page break symbols etc.
 
     Ms::MScore::pdfPrinting = true;
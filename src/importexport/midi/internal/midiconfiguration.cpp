@@ -32,11 +32,13 @@ using namespace mu::iex::midi;
 
 static const Settings::Key SHORTEST_NOTE_KEY("iex_midi", "io/midi/shortestNote");
 static const Settings::Key EXPORTRPNS_KEY("iex_midi", "io/midi/exportRPNs");
+static const Settings::Key SEARCH_TIME_BUDGET_KEY("iex_midi", "io/midi/importSearchTimeBudget");
 
 void MidiConfiguration::init()
 {
     settings()->setDefaultValue(SHORTEST_NOTE_KEY, Val(Ms::Constant::division / 4));
     settings()->setDefaultValue(EXPORTRPNS_KEY, Val(false));
+    settings()->setDefaultValue(SEARCH_TIME_BUDGET_KEY, Val(0));
 }
 
 int MidiConfiguration::midiShortestNote() const
@@ -49,6 +51,16 @@ void MidiConfiguration::setMidiShortestNote(int ticks)
     settings()->setSharedValue(SHORTEST_NOTE_KEY, Val(ticks));
 }
 
+int MidiConfiguration::midiImportSearchTimeBudget() const
+{
+    return settings()->value(SEARCH_TIME_BUDGET_KEY).toInt();
+}
+
+void MidiConfiguration::setMidiImportSearchTimeBudget(int msecs)
+{
+    settings()->setSharedValue(SEARCH_TIME_BUDGET_KEY, Val(msecs));
+}
+
 bool MidiConfiguration::isMidiExportRpns() const
 {
     return settings()->value(EXPORTRPNS_KEY).toBool();
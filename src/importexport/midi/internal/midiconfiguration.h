@@ -34,6 +34,9 @@ public:
     int midiShortestNote() const override; // ticks
     void setMidiShortestNote(int ticks) override;
 
+    int midiImportSearchTimeBudget() const override; // msecs
+    void setMidiImportSearchTimeBudget(int msecs) override;
+
     bool isMidiExportRpns() const override;
     void setIsMidiExportRpns(bool exportRpns) const override;
 
@@ -80,8 +80,12 @@
 #include "importmidi_key.h"
 #include "importmidi_instrument.h"
 #include "importmidi_chordname.h"
+#include "importmidi_concurrent.h"
 #include "../midishared/midifile.h"
 
+#include "modularity/ioc.h"
+#include "importexport/midi/imidiconfiguration.h"
+
 #include "log.h"
 
 using namespace mu::engraving;
@@ -231,58 +235,69 @@ void findAllTupletsForDrums(
     // note: temporary local tuplets and chords are deleted here
 }
 
-void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
-                       TimeSigMap* sigmap,
-                       const ReducedFraction& lastTick)
+void quantizeTrack(MTrack& mtrack,
+                   TimeSigMap* sigmap,
+                   const ReducedFraction& lastTick)
 {
     auto& opers = midiImportOperations;
+    // pass current track index through MidiImportOperations
+    // for further usage
+    MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
+    MidiSearch::TimeBudget searchTimeBudget{ opers.data()->searchTimeBudget };
 
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
-        if (mtrack.chords.empty()) {
-            continue;
-        }
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
-
-        if (opers.data()->processingsOfOpenedFile == 0) {
-            opers.data()->trackOpers.isDrumTrack.setValue(
-                opers.currentTrack(), mtrack.mtrack->drumTrack());
-            if (mtrack.mtrack->drumTrack()) {
-                opers.data()->trackOpers.maxVoiceCount.setValue(
-                    opers.currentTrack(), MidiOperations::VoiceCount::V_1);
-            }
-        }
-        const auto basicQuant = Quantize::quantValueToFraction(
-            opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
+    const auto basicQuant = Quantize::quantValueToFraction(
+        opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
 #ifdef QT_DEBUG
-        Q_ASSERT_X(MChord::isLastTickValid(lastTick, mtrack.chords),
-                   "quantizeAllTracks", "Last tick is less than max note off time");
+    Q_ASSERT_X(MChord::isLastTickValid(lastTick, mtrack.chords),
+               "quantizeAllTracks", "Last tick is less than max note off time");
 #endif
-        MChord::setBarIndexes(mtrack.chords, basicQuant, lastTick, sigmap);
+    MChord::setBarIndexes(mtrack.chords, basicQuant, lastTick, sigmap);
 
-        if (mtrack.mtrack->drumTrack()) {
-            findAllTupletsForDrums(mtrack, sigmap, basicQuant);
-        } else {
-            MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
-        }
+    if (mtrack.mtrack->drumTrack()) {
+        findAllTupletsForDrums(mtrack, sigmap, basicQuant);
+    } else {
+        MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
+    }
 #ifdef QT_DEBUG
-        Q_ASSERT_X(!doNotesOverlap(track.second),
-                   "quantizeAllTracks",
-                   "There are overlapping notes of the same voice that is incorrect");
+    Q_ASSERT_X(!doNotesOverlap(mtrack),
+               "quantizeAllTracks",
+               "There are overlapping notes of the same voice that is incorrect");
 #endif
-        // (4/3 of the smallest duration) tol is less sensitive
-        // to on time inaccuracies than 1/2 earlier
-        MChord::collectChords(mtrack, { 2, 1 }, { 4, 3 });
-        Quantize::quantizeChords(mtrack.chords, sigmap, basicQuant);
-        MidiTuplet::removeEmptyTuplets(mtrack);
+    // (4/3 of the smallest duration) tol is less sensitive
+    // to on time inaccuracies than 1/2 earlier
+    MChord::collectChords(mtrack, { 2, 1 }, { 4, 3 });
+    Quantize::quantizeChords(mtrack.chords, sigmap, basicQuant);
+    MidiTuplet::removeEmptyTuplets(mtrack);
 #ifdef QT_DEBUG
-        Q_ASSERT_X(MidiTuplet::areTupletRangesOk(mtrack.chords, mtrack.tuplets),
-                   "quantizeAllTracks", "Tuplet chord/note is outside tuplet "
-                                        "or non-tuplet chord/note is inside tuplet");
+    Q_ASSERT_X(MidiTuplet::areTupletRangesOk(mtrack.chords, mtrack.tuplets),
+               "quantizeAllTracks", "Tuplet chord/note is outside tuplet "
+                                    "or non-tuplet chord/note is inside tuplet");
 #endif
+}
+
+void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
+                       TimeSigMap* sigmap,
+                       const ReducedFraction& lastTick)
+{
+    auto& opers = midiImportOperations;
+    std::vector<MTrack*> tracksToQuantize = MidiConcurrent::tracksToProcess(tracks);
+
+    // track operations are shared between tracks - so set them
+    // before the tracks are quantized concurrently
+    if (opers.data()->processingsOfOpenedFile == 0) {
+        for (const MTrack* mtrack: tracksToQuantize) {
+            opers.data()->trackOpers.isDrumTrack.setValue(
+                mtrack->indexOfOperation, mtrack->mtrack->drumTrack());
+            if (mtrack->mtrack->drumTrack()) {
+                opers.data()->trackOpers.maxVoiceCount.setValue(
+                    mtrack->indexOfOperation, MidiOperations::VoiceCount::V_1);
+            }
+        }
     }
+
+    MidiConcurrent::forEach(tracksToQuantize, [sigmap, &lastTick](MTrack* mtrack) {
+        quantizeTrack(*mtrack, sigmap, lastTick);
+    });
 }
 
 //---------------------------------------------------------
@@ -1116,6 +1131,9 @@ ReducedFraction findLastChordTick(const std::multimap<int, MTrack>& tracks)
 
 QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
 {
+    const std::string stepTag = "importMidi";
+    BEGIN_STEP_TIME(stepTag);
+
     auto* sigmap = score->sigmap();
 
     auto tracks = createMTrackList(sigmap, mf);
@@ -1124,6 +1142,11 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
     if (opers.data()->processingsOfOpenedFile == 0) {         // for newly opened MIDI file
         MidiChordName::findChordNames(tracks);
     }
+    // read here because the configuration is not accessed from the worker threads
+    auto conf = mu::modularity::ioc()->resolve<mu::iex::midi::IMidiImportExportConfiguration>("iex_midi");
+    if (conf) {
+        opers.data()->searchTimeBudget = conf->midiImportSearchTimeBudget();
+    }
 
     lengthenTooShortNotes(tracks);
 
@@ -1150,9 +1173,12 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
                != ReducedFraction(0, 1) : true,
                "convertMidi", "Null time signature for human-performed MIDI file");
 
+    STEP_TIME(stepTag, "prepare tracks");
+
     MChord::collectChords(tracks, { 2, 1 }, { 1, 2 });
     MidiBeat::adjustChordsToBeats(tracks);
     MChord::mergeChordsWithEqualOnTimeAndVoice(tracks);
+    STEP_TIME(stepTag, "collect chords and adjust to beats");
 
     // for newly opened MIDI file
     if (opers.data()->processingsOfOpenedFile == 0
@@ -1166,10 +1192,13 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
                "convertMidi", "There are overlapping notes of the same voice that is incorrect");
 #endif
     LRHand::splitIntoLeftRightHands(tracks);
+    STEP_TIME(stepTag, "split into left/right hands");
     MidiDrum::splitDrumVoices(tracks);
     MidiDrum::splitDrumTracks(tracks);
+    STEP_TIME(stepTag, "split drums");
     ReducedFraction lastTick = findLastChordTick(tracks);
     quantizeAllTracks(tracks, sigmap, lastTick);
+    STEP_TIME(stepTag, "quantize and find tuplets");
     MChord::removeOverlappingNotes(tracks);
 #ifdef QT_DEBUG
     Q_ASSERT_X(!doNotesOverlap(tracks),
@@ -1179,9 +1208,11 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
 #endif
     MChord::mergeChordsWithEqualOnTimeAndVoice(tracks);
     Simplify::simplifyDurationsNotDrums(tracks, sigmap);
+    STEP_TIME(stepTag, "simplify durations");
     if (MidiVoice::separateVoices(tracks, sigmap)) {
         Simplify::simplifyDurationsNotDrums(tracks, sigmap);        // again
     }
+    STEP_TIME(stepTag, "separate voices");
     Simplify::simplifyDurationsForDrums(tracks, sigmap);
     MChord::splitUnequalChords(tracks);
     // no more track insertion/reordering/deletion from now
@@ -1208,6 +1239,7 @@ QList<MTrack> convertMidi(Score* score, const MidiFile* mf)
     MidiLyrics::setLyricsToScore(trackList);
     MidiTempo::setTempo(tracks, score);
     MidiChordName::setChordNames(trackList);
+    STEP_TIME(stepTag, "create score");
 
     return trackList;
 }
@@ -0,0 +1,49 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "importmidi_concurrent.h"
+#include "importmidi_inner.h"
+#include "../midishared/midifile.h"
+
+namespace Ms {
+namespace MidiConcurrent {
+std::vector<MTrack*> tracksToProcess(std::multimap<int, MTrack>& tracks, TrackFilter filter)
+{
+    std::vector<MTrack*> result;
+    result.reserve(tracks.size());
+
+    for (auto& track: tracks) {
+        MTrack& mtrack = track.second;
+        if (mtrack.chords.empty()) {
+            continue;
+        }
+        const bool isDrumTrack = mtrack.mtrack->drumTrack();
+        if ((filter == TrackFilter::ONLY_DRUMS && !isDrumTrack)
+            || (filter == TrackFilter::NO_DRUMS && isDrumTrack)) {
+            continue;
+        }
+        result.push_back(&mtrack);
+    }
+
+    return result;
+}
+} // namespace MidiConcurrent
+} // namespace Ms
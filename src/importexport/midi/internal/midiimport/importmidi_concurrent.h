@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef IMPORTMIDI_CONCURRENT_H
+#define IMPORTMIDI_CONCURRENT_H
+
+#include <map>
+#include <vector>
+
+#include <QtGlobal>
+#ifndef Q_OS_WASM
+#include <QtConcurrent>
+#endif
+
+namespace Ms {
+class MTrack;
+
+namespace MidiConcurrent {
+// Runs func(item) for every item of the sequence on the global thread pool
+// and waits for all of them; func must only modify the item it was given.
+// The items are processed in parallel but the result doesn't depend
+// on the order of processing - so the import stays deterministic
+template<typename Sequence, typename Func>
+void forEach(Sequence& items, Func func)
+{
+#ifndef Q_OS_WASM
+    if (items.size() > 1) {
+        QtConcurrent::blockingMap(items, func);
+        return;
+    }
+#endif
+    for (auto& item: items) {
+        func(item);
+    }
+}
+
+// collects non-empty tracks (of drum or non-drum type, or all)
+// that can be passed to MidiConcurrent::forEach
+enum class TrackFilter {
+    ALL,
+    ONLY_DRUMS,
+    NO_DRUMS
+};
+
+std::vector<MTrack*> tracksToProcess(std::multimap<int, MTrack>& tracks, TrackFilter filter = TrackFilter::ALL);
+} // namespace MidiConcurrent
+} // namespace Ms
+
+#endif // IMPORTMIDI_CONCURRENT_H
@@ -26,6 +26,7 @@
 #include "importmidi_inner.h"
 #include "importmidi_chord.h"
 #include "importmidi_operations.h"
+#include "importmidi_concurrent.h"
 #include "../midishared/midifile.h"
 
 #include "engraving/libmscore/drumset.h"
@@ -81,48 +82,52 @@ void splitChord(
     }
 }
 
-void splitDrumVoices(std::multimap<int, MTrack>& tracks)
+void splitTrackDrumVoices(MTrack& mtrack)
 {
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
-        auto& chords = mtrack.chords;
-        if (chords.empty()) {
-            continue;
-        }
-        const Drumset* const drumset = mtrack.mtrack->drumTrack() ? smDrumset : 0;
-        if (!drumset) {
-            continue;
-        }
-        // all chords of drum track should have voice == 0
-        // because allowedVoices == V_1 (see MidiImportOperations)
-        // also, all chords should have different onTime values
+    auto& chords = mtrack.chords;
+    const Drumset* const drumset = smDrumset;
+    // all chords of drum track should have voice == 0
+    // because allowedVoices == V_1 (see MidiImportOperations)
+    // also, all chords should have different onTime values
 #ifdef QT_DEBUG
-        Q_ASSERT_X(MChord::areOnTimeValuesDifferent(chords),
-                   "MidiDrum::splitDrumVoices",
-                   "onTime values of chords are equal but should be different");
-        Q_ASSERT_X(haveNonZeroVoices(chords),
-                   "MidiDrum::splitDrumVoices",
-                   "All voices of drum track should be zero here");
+    Q_ASSERT_X(MChord::areOnTimeValuesDifferent(chords),
+               "MidiDrum::splitDrumVoices",
+               "onTime values of chords are equal but should be different");
+    Q_ASSERT_X(haveNonZeroVoices(chords),
+               "MidiDrum::splitDrumVoices",
+               "All voices of drum track should be zero here");
 #endif
-        for (auto chordIt = chords.begin(); chordIt != chords.end(); ++chordIt) {
-            auto& notes = chordIt->second.notes;
-            // search for the drumset pitches with voice = 1
-            QSet<int> notesToMove;
-            for (int i = 0; i != notes.size(); ++i) {
-                const int pitch = notes[i].pitch;
-                if (drumset->isValid(pitch) && drumset->voice(pitch) == 1) {
-                    notesToMove.insert(i);
-                }
-            }
-            if (notesToMove.isEmpty()) {
-                continue;
+    for (auto chordIt = chords.begin(); chordIt != chords.end(); ++chordIt) {
+        auto& notes = chordIt->second.notes;
+        // search for the drumset pitches with voice = 1
+        QSet<int> notesToMove;
+        for (int i = 0; i != notes.size(); ++i) {
+            const int pitch = notes[i].pitch;
+            if (drumset->isValid(pitch) && drumset->voice(pitch) == 1) {
+                notesToMove.insert(i);
             }
-
-            splitChord(chordIt, notesToMove, chords);
         }
+        if (notesToMove.isEmpty()) {
+            continue;
+        }
+
+        splitChord(chordIt, notesToMove, chords);
     }
 }
 
+void splitDrumVoices(std::multimap<int, MTrack>& tracks)
+{
+    if (!smDrumset) {
+        return;
+    }
+    std::vector<MTrack*> drumTracks = MidiConcurrent::tracksToProcess(
+        tracks, MidiConcurrent::TrackFilter::ONLY_DRUMS);
+
+    MidiConcurrent::forEach(drumTracks, [](MTrack* mtrack) {
+        splitTrackDrumVoices(*mtrack);
+    });
+}
+
 MTrack& getNewTrack(std::map<int, MTrack>& newTracks,
                     const MTrack& drumTrack,
                     int pitch)
@@ -167,19 +172,33 @@ std::map<int, MTrack> splitDrumTrack(const MTrack& drumTrack)
 
 void splitDrumTracks(std::multimap<int, MTrack>& tracks)
 {
+    struct TrackSplit {
+        std::multimap<int, MTrack>::iterator track;
+        std::map<int, MTrack> newTracks;
+    };
+    std::vector<TrackSplit> splits;
+
+    const auto& opers = midiImportOperations.data()->trackOpers;
     for (auto it = tracks.begin(); it != tracks.end(); ++it) {
         if (!it->second.mtrack->drumTrack() || it->second.chords.empty()) {
             continue;
         }
-        const auto& opers = midiImportOperations.data()->trackOpers;
-        if (!opers.doStaffSplit.value(it->second.indexOfOperation)) {
-            continue;
+        if (opers.doStaffSplit.value(it->second.indexOfOperation)) {
+            splits.push_back({ it, {} });
         }
-        const std::map<int, MTrack> newTracks = splitDrumTrack(it->second);
-        const int trackIndex = it->first;
-        it = tracks.erase(it);
-        for (auto i = newTracks.rbegin(); i != newTracks.rend(); ++i) {
-            it = tracks.insert({ trackIndex, i->second });
+    }
+
+    // new tracks are created concurrently and then replace
+    // the original drum tracks in the order of the track list
+    MidiConcurrent::forEach(splits, [](TrackSplit& split) {
+        split.newTracks = splitDrumTrack(split.track->second);
+    });
+
+    for (const TrackSplit& split: splits) {
+        const int trackIndex = split.track->first;
+        tracks.erase(split.track);
+        for (auto i = split.newTracks.rbegin(); i != split.newTracks.rend(); ++i) {
+            tracks.insert({ trackIndex, i->second });
         }
     }
 }
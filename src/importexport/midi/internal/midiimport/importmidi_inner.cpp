@@ -299,4 +299,30 @@ double durationCount(const QList<std::pair<ReducedFraction, TDuration> >& durati
     return count;
 }
 } // namespace MidiDuration
+
+namespace MidiSearch {
+thread_local const TimeBudget* TimeBudget::_currentBudget = nullptr;
+
+TimeBudget::TimeBudget(int msecs)
+    : _deadline(std::chrono::steady_clock::now() + std::chrono::milliseconds(msecs))
+    , _isLimited(msecs > 0)
+    , _prevBudget(_currentBudget)
+{
+    _currentBudget = this;
+}
+
+TimeBudget::~TimeBudget()
+{
+    _currentBudget = _prevBudget;
+}
+
+bool TimeBudget::isExceeded()
+{
+    const TimeBudget* budget = _currentBudget;
+    if (!budget || !budget->_isLimited) {
+        return false;
+    }
+    return std::chrono::steady_clock::now() >= budget->_deadline;
+}
+} // namespace MidiSearch
 } // namespace Ms
@@ -30,8 +30,10 @@
 #include "engraving/types/types.h"
 
 #include <vector>
+#include <map>
 #include <cstddef>
 #include <utility>
+#include <chrono>
 
 // ---------------------------------------------------------------------------------------
 // These inner classes definitions are used in cpp files only
@@ -159,6 +161,50 @@ ReducedFraction findBarStart(const ReducedFraction& time, const TimeSigMap* sigm
 namespace MidiDuration {
 double durationCount(const QList<std::pair<ReducedFraction, TDuration> >& durations);
 } // namespace MidiDuration
+
+namespace MidiSearch {
+// scoped time limit for combinatorial searches (tuplets, voices) of the current thread;
+// when it is exceeded the searches stop and use the best solution found so far
+class TimeBudget
+{
+public:
+    explicit TimeBudget(int msecs);                 // msecs <= 0 - no limit
+    ~TimeBudget();
+
+    static bool isExceeded();
+
+private:
+    TimeBudget(const TimeBudget&) = delete;
+    TimeBudget& operator=(const TimeBudget&) = delete;
+
+    std::chrono::steady_clock::time_point _deadline;
+    bool _isLimited;
+    const TimeBudget* _prevBudget;
+
+    static thread_local const TimeBudget* _currentBudget;
+};
+
+// remembers the values of an expensive function for the keys it was already called with
+template<typename Key, typename Value>
+class Memo
+{
+public:
+    template<typename Func>
+    const Value& value(const Key& key, Func calculate)
+    {
+        auto it = _values.find(key);
+        if (it == _values.end()) {
+            it = _values.insert({ key, calculate() }).first;
+        }
+        return it->second;
+    }
+
+    size_t size() const { return _values.size(); }
+
+private:
+    std::map<Key, Value> _values;
+};
+} // namespace MidiSearch
 } // namespace Ms
 
 #endif // IMPORTMIDI_INNER_H
@@ -24,6 +24,7 @@
 #include "importmidi_fraction.h"
 #include "importmidi_chord.h"
 #include "importmidi_operations.h"
+#include "importmidi_concurrent.h"
 
 namespace Ms {
 namespace LRHand {
@@ -384,21 +385,14 @@ std::vector<ChordSplitData> findSplits(std::multimap<ReducedFraction, MidiChord>
     return splits;
 }
 
-void insertNewLeftHandTrack(std::multimap<int, MTrack>& tracks,
-                            std::multimap<int, MTrack>::iterator& it,
-                            const std::multimap<ReducedFraction, MidiChord>& leftHandChords)
-{
-    auto leftHandTrack = it->second;
-    leftHandTrack.chords = leftHandChords;
-    it = tracks.insert({ it->first, leftHandTrack });
-}
-
 // maybe todo later: if range of right-hand chords > OCTAVE
 // => assign all bottom right-hand chords to another, third track
 
-void splitStaff(std::multimap<int, MTrack>& tracks, std::multimap<int, MTrack>::iterator& it)
+// moves left-hand chords of the track to leftHandChords,
+// only the given track is modified
+void splitStaff(MTrack& track, std::multimap<ReducedFraction, MidiChord>& leftHandChords)
 {
-    auto& chords = it->second.chords;
+    auto& chords = track.chords;
     if (chords.empty()) {
         return;
     }
@@ -407,12 +401,7 @@ void splitStaff(std::multimap<int, MTrack>& tracks, std::multimap<int, MTrack>::
 
     Q_ASSERT_X(!splits.empty(), "LRHand::splitStaff", "Empty splits array");
 
-    std::multimap<ReducedFraction, MidiChord> leftHandChords;
     splitChords(splits, leftHandChords, chords);
-
-    if (!leftHandChords.empty()) {
-        insertNewLeftHandTrack(tracks, it, leftHandChords);
-    }
 }
 
 void addNewLeftHandChord(std::multimap<ReducedFraction, MidiChord>& leftHandChords,
@@ -426,19 +415,38 @@ void addNewLeftHandChord(std::multimap<ReducedFraction, MidiChord>& leftHandChor
 
 void splitIntoLeftRightHands(std::multimap<int, MTrack>& tracks)
 {
+    struct TrackSplit {
+        std::multimap<int, MTrack>::iterator track;
+        std::multimap<ReducedFraction, MidiChord> leftHandChords;
+    };
+    std::vector<TrackSplit> splits;
+
+    const auto& opers = midiImportOperations.data()->trackOpers;
     for (auto it = tracks.begin(); it != tracks.end(); ++it) {
         if (it->second.mtrack->drumTrack() || it->second.chords.empty()) {
             continue;
         }
-        const auto& opers = midiImportOperations.data()->trackOpers;
-        // iterator 'it' will change after track split to ++it
+        if (opers.doStaffSplit.value(it->second.indexOfOperation)) {
+            splits.push_back({ it, {} });
+        }
+    }
+
+    // tracks are split independently of each other
+    MidiConcurrent::forEach(splits, [](TrackSplit& split) {
+        splitStaff(split.track->second, split.leftHandChords);
+    });
+
+    for (TrackSplit& split: splits) {
+        if (split.leftHandChords.empty()) {
+            continue;
+        }
         // C++11 guarantees that newly inserted item with equal key will go after:
         //    "The relative ordering of elements with equivalent keys is preserved,
         //     and newly inserted elements follow those with equivalent keys
         //     already in the container"
-        if (opers.doStaffSplit.value(it->second.indexOfOperation)) {
-            splitStaff(tracks, it);
-        }
+        auto leftHandTrack = split.track->second;
+        leftHandTrack.chords = std::move(split.leftHandChords);
+        tracks.insert({ split.track->first, leftHandTrack });
     }
 }
 } // namespace LRHand
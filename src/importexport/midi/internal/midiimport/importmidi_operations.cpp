@@ -27,6 +27,7 @@
 
 namespace Ms {
 MidiOperations::Data midiImportOperations;
+thread_local int MidiOperations::Data::_currentTrack = -1;
 
 namespace MidiOperations {
 static int readBoolFromXml(QXmlStreamReader& xml)
@@ -223,6 +223,8 @@ struct FileData
     QByteArray HHeaderData;
     QByteArray VHeaderData;
     int trackCount = 0;
+    // time limit of tuplet and voice searches per track, msecs; 0 - no limit
+    int searchTimeBudget = 0;
     Opers trackOpers;
     QString charset = MidiCharset::defaultCharset();
     // after the user apply MIDI import operations
@@ -256,7 +258,9 @@ private:
 
     QString _currentMidiFile;
     QString _midiOperationsFile;
-    int _currentTrack = -1;
+    // per-track import passes run concurrently,
+    // so each thread keeps its own current track
+    static thread_local int _currentTrack;
 
     std::map<QString, FileData> _data;      // <file name, tracks data>
 };
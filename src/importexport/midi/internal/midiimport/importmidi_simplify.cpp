@@ -28,6 +28,7 @@
 #include "importmidi_voice.h"
 #include "importmidi_operations.h"
 #include "importmidi_tuplet_voice.h"
+#include "importmidi_concurrent.h"
 #include "../midishared/midifile.h"
 
 #include "engraving/libmscore/sig.h"
@@ -283,34 +284,32 @@ void simplifyDurations(
 {
     auto& opers = midiImportOperations;
 
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
-        if (mtrack.mtrack->drumTrack() != simplifyDrumTracks) {
-            continue;
-        }
-        auto& chords = track.second.chords;
-        if (chords.empty()) {
-            continue;
+    std::vector<MTrack*> tracksToSimplify = MidiConcurrent::tracksToProcess(
+        tracks, simplifyDrumTracks ? MidiConcurrent::TrackFilter::ONLY_DRUMS
+        : MidiConcurrent::TrackFilter::NO_DRUMS);
+
+    MidiConcurrent::forEach(tracksToSimplify, [&opers, sigmap](MTrack* mtrack) {
+        if (!opers.data()->trackOpers.simplifyDurations.value(mtrack->indexOfOperation)) {
+            return;
         }
+        auto& chords = mtrack->chords;
 
-        if (opers.data()->trackOpers.simplifyDurations.value(mtrack.indexOfOperation)) {
-            MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
+        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack->indexOfOperation };
 #ifdef QT_DEBUG
-            Q_ASSERT_X(MidiTuplet::areTupletRangesOk(chords, mtrack.tuplets),
-                       "Simplify::simplifyDurations", "Tuplet chord/note is outside tuplet "
-                                                      "or non-tuplet chord/note is inside tuplet before simplification");
+        Q_ASSERT_X(MidiTuplet::areTupletRangesOk(chords, mtrack->tuplets),
+                   "Simplify::simplifyDurations", "Tuplet chord/note is outside tuplet "
+                                                  "or non-tuplet chord/note is inside tuplet before simplification");
 #endif
 
-            minimizeNumberOfRests(chords, sigmap, mtrack.tuplets, mtrack.mtrack->drumTrack());
-            // empty tuplets may appear after simplification
-            MidiTuplet::removeEmptyTuplets(mtrack);
+        minimizeNumberOfRests(chords, sigmap, mtrack->tuplets, mtrack->mtrack->drumTrack());
+        // empty tuplets may appear after simplification
+        MidiTuplet::removeEmptyTuplets(*mtrack);
 #ifdef QT_DEBUG
-            Q_ASSERT_X(MidiTuplet::areTupletRangesOk(chords, mtrack.tuplets),
-                       "Simplify::simplifyDurations", "Tuplet chord/note is outside tuplet "
-                                                      "or non-tuplet chord/note is inside tuplet after simplification");
+        Q_ASSERT_X(MidiTuplet::areTupletRangesOk(chords, mtrack->tuplets),
+                   "Simplify::simplifyDurations", "Tuplet chord/note is outside tuplet "
+                                                  "or non-tuplet chord/note is inside tuplet after simplification");
 #endif
-        }
-    }
+    });
 }
 
 void simplifyDurationsForDrums(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap)
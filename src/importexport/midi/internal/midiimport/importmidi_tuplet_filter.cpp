@@ -28,6 +28,10 @@
 #include "libmscore/mscore.h"
 
 #include <set>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <cstdint>
 
 namespace Ms {
 namespace MidiTuplet {
@@ -82,6 +86,79 @@ private:
     size_t tupletCount;
 };
 
+typedef std::pair<const ReducedFraction, MidiChord>* ChordPtr;
+typedef std::pair<int64_t, int64_t> IntInterval;
+typedef std::pair<ReducedFraction, ReducedFraction> FractionInterval;
+// <chord, on time quantization error> of every tuplet chord
+typedef std::vector<std::vector<std::pair<ChordPtr, ReducedFraction> > > TupletChordErrors;
+
+// tuplet data that doesn't change during the search of the best tuplet combination,
+// it's prepared once instead of being recalculated at every search step;
+// intervals are integer (IntInterval) instead of slow overflow-checked fractions
+// unless their common denominator is too large (then FractionInterval)
+
+template<typename Interval>
+struct TupletSearchData
+{
+    std::vector<Interval> intervals;
+    TupletChordErrors chordErrors;
+};
+
+// all bounds are multiplied by their common denominator;
+// for MIDI import it's small: a divisor of whole note ticks multiplied by tuplet numbers,
+// returns false if it doesn't fit into int, then the integer bounds can overflow
+
+bool toIntIntervals(
+    const std::vector<std::pair<ReducedFraction, ReducedFraction> >& intervals,
+    std::vector<IntInterval>& result)
+{
+    const int64_t maxDenominator = std::numeric_limits<int>::max();
+    int64_t commonDenominator = 1;
+    for (const auto& interval: intervals) {
+        // both lcm arguments are not greater than max int, so lcm itself doesn't overflow int64
+        commonDenominator = std::lcm(commonDenominator, int64_t(qAbs(interval.first.denominator())));
+        commonDenominator = std::lcm(commonDenominator, int64_t(qAbs(interval.second.denominator())));
+        if (commonDenominator > maxDenominator) {
+            return false;
+        }
+    }
+
+    const auto toInt = [commonDenominator](const ReducedFraction& value) -> int64_t {
+        return int64_t(value.numerator()) * (commonDenominator / value.denominator());
+    };
+
+    result.clear();
+    result.reserve(intervals.size());
+    for (const auto& interval: intervals) {
+        result.push_back({ toInt(interval.first), toInt(interval.second) });
+    }
+    return true;
+}
+
+TupletChordErrors findTupletChordErrors(
+    const std::vector<TupletInfo>& tuplets,
+    const ReducedFraction& basicQuant)
+{
+    TupletChordErrors chordErrors(tuplets.size());
+    for (size_t i = 0; i != tuplets.size(); ++i) {
+        for (const auto& chord: tuplets[i].chords) {
+            chordErrors[i].push_back(
+                { &*chord.second, Quantize::findOnTimeQuantError(*chord.second, basicQuant) });
+        }
+    }
+    return chordErrors;
+}
+
+bool haveIntersection(const IntInterval& interval, const std::vector<IntInterval>& intervals)
+{
+    for (const auto& i: intervals) {
+        if (i.second > interval.first && i.first < interval.second) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool haveCommonChords(int i, int j, const std::vector<TupletInfo>& tuplets)
 {
     if (tuplets.empty()) {
@@ -265,13 +342,13 @@ TupletErrorResult findTupletError(
     const std::vector<int>& tupletIndexes,
     const std::vector<TupletInfo>& tuplets,
     size_t voiceCount,
-    const ReducedFraction& basicQuant)
+    const TupletChordErrors& chordErrors)
 {
     ReducedFraction sumError{ 0, 1 };
     ReducedFraction sumLengthOfRests{ 0, 1 };
     size_t sumChordCount = 0;
     int sumChordPlaces = 0;
-    std::set<std::pair<const ReducedFraction, MidiChord>*> usedChords;
+    std::vector<ChordPtr> usedChords;
     std::vector<char> usedIndexes(tuplets.size(), 0);
 
     for (int i: tupletIndexes) {
@@ -284,20 +361,20 @@ TupletErrorResult findTupletError(
 
         usedIndexes[i] = 1;
         for (const auto& chord: tuplet.chords) {
-            usedChords.insert(&*chord.second);
+            usedChords.push_back(&*chord.second);
         }
     }
+    std::sort(usedChords.begin(), usedChords.end());
     // add quant error of all chords excluded from tuplets
     for (size_t i = 0; i != tuplets.size(); ++i) {
         if (usedIndexes[i]) {
             continue;
         }
-        const auto& tuplet = tuplets[i];
-        for (const auto& chord: tuplet.chords) {
-            if (usedChords.find(&*chord.second) != usedChords.end()) {
+        for (const auto& chordError: chordErrors[i]) {
+            if (std::binary_search(usedChords.begin(), usedChords.end(), chordError.first)) {
                 continue;
             }
-            sumError += Quantize::findOnTimeQuantError(*chord.second, basicQuant);
+            sumError += chordError.second;
         }
     }
 
@@ -343,10 +420,11 @@ bool areCommonsUncommon(const std::vector<int>& selectedCommons,
 
 #endif
 
+template<typename Interval>
 int findAvailableVoice(
     size_t tupletIndex,
-    const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals,
-    const std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >& voiceIntervals)
+    const std::vector<Interval>& tupletIntervals,
+    const std::map<int, std::vector<Interval> >& voiceIntervals)
 {
     int voice = 0;
     while (true) {
@@ -397,11 +475,12 @@ std::vector<int> findUnusedIndexes(const std::vector<int>& selectedTuplets)
     return unusedIndexes;
 }
 
+template<typename Interval>
 bool canUseIndex(
     int indexToCheck,
     const std::vector<TupletInfo>& tuplets,
-    const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals,
-    const std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >& voiceIntervals,
+    const std::vector<Interval>& tupletIntervals,
+    const std::map<int, std::vector<Interval> >& voiceIntervals,
     const std::map<std::pair<const ReducedFraction, MidiChord>*, int>& usedFirstChords)
 {
     const auto& tuplet = tuplets[indexToCheck];
@@ -467,30 +546,32 @@ bool validateSelectedTuplets(Iter beginIt,
 
 #endif
 
+template<typename Interval>
 void tryUpdateBestIndexes(
     std::vector<int>& bestTupletIndexes,
     TupletErrorResult& minCurrentError,
     const std::vector<int>& selectedTuplets,
     const std::vector<TupletInfo>& tuplets,
-    const std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >& voiceIntervals,
-    const ReducedFraction& basicQuant)
+    const std::map<int, std::vector<Interval> >& voiceIntervals,
+    const TupletSearchData<Interval>& searchData)
 {
     const size_t voiceCount = voiceIntervals.size();
     const auto error = findTupletError(selectedTuplets, tuplets,
-                                       voiceCount, basicQuant);
+                                       voiceCount, searchData.chordErrors);
     if (!minCurrentError.isInitialized() || error < minCurrentError) {
         minCurrentError = error;
         bestTupletIndexes = selectedTuplets;
     }
 }
 
-std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >
+template<typename Interval>
+std::map<int, std::vector<Interval> >
 prepareVoiceIntervals(
     const std::vector<int>& selectedTuplets,
-    const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals)
+    const std::vector<Interval>& tupletIntervals)
 {
     // <voice, intervals>
-    std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > > voiceIntervals;
+    std::map<int, std::vector<Interval> > voiceIntervals;
     for (int i: selectedTuplets) {
         int voice = findAvailableVoice(i, tupletIntervals, voiceIntervals);
         voiceIntervals[voice].push_back(tupletIntervals[i]);
@@ -573,6 +654,7 @@ private:
     int first_;
 };
 
+template<typename Interval>
 void findNextTuplet(
     std::vector<int>& selectedTuplets,
     ValidTuplets& validTuplets,
@@ -580,11 +662,16 @@ void findNextTuplet(
     TupletErrorResult& minCurrentError,
     const std::vector<TupletCommon>& tupletCommons,
     const std::vector<TupletInfo>& tuplets,
-    const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals,
-    size_t commonsSize,
-    const ReducedFraction& basicQuant)
+    const TupletSearchData<Interval>& searchData,
+    size_t commonsSize)
 {
+    const auto& tupletIntervals = searchData.intervals;
+
     while (!validTuplets.empty()) {
+        if (minCurrentError.isInitialized() && MidiSearch::TimeBudget::isExceeded()) {
+            // stop the search, the best found combination will be used
+            return;
+        }
         size_t index = validTuplets.first();
 
         bool isCommonGroupBegins = (selectedTuplets.empty() && index == commonsSize);
@@ -621,7 +708,7 @@ void findNextTuplet(
             }
             if (!canAddMoreIndexes) {
                 tryUpdateBestIndexes(bestTupletIndexes, minCurrentError,
-                                     selectedTuplets, tuplets, voiceIntervals, basicQuant);
+                                     selectedTuplets, tuplets, voiceIntervals, searchData);
             }
             return;
         }
@@ -658,11 +745,11 @@ void findNextTuplet(
             }
             if (!canAddMoreIndexes) {
                 tryUpdateBestIndexes(bestTupletIndexes, minCurrentError,
-                                     selectedTuplets, tuplets, voiceIntervals, basicQuant);
+                                     selectedTuplets, tuplets, voiceIntervals, searchData);
             }
         } else {
             findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                           tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
+                           tupletCommons, tuplets, searchData, commonsSize);
         }
 
         selectedTuplets.pop_back();
@@ -697,12 +784,23 @@ std::vector<int> findBestTuplets(
     std::vector<int> bestTupletIndexes;
     std::vector<int> selectedTuplets;
     TupletErrorResult minCurrentError;
-    const auto tupletIntervals = findTupletIntervals(tuplets, basicQuant);
-
     ValidTuplets validTuplets(int(tuplets.size()));
 
-    findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                   tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
+    std::vector<FractionInterval> tupletIntervals = findTupletIntervals(tuplets, basicQuant);
+
+    TupletSearchData<IntInterval> intSearchData;
+    if (toIntIntervals(tupletIntervals, intSearchData.intervals)) {
+        intSearchData.chordErrors = findTupletChordErrors(tuplets, basicQuant);
+        findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
+                       tupletCommons, tuplets, intSearchData, commonsSize);
+    } else {
+        // the integer bounds could overflow, the same search is done with fractions
+        TupletSearchData<FractionInterval> fractionSearchData;
+        fractionSearchData.intervals = std::move(tupletIntervals);
+        fractionSearchData.chordErrors = findTupletChordErrors(tuplets, basicQuant);
+        findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
+                       tupletCommons, tuplets, fractionSearchData, commonsSize);
+    }
 
     return bestTupletIndexes;
 }
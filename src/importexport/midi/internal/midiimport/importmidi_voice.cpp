@@ -21,6 +21,9 @@
  */
 #include "importmidi_voice.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include <QSet>
 
 #include "importmidi_tuplet.h"
@@ -28,6 +31,7 @@
 #include "importmidi_chord.h"
 #include "importmidi_meter.h"
 #include "importmidi_operations.h"
+#include "importmidi_concurrent.h"
 #include "libmscore/sig.h"
 #include "libmscore/mscore.h"
 #include "libmscore/durationtype.h"
@@ -401,6 +405,7 @@ std::vector<VoiceSplit> findPossibleVoiceSplits(
     const std::multimap<ReducedFraction, MidiTuplet::TupletData>& tuplets,
     const std::multimap<ReducedFraction,
                         std::multimap<ReducedFraction, MidiTuplet::TupletData>::iterator>& insertedTuplets,
+    const ReducedFraction& maxChordLength,
     int maxOccupiedVoice)
 {
     std::vector<VoiceSplit> splits;
@@ -432,8 +437,6 @@ std::vector<VoiceSplit> findPossibleVoiceSplits(
         }
     }
 
-    const ReducedFraction maxChordLength = MChord::findMaxChordLength(chords);
-
     if (splitPoint > 0) {
         addGroupSplits(splits, maxChordLength, chords, tuplets, insertedTuplets,
                        tupletOnTime, onTime, lowGroupOffTime, origVoice,
@@ -536,23 +539,35 @@ VoiceSplit findBestSplit(
                                   std::numeric_limits<int>::max() };
     int bestSplit = -1;
 
+    const auto& notes = chordIt->second.notes;
+    const int averageLowPitch = (splitPoint > 0)
+                                ? findAverageLowPitch(notes, splitPoint) : 0;
+    const int averageHighPitch = (splitPoint < notes.size())
+                                 ? findAverageHighPitch(notes, splitPoint) : 0;
+
+    // different splits often check the same voices,
+    // so remember pitch distances: <average pitch, voice> -> distance
+    MidiSearch::Memo<std::pair<int, int>, int> pitchDists;
+    const auto minPitchDist = [&](int averagePitch, int voice) {
+        return pitchDists.value({ averagePitch, voice }, [&]() {
+            return findMinPitchDist(averagePitch, voice, chordIt, chords);
+        });
+    };
+
     for (size_t i = 0; i != possibleSplits.size(); ++i) {
         const int voice = possibleSplits[i].voice;
-        const auto& notes = chordIt->second.notes;
         int totalPitchDist = 0;
 
         if (splitPoint > 0) {
-            const int averageLowPitch = findAverageLowPitch(notes, splitPoint);
             const int lowVoice = (possibleSplits[i].group == MovedVoiceGroup::LOW)
                                  ? voice : chordIt->second.voice;
-            totalPitchDist += findMinPitchDist(averageLowPitch, lowVoice, chordIt, chords);
+            totalPitchDist += minPitchDist(averageLowPitch, lowVoice);
         }
 
         if (splitPoint < notes.size()) {
-            const int averageHighPitch = findAverageHighPitch(notes, splitPoint);
             const int highVoice = (possibleSplits[i].group == MovedVoiceGroup::HIGH)
                                   ? voice : chordIt->second.voice;
-            totalPitchDist += findMinPitchDist(averageHighPitch, highVoice, chordIt, chords);
+            totalPitchDist += minPitchDist(averageHighPitch, highVoice);
         }
 
         const std::pair<int, int> error{ totalPitchDist, voice };
@@ -910,6 +925,10 @@ bool doVoiceSeparation(
     std::map<int, int> maxOccupiedVoices;     // <bar index, max occupied voice>
 
     for (auto it = chords.begin(); it != chords.end(); ++it) {
+        if (MidiSearch::TimeBudget::isExceeded()) {
+            // keep the voices of the remaining chords as they are
+            break;
+        }
         MidiChord& chord = it->second;
         auto& notes = chord.notes;
 
@@ -923,9 +942,11 @@ bool doVoiceSeparation(
             const int maxVoice = findMaxOccupiedVoiceInBar(it, chords);
             maxVoiceIt = maxOccupiedVoices.insert({ chord.barIndex, maxVoice }).first;
         }
+        // max chord length stays valid (as an upper bound) after chord splits
+        // so it's not recalculated for every chord
         const auto possibleSplits = findPossibleVoiceSplits(
             chord.voice, it, splitPoint, chords,
-            tuplets, insertedTuplets, maxVoiceIt->second);
+            tuplets, insertedTuplets, maxChordLength, maxVoiceIt->second);
         if (possibleSplits.empty()) {
             continue;
         }
@@ -1060,62 +1081,65 @@ void sortVoices(
     }
 }
 
-bool separateVoices(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap)
+bool separateTrackVoices(MTrack& mtrack, const TimeSigMap* sigmap)
 {
     auto& opers = midiImportOperations;
-    bool changed = false;
-
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
-        if (mtrack.mtrack->drumTrack()) {
-            continue;
-        }
-        auto& chords = track.second.chords;
-        if (chords.empty()) {
-            continue;
-        }
-        const auto userVoiceCount = toIntVoiceCount(
-            opers.data()->trackOpers.maxVoiceCount.value(mtrack.indexOfOperation));
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
+    const auto userVoiceCount = toIntVoiceCount(
+        opers.data()->trackOpers.maxVoiceCount.value(mtrack.indexOfOperation));
+    if (userVoiceCount <= 1 || static_cast<int>(userVoiceCount) > voiceLimit()) {
+        return false;
+    }
+    // pass current track index through MidiImportOperations
+    // for further usage
+    MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
+    MidiSearch::TimeBudget searchTimeBudget{ opers.data()->searchTimeBudget };
 
-        if (userVoiceCount > 1 && static_cast<int>(userVoiceCount) <= voiceLimit()) {
 #ifdef QT_DEBUG
-            Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
-                       "MidiVoice::separateVoices",
-                       "Not all tuplets are referenced in chords or notes "
-                       "before voice separation");
-            Q_ASSERT_X(areVoicesSame(mtrack.chords),
-                       "MidiVoice::separateVoices", "Different voices of chord and tuplet "
-                                                    "before voice separation");
+    Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
+               "MidiVoice::separateVoices",
+               "Not all tuplets are referenced in chords or notes "
+               "before voice separation");
+    Q_ASSERT_X(areVoicesSame(mtrack.chords),
+               "MidiVoice::separateVoices", "Different voices of chord and tuplet "
+                                            "before voice separation");
 #endif
-            if (doVoiceSeparation(mtrack.chords, sigmap, mtrack.tuplets)) {
-                changed = true;
-            }
+    const bool changed = doVoiceSeparation(mtrack.chords, sigmap, mtrack.tuplets);
 #ifdef QT_DEBUG
-            Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
-                       "MidiVoice::separateVoices",
-                       "Not all tuplets are referenced in chords or notes "
-                       "after voice separation, before voice sort");
-            Q_ASSERT_X(areVoicesSame(mtrack.chords),
-                       "MidiVoice::separateVoices", "Different voices of chord and tuplet "
-                                                    "after voice separation, before voice sort");
+    Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
+               "MidiVoice::separateVoices",
+               "Not all tuplets are referenced in chords or notes "
+               "after voice separation, before voice sort");
+    Q_ASSERT_X(areVoicesSame(mtrack.chords),
+               "MidiVoice::separateVoices", "Different voices of chord and tuplet "
+                                            "after voice separation, before voice sort");
 #endif
-            sortVoices(mtrack.chords, sigmap);
+    sortVoices(mtrack.chords, sigmap);
 #ifdef QT_DEBUG
-            Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
-                       "MidiVoice::separateVoices",
-                       "Not all tuplets are referenced in chords or notes "
-                       "after voice sort");
-            Q_ASSERT_X(areVoicesSame(mtrack.chords),
-                       "MidiVoice::separateVoices", "Different voices of chord and tuplet "
-                                                    "after voice sort");
+    Q_ASSERT_X(MidiTuplet::areAllTupletsReferenced(mtrack.chords, mtrack.tuplets),
+               "MidiVoice::separateVoices",
+               "Not all tuplets are referenced in chords or notes "
+               "after voice sort");
+    Q_ASSERT_X(areVoicesSame(mtrack.chords),
+               "MidiVoice::separateVoices", "Different voices of chord and tuplet "
+                                            "after voice sort");
 #endif
-        }
-    }
-
     return changed;
 }
+
+bool separateVoices(std::multimap<int, MTrack>& tracks, const TimeSigMap* sigmap)
+{
+    std::vector<MTrack*> tracksToSeparate = MidiConcurrent::tracksToProcess(
+        tracks, MidiConcurrent::TrackFilter::NO_DRUMS);
+    // one flag per track to not share a single result between threads
+    std::vector<char> changedTracks(tracksToSeparate.size(), false);
+
+    std::vector<size_t> indexes(tracksToSeparate.size());
+    std::iota(indexes.begin(), indexes.end(), 0);
+    MidiConcurrent::forEach(indexes, [&](size_t i) {
+        changedTracks[i] = separateTrackVoices(*tracksToSeparate[i], sigmap);
+    });
+
+    return std::any_of(changedTracks.begin(), changedTracks.end(), [](char changed) { return changed; });
+}
 } // namespace MidiVoice
 } // namespace Ms
@@ -9,6 +9,8 @@ set (MIDIIMPORT_SRC
     ${CMAKE_CURRENT_LIST_DIR}/importmidi_chordname.h
     ${CMAKE_CURRENT_LIST_DIR}/importmidi_clef.cpp
     ${CMAKE_CURRENT_LIST_DIR}/importmidi_clef.h
+    ${CMAKE_CURRENT_LIST_DIR}/importmidi_concurrent.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/importmidi_concurrent.h
     ${CMAKE_CURRENT_LIST_DIR}/importmidi.cpp
     ${CMAKE_CURRENT_LIST_DIR}/importmidi_drum.cpp
     ${CMAKE_CURRENT_LIST_DIR}/importmidi_drum.h
@@ -23,6 +23,9 @@
 #define INNER_FUNC_DECL_H
 
 #include <set>
+#include <vector>
+#include <utility>
+#include <cstdint>
 
 namespace Ms {
 class MidiChord;
@@ -44,6 +47,9 @@ TupletInfo findTupletApproximation(const ReducedFraction& tupletLen, int tupletN
 void splitFirstTupletChords(std::vector<TupletInfo>& tuplets, std::multimap<ReducedFraction, MidiChord>& chords);
 
 std::set<int> findLongestUncommonGroup(const std::vector<TupletInfo>& tuplets, const ReducedFraction& basicQuant);
+
+bool toIntIntervals(const std::vector<std::pair<ReducedFraction, ReducedFraction> >& intervals,
+                    std::vector<std::pair<int64_t, int64_t> >& result);
 } // namespace MidiTuplet
 
 namespace Meter {
@@ -0,0 +1,251 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/qtestsuite.h"
+
+#include <thread>
+
+#include <QElapsedTimer>
+
+#include "inner_func_decl.h"
+#include "importexport/midi/internal/midiimport/importmidi_inner.h"
+#include "importexport/midi/internal/midiimport/importmidi_fraction.h"
+#include "importexport/midi/internal/midiimport/importmidi_operations.h"
+#include "engraving/compat/scoreaccess.h"
+#include "libmscore/masterscore.h"
+
+#include "log.h"
+
+using namespace Ms;
+using namespace mu::engraving;
+
+namespace Ms {
+extern Score::FileError importMidi(MasterScore*, const QString&);
+}
+
+//---------------------------------------------------------
+//   TestImportMidiSearch
+//   limits and caches of the tuplet and voice searches
+//---------------------------------------------------------
+
+class TestImportMidiSearch : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void timeBudgetNoLimit();
+    void timeBudgetExceeded();
+    void timeBudgetNested();
+    void timeBudgetPerThread();
+    void intIntervals();
+    void intIntervalsOverflow();
+    void memo();
+    void denseHumanTupletsTiming();
+};
+
+//---------------------------------------------------------
+//   timeBudgetNoLimit
+//---------------------------------------------------------
+
+void TestImportMidiSearch::timeBudgetNoLimit()
+{
+    QVERIFY(!MidiSearch::TimeBudget::isExceeded());
+
+    MidiSearch::TimeBudget budget(0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    QVERIFY(!MidiSearch::TimeBudget::isExceeded());
+}
+
+//---------------------------------------------------------
+//   timeBudgetExceeded
+//---------------------------------------------------------
+
+void TestImportMidiSearch::timeBudgetExceeded()
+{
+    {
+        MidiSearch::TimeBudget budget(60 * 1000);
+        QVERIFY(!MidiSearch::TimeBudget::isExceeded());
+    }
+    {
+        MidiSearch::TimeBudget budget(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        QVERIFY(MidiSearch::TimeBudget::isExceeded());
+    }
+    // the budget is over when it goes out of scope
+    QVERIFY(!MidiSearch::TimeBudget::isExceeded());
+}
+
+//---------------------------------------------------------
+//   timeBudgetNested
+//---------------------------------------------------------
+
+void TestImportMidiSearch::timeBudgetNested()
+{
+    MidiSearch::TimeBudget outerBudget(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    QVERIFY(MidiSearch::TimeBudget::isExceeded());
+    {
+        // the innermost budget is used
+        MidiSearch::TimeBudget innerBudget(0);
+        QVERIFY(!MidiSearch::TimeBudget::isExceeded());
+    }
+    QVERIFY(MidiSearch::TimeBudget::isExceeded());
+}
+
+//---------------------------------------------------------
+//   timeBudgetPerThread
+//---------------------------------------------------------
+
+void TestImportMidiSearch::timeBudgetPerThread()
+{
+    MidiSearch::TimeBudget budget(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    QVERIFY(MidiSearch::TimeBudget::isExceeded());
+
+    // tracks are processed concurrently, every thread has its own budget
+    bool isExceededInOtherThread = true;
+    std::thread thread([&isExceededInOtherThread]() {
+        isExceededInOtherThread = MidiSearch::TimeBudget::isExceeded();
+    });
+    thread.join();
+
+    QVERIFY(!isExceededInOtherThread);
+}
+
+//---------------------------------------------------------
+//   intIntervals
+//---------------------------------------------------------
+
+void TestImportMidiSearch::intIntervals()
+{
+    const std::vector<std::pair<ReducedFraction, ReducedFraction> > intervals = {
+        { ReducedFraction(1, 3), ReducedFraction(1, 2) },
+        { ReducedFraction(1, 2), ReducedFraction(5, 6) },
+        { ReducedFraction(0, 1), ReducedFraction(1, 4) }
+    };
+
+    std::vector<std::pair<int64_t, int64_t> > result;
+    QVERIFY(MidiTuplet::toIntIntervals(intervals, result));
+
+    // common denominator is 12
+    QCOMPARE(result.size(), intervals.size());
+    QVERIFY(result[0] == std::make_pair(int64_t(4), int64_t(6)));
+    QVERIFY(result[1] == std::make_pair(int64_t(6), int64_t(10)));
+    QVERIFY(result[2] == std::make_pair(int64_t(0), int64_t(3)));
+
+    // the order of bounds is the same as for the fractions
+    for (size_t i = 0; i != intervals.size(); ++i) {
+        for (size_t j = 0; j != intervals.size(); ++j) {
+            QCOMPARE(intervals[i].first < intervals[j].second, result[i].first < result[j].second);
+            QCOMPARE(intervals[i].second > intervals[j].first, result[i].second > result[j].first);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   intIntervalsOverflow
+//---------------------------------------------------------
+
+void TestImportMidiSearch::intIntervalsOverflow()
+{
+    // lcm of two primes close to 2^16 doesn't fit into int
+    const std::vector<std::pair<ReducedFraction, ReducedFraction> > intervals = {
+        { ReducedFraction(1, 65521), ReducedFraction(2, 65521) },
+        { ReducedFraction(1, 65519), ReducedFraction(2, 65519) }
+    };
+
+    std::vector<std::pair<int64_t, int64_t> > result;
+    QVERIFY(!MidiTuplet::toIntIntervals(intervals, result));
+}
+
+//---------------------------------------------------------
+//   memo
+//---------------------------------------------------------
+
+void TestImportMidiSearch::memo()
+{
+    MidiSearch::Memo<std::pair<int, int>, int> memo;
+    int callCount = 0;
+    const auto calculate = [&callCount](int value) {
+        return [&callCount, value]() {
+            ++callCount;
+            return value * 2;
+        };
+    };
+
+    QCOMPARE(memo.value({ 60, 1 }, calculate(60)), 120);
+    QCOMPARE(memo.value({ 62, 1 }, calculate(62)), 124);
+    QCOMPARE(callCount, 2);
+
+    // already calculated values are not recalculated
+    QCOMPARE(memo.value({ 60, 1 }, calculate(60)), 120);
+    QCOMPARE(memo.value({ 62, 1 }, calculate(62)), 124);
+    QCOMPARE(callCount, 2);
+
+    // the key is the whole pair
+    QCOMPARE(memo.value({ 60, 2 }, calculate(61)), 122);
+    QCOMPARE(callCount, 3);
+    QCOMPARE(memo.size(), size_t(3));
+}
+
+//---------------------------------------------------------
+//   denseHumanTupletsTiming
+//   48 bars of humanized 3-7-tuplets over 2-5-tuplet chords in one track,
+//   lots of overlapping tuplet candidates for the tuplet and voice searches
+//---------------------------------------------------------
+
+void TestImportMidiSearch::denseHumanTupletsTiming()
+{
+    const int SEARCH_TIME_BUDGET = 500;     // msecs per track
+    const qint64 MAX_IMPORT_TIME = 30 * 1000;
+
+    const QString path = QString(iex_midi_tests_DATA_ROOT) + "/data/search_dense_human_tuplets.mid";
+
+    auto& opers = midiImportOperations;
+    opers.addNewMidiFile(path);
+    {
+        MidiOperations::CurrentMidiFileSetter setCurrentMidiFile(opers, path);
+        opers.data()->searchTimeBudget = SEARCH_TIME_BUDGET;
+    }
+
+    MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+
+    QElapsedTimer timer;
+    timer.start();
+    const Score::FileError error = importMidi(score, path);
+    const qint64 elapsed = timer.elapsed();
+
+    LOGI() << "Import of " << path << ": " << elapsed << " ms";
+
+    const bool hasMeasures = score->firstMeasure() != nullptr;
+    delete score;
+    opers.excludeMidiFile(path);
+
+    QCOMPARE(error, Score::FileError::FILE_NO_ERROR);
+    QVERIFY(hasMeasures);
+    // the searches stop when the budget is over, the rest of the import is fast
+    QVERIFY(elapsed < MAX_IMPORT_TIME);
+}
+
+QTEST_MAIN(TestImportMidiSearch)
+
+#include "tst_importmidi_search.moc"
@@ -39,6 +39,10 @@ public:
     virtual bool musicxmlImportLayout() const = 0;
     virtual void setMusicxmlImportLayout(bool value) = 0;
 
+    //! NOTE Without schema validation only a lightweight structural check is done
+    virtual bool musicxmlImportSchemaValidation() const = 0;
+    virtual void setMusicxmlImportSchemaValidation(bool value) = 0;
+
     virtual bool musicxmlExportLayout() const = 0;
     virtual void setMusicxmlExportLayout(bool value) = 0;
 
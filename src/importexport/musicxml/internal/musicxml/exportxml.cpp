@@ -43,6 +43,9 @@
 #include <QBuffer>
 #include <QDate>
 #include <QRegularExpression>
+#ifndef Q_OS_WASM
+#include <QtConcurrent>
+#endif
 
 #include "containers.h"
 
@@ -271,6 +274,7 @@ class SlurHandler
 
 public:
     SlurHandler();
+    bool isEmpty() const;
     void doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml);
 
 private:
@@ -290,6 +294,7 @@ class GlissandoHandler
 
 public:
     GlissandoHandler();
+    bool isEmpty() const;
     void doGlissandoStart(Glissando* gliss, Notations& notations, XmlWriter& xml);
     void doGlissandoStop(Glissando* gliss, Notations& notations, XmlWriter& xml);
 };
@@ -333,10 +338,83 @@ struct MeasurePrintContext final
     const System* lastSystemPrevPage = nullptr;
 };
 
+//---------------------------------------------------------
+//   ResolvedTexts
+//    the plain and xml text of the texts written with the parts.
+//    TextBase::plainText() and TextBase::xmlText() clone a text
+//    whose layout or text is invalid, which adds the clone to the
+//    score, so the texts are resolved before the parts are written
+//    on the thread pool. Texts not resolved are read directly
+//---------------------------------------------------------
+
+class ResolvedTexts
+{
+public:
+    void resolve(const Score* score);
+    QString plainText(const TextBase* text) const;
+    QString xmlText(const TextBase* text) const;
+private:
+    void add(const EngravingItem* e);
+    QHash<const TextBase*, QString> _plainTexts;
+    QHash<const TextBase*, QString> _xmlTexts;
+};
+
+//---------------------------------------------------------
+//   ExportOptions
+//    the export preferences, read once by the thread calling
+//    ExportMusicXml::write(). The part exporters and the static
+//    helpers read this copy instead of the configurations, which
+//    must not be resolved or accessed from the thread pool
+//---------------------------------------------------------
+
+struct ExportOptions
+{
+    bool exportLayout = true;
+    IMusicXmlConfiguration::MusicxmlExportBreaksType exportBreaksType = IMusicXmlConfiguration::MusicxmlExportBreaksType::All;
+    bool exportInvisibleElements = false;
+    mu::draw::Color defaultColor;
+};
+
+static thread_local const ExportOptions* currentExportOptions = nullptr;
+
+//---------------------------------------------------------
+//   ExportOptionsScope
+//    make the options available to the current thread
+//---------------------------------------------------------
+
+class ExportOptionsScope
+{
+public:
+    ExportOptionsScope(const ExportOptions* options)
+        : m_previous(currentExportOptions)
+    {
+        currentExportOptions = options;
+    }
+
+    ~ExportOptionsScope()
+    {
+        currentExportOptions = m_previous;
+    }
+
+private:
+    const ExportOptions* m_previous = nullptr;
+};
+
+static const ExportOptions& exportOptions()
+{
+    IF_ASSERT_FAILED(currentExportOptions) {
+        static const ExportOptions defaultOptions;
+        return defaultOptions;
+    }
+    return *currentExportOptions;
+}
+
 //---------------------------------------------------------
 //   ExportMusicXml
 //---------------------------------------------------------
 
+static const QString SCORE_PARTWISE_TAG("score-partwise version=\"4.0\"");
+
 typedef QHash<const ChordRest* const, const Trill*> TrillHash;
 typedef QMap<const Instrument*, int> MxmlInstrumentMap;
 
@@ -364,6 +442,11 @@ class ExportMusicXml
     TrillHash _trillStart;
     TrillHash _trillStop;
     MxmlInstrumentMap instrMap;
+    ExportOptions _options;
+    QHash<const Measure*, Volta*> _leftVoltas;      // voltas starting at the start of a measure
+    QHash<const Measure*, Volta*> _rightVoltas;     // voltas stopping at the end of a measure
+    ResolvedTexts _texts;
+    bool _concurrentParts = true;
 
     int findBracket(const TextLineBase* tl) const;
     int findDashes(const TextLineBase* tl) const;
@@ -399,7 +482,13 @@ class ExportMusicXml
                       const MeasurePrintContext& mpc, QSet<const Spanner*>& spannersStopped);
     void repeatAtMeasureStart(Attributes& attr, const Measure* const m, track_idx_t strack, track_idx_t etrack, track_idx_t track);
     void repeatAtMeasureStop(const Measure* const m, track_idx_t strack, track_idx_t etrack, track_idx_t track);
-    void writeParts();
+    void writePart(const size_t partIndex, const int staffCount);
+    size_t writePartsConcurrently(QIODevice* dev, const std::vector<int>& staffCounts);
+    void writeParts(QIODevice* dev);
+    bool hasPendingNumberedElements() const;
+    void findVoltas();
+
+    ExportMusicXml(const ExportMusicXml& mainExporter, QIODevice* partDev);
 
     static QString fermataPosition(const Fermata* const fermata);
     static QString notePosition(const ExportMusicXml* const expMxml, const Note* const note);
@@ -418,6 +507,7 @@ public:
     }
 
     void write(QIODevice* dev);
+    void setConcurrentPartsEnabled(bool enabled) { _concurrentParts = enabled; }
     void credits(XmlWriter& xml);
     void moveToTick(const Fraction& t);
     void words(TextBase const* const text, staff_idx_t staff);
@@ -481,7 +571,7 @@ static QString positionToQString(const QPointF def, const QPointF rel, const flo
 
 QString ExportMusicXml::positioningAttributes(EngravingItem const* const el, bool isSpanStart)
 {
-    if (!configuration()->musicxmlExportLayout()) {
+    if (!exportOptions().exportLayout) {
         return "";
     }
 
@@ -655,7 +745,7 @@ static std::shared_ptr<mu::engraving::IEngravingConfiguration> engravingConfigur
 
 static QString color2xml(const EngravingItem* el)
 {
-    if (el->color() != engravingConfiguration()->defaultColor()) {
+    if (el->color() != exportOptions().defaultColor) {
         return QString(" color=\"%1\"").arg(QString::fromStdString(el->color().toString()).toUpper());
     } else {
         return "";
@@ -732,6 +822,20 @@ int SlurHandler::findSlur(const Slur* s) const
     return -1;
 }
 
+//---------------------------------------------------------
+//   isEmpty -- return true if no slur is pending
+//---------------------------------------------------------
+
+bool SlurHandler::isEmpty() const
+{
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        if (slur[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------
 //   findFirstChordRest -- find first chord or rest (in musical order) for slur s
 //   note that this is not necessarily the same as s->startElement()
@@ -974,6 +1078,20 @@ int GlissandoHandler::findNote(const Note* note, int type) const
     return -1;
 }
 
+//---------------------------------------------------------
+//   isEmpty -- return true if no glissando or slide is pending
+//---------------------------------------------------------
+
+bool GlissandoHandler::isEmpty() const
+{
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        if (glissNote[i] || slideNote[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------
 //   doGlissandoStart
 //---------------------------------------------------------
@@ -1722,7 +1840,7 @@ static void ending(XmlWriter& xml, Volta* v, bool left)
 void ExportMusicXml::barlineLeft(const Measure* const m)
 {
     bool rs = m->repeatStart();
-    Volta* volta = findVolta(m, true);
+    Volta* volta = _leftVoltas.value(m);
     if (!rs && !volta) {
         return;
     }
@@ -1827,7 +1945,7 @@ QString ExportMusicXml::fermataPosition(const Fermata* const fermata)
 {
     QString res;
 
-    if (configuration()->musicxmlExportLayout()) {
+    if (exportOptions().exportLayout) {
         constexpr qreal SPATIUM2TENTHS = 10;
         constexpr qreal EPSILON = 0.01;
         const auto spatium = fermata->spatium();
@@ -1922,7 +2040,7 @@ void ExportMusicXml::barlineRight(const Measure* const m, const track_idx_t stra
     bool visible = m->endBarLineVisible();
 
     bool needBarStyle = (bst != BarLineType::NORMAL && bst != BarLineType::START_REPEAT) || !visible;
-    Volta* volta = findVolta(m, false);
+    Volta* volta = _rightVoltas.value(m);
     // detect short and tick barlines
     QString special = "";
     if (bst == BarLineType::NORMAL) {
@@ -3311,7 +3429,7 @@ static void writeNotehead(XmlWriter& xml, const Note* const note)
         xml.tag(noteheadTagname, "ti");
     } else if (note->headGroup() == NoteHeadGroup::HEAD_SOL) {
         xml.tag(noteheadTagname, "so");
-    } else if (note->color() != engravingConfiguration()->defaultColor()) {
+    } else if (note->color() != exportOptions().defaultColor) {
         xml.tag(noteheadTagname, "normal");
     } else if (rightParenthesis && leftParenthesis) {
         xml.tag(noteheadTagname, "normal");
@@ -3324,7 +3442,8 @@ static void writeNotehead(XmlWriter& xml, const Note* const note)
 //   writeFingering
 //---------------------------------------------------------
 
-static void writeFingering(XmlWriter& xml, Notations& notations, Technical& technical, const Note* const note)
+static void writeFingering(XmlWriter& xml, Notations& notations, Technical& technical, const Note* const note,
+                           const ResolvedTexts& texts)
 {
     for (const EngravingItem* e : note->el()) {
         if (!ExportMusicXml::canWrite(e)) {
@@ -3335,7 +3454,7 @@ static void writeFingering(XmlWriter& xml, Notations& notations, Technical& tech
             const TextBase* f = toTextBase(e);
             notations.tag(xml, e);
             technical.tag(xml);
-            QString t = MScoreTextToMXML::toPlainText(f->xmlText());
+            QString t = MScoreTextToMXML::toPlainText(texts.xmlText(f));
             QString attr;
             if (!f->isStyled(Pid::PLACEMENT) || f->placement() == PlacementV::BELOW) {
                 attr = QString(" placement=\"%1\"").arg((f->placement() == PlacementV::BELOW) ? "below" : "above");
@@ -3589,7 +3708,7 @@ QString ExportMusicXml::notePosition(const ExportMusicXml* const expMxml, const
 {
     QString res;
 
-    if (configuration()->musicxmlExportLayout()) {
+    if (exportOptions().exportLayout) {
         const double pageHeight  = expMxml->getTenthsFromInches(expMxml->score()->styleD(Sid::pageHeight));
 
         const auto chord = note->chord();
@@ -3754,7 +3873,7 @@ void ExportMusicXml::chord(Chord* chord, staff_idx_t staff, const std::vector<Ly
             chordAttributes(chord, notations, technical, _trillStart, _trillStop);
         }
 
-        writeFingering(_xml, notations, technical, note);
+        writeFingering(_xml, notations, technical, note, _texts);
         writeNotationSymbols(_xml, notations, note->el(), true);
 
         // write tablature string / fret
@@ -4373,7 +4492,7 @@ void ExportMusicXml::words(TextBase const* const text, staff_idx_t staff)
            qPrintable(text->plainText()));
     */
 
-    if (text->plainText() == "") {
+    if (_texts.plainText(text) == "") {
         // sometimes empty Texts are present, exporting would result
         // in invalid MusicXML (as an empty direction-type would be created)
         return;
@@ -4390,7 +4509,7 @@ void ExportMusicXml::words(TextBase const* const text, staff_idx_t staff)
 
 QString ExportMusicXml::positioningAttributesForTboxText(const QPointF position, float spatium)
 {
-    if (!configuration()->musicxmlExportLayout()) {
+    if (!exportOptions().exportLayout) {
         return "";
     }
 
@@ -4404,7 +4523,7 @@ QString ExportMusicXml::positioningAttributesForTboxText(const QPointF position,
 
 void ExportMusicXml::tboxTextAsWords(TextBase const* const text, const staff_idx_t staff, const QPointF relativePosition)
 {
-    if (text->plainText() == "") {
+    if (_texts.plainText(text) == "") {
         // sometimes empty Texts are present, exporting would result
         // in invalid MusicXML (as an empty direction-type would be created)
         return;
@@ -4441,7 +4560,7 @@ void ExportMusicXml::tboxTextAsWords(TextBase const* const text, const staff_idx
 
 void ExportMusicXml::rehearsal(RehearsalMark const* const rmk, staff_idx_t staff)
 {
-    if (rmk->plainText() == "") {
+    if (_texts.plainText(rmk) == "") {
         // sometimes empty Texts are present, exporting would result
         // in invalid MusicXML (as an empty direction-type would be created)
         return;
@@ -4945,7 +5064,7 @@ void ExportMusicXml::dynamic(Dynamic const* const dyn, staff_idx_t staff)
 
         QString dynText = dynTypeName;
         if (dyn->dynamicType() == DynamicType::OTHER) {
-            dynText = dyn->plainText();
+            dynText = _texts.plainText(dyn);
         }
 
         // collect consecutive runs of either dynamics glyphs
@@ -5046,7 +5165,7 @@ void ExportMusicXml::symbol(Symbol const* const sym, staff_idx_t staff)
 void ExportMusicXml::lyrics(const std::vector<Lyrics*>& ll, const track_idx_t trk)
 {
     for (const Lyrics* l : ll) {
-        if (l && !l->xmlText().isEmpty()) {
+        if (l && !_texts.xmlText(l).isEmpty()) {
             if ((l)->track() == trk) {
                 QString lyricXml = QString("lyric number=\"%1\"").arg((l)->no() + 1);
                 lyricXml += color2xml(l);
@@ -5091,7 +5210,7 @@ void ExportMusicXml::lyrics(const std::vector<Lyrics*>& ll, const track_idx_t tr
 
 // LVIFIX: TODO coda and segno should be numbered uniquely
 
-static void directionJump(XmlWriter& xml, const Jump* const jp)
+static void directionJump(XmlWriter& xml, const Jump* const jp, const ResolvedTexts& texts)
 {
     Jump::Type jtp = jp->jumpType();
     QString words = "";
@@ -5100,45 +5219,45 @@ static void directionJump(XmlWriter& xml, const Jump* const jp)
     bool isDaCapo = false;
     bool isDalSegno = false;
     if (jtp == Jump::Type::DC) {
-        if (jp->xmlText() == "") {
+        if (texts.xmlText(jp) == "") {
             words = "D.C.";
         } else {
-            words = jp->xmlText();
+            words = texts.xmlText(jp);
         }
         isDaCapo = true;
     } else if (jtp == Jump::Type::DC_AL_FINE) {
-        if (jp->xmlText() == "") {
+        if (texts.xmlText(jp) == "") {
             words = "D.C. al Fine";
         } else {
-            words = jp->xmlText();
+            words = texts.xmlText(jp);
         }
         isDaCapo = true;
     } else if (jtp == Jump::Type::DC_AL_CODA) {
-        if (jp->xmlText() == "") {
+        if (texts.xmlText(jp) == "") {
             words = "D.C. al Coda";
         } else {
-            words = jp->xmlText();
+            words = texts.xmlText(jp);
         }
         isDaCapo = true;
     } else if (jtp == Jump::Type::DS_AL_CODA) {
-        if (jp->xmlText() == "") {
+        if (texts.xmlText(jp) == "") {
             words = "D.S. al Coda";
         } else {
-            words = jp->xmlText();
+            words = texts.xmlText(jp);
         }
         isDalSegno = true;
     } else if (jtp == Jump::Type::DS_AL_FINE) {
-        if (jp->xmlText() == "") {
+        if (texts.xmlText(jp) == "") {
             words = "D.S. al Fine";
         } else {
-            words = jp->xmlText();
+            words = texts.xmlText(jp);
         }
         isDalSegno = true;
     } else if (jtp == Jump::Type::DS) {
         words = "D.S.";
         isDalSegno = true;
     } else {
-        words = jp->xmlText();
+        words = texts.xmlText(jp);
 
         if (jp->jumpTo() == "start") {
             isDaCapo = true;
@@ -5233,7 +5352,8 @@ static QString findCodaLabel(const std::vector<const Jump*>& jumps, const QStrin
 //   directionMarker -- write marker
 //---------------------------------------------------------
 
-static void directionMarker(XmlWriter& xml, const Marker* const m, const std::vector<const Jump*>& jumps)
+static void directionMarker(XmlWriter& xml, const Marker* const m, const std::vector<const Jump*>& jumps,
+                            const ResolvedTexts& texts)
 {
     const Marker::Type mtp = getEffectiveMarkerType(m, jumps);
     QString words = "";
@@ -5266,10 +5386,10 @@ static void directionMarker(XmlWriter& xml, const Marker* const m, const std::ve
         break;
     case Marker::Type::TOCODA:
     case Marker::Type::TOCODASYM: {
-        if (m->xmlText() == "") {
+        if (texts.xmlText(m) == "") {
             words = "To Coda";
         } else {
-            words = m->xmlText();
+            words = texts.xmlText(m);
         }
         const QString codaLabel = findCodaLabel(jumps, m->label());
         if (codaLabel == "") {
@@ -5360,7 +5480,7 @@ void ExportMusicXml::repeatAtMeasureStart(Attributes& attr, const Measure* const
             case Marker::Type::CODETTA:
                 LOGD(" -> handled");
                 attr.doAttr(_xml, false);
-                directionMarker(_xml, mk, _jumpElements);
+                directionMarker(_xml, mk, _jumpElements, _texts);
                 break;
             case Marker::Type::FINE:
             case Marker::Type::TOCODA:
@@ -5406,7 +5526,7 @@ void ExportMusicXml::repeatAtMeasureStop(const Measure* const m, track_idx_t str
             case Marker::Type::FINE:
             case Marker::Type::TOCODA:
             case Marker::Type::TOCODASYM:
-                directionMarker(_xml, mk, _jumpElements);
+                directionMarker(_xml, mk, _jumpElements, _texts);
                 break;
             case Marker::Type::SEGNO:
             case Marker::Type::VARSEGNO:
@@ -5422,7 +5542,7 @@ void ExportMusicXml::repeatAtMeasureStop(const Measure* const m, track_idx_t str
         }
         break;
         case ElementType::JUMP:
-            directionJump(_xml, toJump(e));
+            directionJump(_xml, toJump(e), _texts);
             break;
         default:
             LOGD("repeatAtMeasureStop: direction type %s at tick %d not implemented",
@@ -5962,8 +6082,8 @@ void ExportMusicXml::identification(XmlWriter& xml, Score const* const score)
     xml.tagE("supports element=\"beam\" type=\"yes\"");
     // set support for print new-page and new-system to match user preference
     // for MusicxmlExportBreaks::MANUAL support is "no" because "yes" breaks Finale NotePad import
-    IMusicXmlConfiguration::MusicxmlExportBreaksType breaksType = configuration()->musicxmlExportBreaksType();
-    if (configuration()->musicxmlExportLayout() && breaksType == IMusicXmlConfiguration::MusicxmlExportBreaksType::All) {
+    IMusicXmlConfiguration::MusicxmlExportBreaksType breaksType = exportOptions().exportBreaksType;
+    if (exportOptions().exportLayout && breaksType == IMusicXmlConfiguration::MusicxmlExportBreaksType::All) {
         xml.tagE("supports element=\"print\" attribute=\"new-page\" type=\"yes\" value=\"yes\"");
         xml.tagE("supports element=\"print\" attribute=\"new-system\" type=\"yes\" value=\"yes\"");
     } else {
@@ -6139,7 +6259,7 @@ void ExportMusicXml::print(const Measure* const m, const int partNr, const int f
 
     QString newSystemOrPage;               // new-[system|page]="yes" or empty
     if (!mpc.scoreStart) {
-        IMusicXmlConfiguration::MusicxmlExportBreaksType exportBreaksType = configuration()->musicxmlExportBreaksType();
+        IMusicXmlConfiguration::MusicxmlExportBreaksType exportBreaksType = exportOptions().exportBreaksType;
 
         if (exportBreaksType == IMusicXmlConfiguration::MusicxmlExportBreaksType::All) {
             if (mpc.pageStart) {
@@ -6157,7 +6277,7 @@ void ExportMusicXml::print(const Measure* const m, const int partNr, const int f
     }
 
     bool doBreak = mpc.scoreStart || (newSystemOrPage != "");
-    bool doLayout = configuration()->musicxmlExportLayout();
+    bool doLayout = exportOptions().exportLayout;
 
     if (doBreak) {
         if (doLayout) {
@@ -7056,7 +7176,7 @@ void ExportMusicXml::writeMeasure(const Measure* const m,
     measureTag += mnsh.measureNumber();
     const bool isFirstActualMeasure = mnsh.isFirstActualMeasure();
 
-    if (configuration()->musicxmlExportLayout()) {
+    if (exportOptions().exportLayout) {
         measureTag += QString(" width=\"%1\"").arg(QString::number(m->bbox().width() / DPMM / millimeters * tenths, 'f', 2));
     }
 
@@ -7144,74 +7264,320 @@ void MeasurePrintContext::measureWritten(const Measure* m)
 }
 
 //---------------------------------------------------------
-//  writeParts
+//  writePart
 //---------------------------------------------------------
 
 /**
- Write all parts.
+ Write part \a partIndex, whose first staff is staff \a staffCount of the score.
  */
 
-void ExportMusicXml::writeParts()
+void ExportMusicXml::writePart(const size_t partIndex, const int staffCount)
 {
-    int staffCount = 0;
-    const auto& parts = _score->parts();
-
-    for (size_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
-        const auto part = parts.at(partIndex);
-        _tick = { 0, 1 };
-        _xml.startObject(QString("part id=\"P%1\"").arg(partIndex + 1));
+    const auto part = _score->parts().at(partIndex);
+    _tick = { 0, 1 };
+    _xml.startObject(QString("part id=\"P%1\"").arg(partIndex + 1));
 
-        _trillStart.clear();
-        _trillStop.clear();
-        initInstrMap(instrMap, part->instruments(), _score);
+    _trillStart.clear();
+    _trillStop.clear();
+    initInstrMap(instrMap, part->instruments(), _score);
 
-        MeasureNumberStateHandler mnsh;
-        FigBassMap fbMap;                     // pending figured bass extends
+    MeasureNumberStateHandler mnsh;
+    FigBassMap fbMap;                     // pending figured bass extends
 
-        // set of spanners already stopped in this part
-        // required to prevent multiple spanner stops for the same spanner
-        QSet<const Spanner*> spannersStopped;
+    // set of spanners already stopped in this part
+    // required to prevent multiple spanner stops for the same spanner
+    QSet<const Spanner*> spannersStopped;
 
-        const auto& pages = _score->pages();
-        MeasurePrintContext mpc;
+    const auto& pages = _score->pages();
+    MeasurePrintContext mpc;
 
-        for (size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex) {
-            const auto page = pages.at(pageIndex);
-            mpc.pageStart = true;
-            const auto& systems = page->systems();
+    for (size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex) {
+        const auto page = pages.at(pageIndex);
+        mpc.pageStart = true;
+        const auto& systems = page->systems();
 
-            for (int systemIndex = 0; systemIndex < static_cast<int>(systems.size()); ++systemIndex) {
-                const auto system = systems.at(systemIndex);
-                mpc.systemStart = true;
+        for (int systemIndex = 0; systemIndex < static_cast<int>(systems.size()); ++systemIndex) {
+            const auto system = systems.at(systemIndex);
+            mpc.systemStart = true;
 
-                for (const auto mb : system->measures()) {
-                    if (!mb->isMeasure()) {
-                        continue;
+            for (const auto mb : system->measures()) {
+                if (!mb->isMeasure()) {
+                    continue;
+                }
+                const auto m = toMeasure(mb);
+
+                if (m->isMMRest()) {
+                    // in case of a multimeasure rest (which is a single measure in MuseScore), write the measure range it replaces
+                    const auto m2 = m->mmRestLast()->nextMeasure();
+                    for (auto m1 = m->mmRestFirst(); m1 != m2; m1 = m1->nextMeasure()) {
+                        if (m1->isMeasure()) {
+                            writeMeasure(m1, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
+                            mpc.measureWritten(m1);
+                        }
                     }
-                    const auto m = toMeasure(mb);
-
-                    if (m->isMMRest()) {
-                        // in case of a multimeasure rest (which is a single measure in MuseScore), write the measure range it replaces
-                        const auto m2 = m->mmRestLast()->nextMeasure();
-                        for (auto m1 = m->mmRestFirst(); m1 != m2; m1 = m1->nextMeasure()) {
-                            if (m1->isMeasure()) {
-                                writeMeasure(m1, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
-                                mpc.measureWritten(m1);
-                            }
+                } else {
+                    // write the measure (or, if measure repeat, the "underlying" measure that it indicates for the musician to play)
+                    writeMeasure(m, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
+                    mpc.measureWritten(m);
+                }
+            }
+            mpc.prevSystem = system;
+        }
+        mpc.lastSystemPrevPage = mpc.prevSystem;
+    }
+
+    _xml.endObject();
+}
+
+//---------------------------------------------------------
+//  hasPendingNumberedElements
+//---------------------------------------------------------
+
+/**
+ Return true if a slur, glissando or numbered spanner has been started
+ but not yet stopped, i.e. if the next part would not be written
+ starting from a clean numbering state.
+ */
+
+bool ExportMusicXml::hasPendingNumberedElements() const
+{
+    if (!sh.isEmpty() || !gh.isEmpty()) {
+        return true;
+    }
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        if (brackets[i] || dashes[i] || hairpins[i] || ottavas[i] || trills[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------
+//  ExportMusicXml -- part exporter
+//---------------------------------------------------------
+
+/**
+ Create an exporter writing a single part of \a mainExporter's score to \a partDev.
+ It shares the score wide data calculated by the main exporter (divisions,
+ scaling, jumps) and starts with a clean numbering state. The part is written
+ after the start tag of the root element, which is written to \a partDev too.
+ */
+
+ExportMusicXml::ExportMusicXml(const ExportMusicXml& mainExporter, QIODevice* partDev)
+    : _score(mainExporter._score), _tick(0, 1), _jumpElements(mainExporter._jumpElements), div(mainExporter.div),
+    millimeters(mainExporter.millimeters), tenths(mainExporter.tenths), _tboxesAboveWritten(false), _tboxesBelowWritten(false),
+    _options(mainExporter._options), _leftVoltas(mainExporter._leftVoltas), _rightVoltas(mainExporter._rightVoltas),
+    _texts(mainExporter._texts), _concurrentParts(false)
+{
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        brackets[i] = nullptr;
+        dashes[i] = nullptr;
+        hairpins[i] = nullptr;
+        ottavas[i] = nullptr;
+        trills[i] = nullptr;
+    }
+
+    // the part is nested in the root element of the main exporter,
+    // open it here too to get the same indentation
+    _xml.setDevice(partDev);
+    _xml.startObject(SCORE_PARTWISE_TAG);
+    _xml.flush();
+}
+
+//---------------------------------------------------------
+//  ResolvedTexts
+//---------------------------------------------------------
+
+/**
+ Resolve the texts in \a score the parts refer to: the measure elements
+ (jumps, markers), the annotations, the lyrics and the note elements
+ (fingerings).
+ */
+
+void ResolvedTexts::resolve(const Score* score)
+{
+    _plainTexts.clear();
+    _xmlTexts.clear();
+
+    for (const MeasureBase* mb = score->first(); mb; mb = mb->next()) {
+        for (const EngravingItem* e : mb->el()) {
+            add(e);
+        }
+        if (!mb->isMeasure()) {
+            continue;
+        }
+        for (const Segment* s = toMeasure(mb)->first(); s; s = s->next()) {
+            for (const EngravingItem* e : s->annotations()) {
+                add(e);
+            }
+            for (const EngravingItem* e : s->elist()) {
+                if (!e || !e->isChordRest()) {
+                    continue;
+                }
+                const ChordRest* cr = toChordRest(e);
+                for (const Lyrics* l : cr->lyrics()) {
+                    add(l);
+                }
+                if (!cr->isChord()) {
+                    continue;
+                }
+                const Chord* chord = toChord(cr);
+                std::vector<const Chord*> chords(chord->graceNotes().begin(), chord->graceNotes().end());
+                chords.push_back(chord);
+                for (const Chord* c : chords) {
+                    for (const Note* note : c->notes()) {
+                        for (const EngravingItem* ne : note->el()) {
+                            add(ne);
                         }
-                    } else {
-                        // write the measure (or, if measure repeat, the "underlying" measure that it indicates for the musician to play)
-                        writeMeasure(m, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
-                        mpc.measureWritten(m);
                     }
                 }
-                mpc.prevSystem = system;
             }
-            mpc.lastSystemPrevPage = mpc.prevSystem;
         }
+    }
+}
+
+void ResolvedTexts::add(const EngravingItem* e)
+{
+    if (!e || !e->isTextBase()) {
+        return;
+    }
+    const TextBase* text = toTextBase(e);
+    _plainTexts.insert(text, text->plainText());
+    _xmlTexts.insert(text, text->xmlText());
+}
+
+QString ResolvedTexts::plainText(const TextBase* text) const
+{
+    const auto it = _plainTexts.constFind(text);
+    return it != _plainTexts.cend() ? it.value() : text->plainText();
+}
+
+QString ResolvedTexts::xmlText(const TextBase* text) const
+{
+    const auto it = _xmlTexts.constFind(text);
+    return it != _xmlTexts.cend() ? it.value() : text->xmlText();
+}
+
+//---------------------------------------------------------
+//  writePartsConcurrently
+//---------------------------------------------------------
+
+/**
+ Render the parts into separate buffers on the global thread pool
+ and write them to \a dev in score order.
+
+ Each part is rendered starting from a clean slur, glissando and spanner
+ numbering state. This is exactly the state the serial export starts the part
+ with, unless a previous part left such an element pending (e.g. a slur
+ crossing parts). Therefore only the parts before the first one leaving
+ elements pending are written. Return the number of parts written,
+ the remaining parts must be written serially.
+ */
+
+size_t ExportMusicXml::writePartsConcurrently(QIODevice* dev, const std::vector<int>& staffCounts)
+{
+#ifdef Q_OS_WASM
+    UNUSED(dev);
+    UNUSED(staffCounts);
+    return 0;
+#else
+    struct RenderedPart {
+        size_t partIndex = 0;
+        QByteArray data;
+        bool hasPendingElements = false;
+    };
+
+    std::vector<RenderedPart> renderedParts(staffCounts.size());
+    for (size_t partIndex = 0; partIndex < renderedParts.size(); ++partIndex) {
+        renderedParts[partIndex].partIndex = partIndex;
+    }
+
+    QtConcurrent::blockingMap(renderedParts, [this, &staffCounts](RenderedPart& renderedPart) {
+        ExportOptionsScope optionsScope(&_options);
+        QBuffer buffer(&renderedPart.data);
+        buffer.open(QIODevice::WriteOnly);
+        ExportMusicXml partExporter(*this, &buffer);
+        const qint64 partStart = buffer.pos();
+        partExporter.writePart(renderedPart.partIndex, staffCounts.at(renderedPart.partIndex));
+        partExporter._xml.flush();
+        renderedPart.hasPendingElements = partExporter.hasPendingNumberedElements();
+        buffer.close();
+
+        // skip the root element opened by the part exporter
+        renderedPart.data.remove(0, static_cast<int>(partStart));
+    });
+
+    // the rendered parts cannot be written through the xml writer, make sure
+    // everything written so far has reached the device before appending them
+    _xml.flush();
+
+    size_t partsWritten = 0;
+    for (const RenderedPart& renderedPart : renderedParts) {
+        if (renderedPart.hasPendingElements) {
+            // the next part depends on the state left by this one,
+            // this one and the remaining ones must be written serially
+            break;
+        }
+        dev->write(renderedPart.data);
+        ++partsWritten;
+    }
+
+    return partsWritten;
+#endif
+}
+
+//---------------------------------------------------------
+//  findVoltas
+//---------------------------------------------------------
+
+/**
+ Find the voltas starting and stopping in each measure.
+ The spanner map lookup is not thread safe, so this is done
+ before the parts are written.
+ */
+
+void ExportMusicXml::findVoltas()
+{
+    _leftVoltas.clear();
+    _rightVoltas.clear();
+
+    for (const Measure* m = _score->firstMeasure(); m; m = m->nextMeasure()) {
+        if (Volta* volta = findVolta(m, true)) {
+            _leftVoltas.insert(m, volta);
+        }
+        if (Volta* volta = findVolta(m, false)) {
+            _rightVoltas.insert(m, volta);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//  writeParts
+//---------------------------------------------------------
+
+/**
+ Write all parts.
+ */
+
+void ExportMusicXml::writeParts(QIODevice* dev)
+{
+    const auto& parts = _score->parts();
 
+    std::vector<int> staffCounts;
+    int staffCount = 0;
+    for (const Part* part : parts) {
+        staffCounts.push_back(staffCount);
         staffCount += static_cast<int>(part->nstaves());
-        _xml.endObject();
+    }
+
+    size_t partIndex = 0;
+    if (_concurrentParts && parts.size() > 1) {
+        _texts.resolve(_score);
+        partIndex = writePartsConcurrently(dev, staffCounts);
+    }
+
+    for (; partIndex < parts.size(); ++partIndex) {
+        writePart(partIndex, staffCounts.at(partIndex));
     }
 }
 
@@ -7244,6 +7610,12 @@ static std::vector<const Jump*> findJumpElements(const Score* score)
 
 void ExportMusicXml::write(QIODevice* dev)
 {
+    _options.exportLayout = configuration()->musicxmlExportLayout();
+    _options.exportBreaksType = configuration()->musicxmlExportBreaksType();
+    _options.exportInvisibleElements = configuration()->musicxmlExportInvisibleElements();
+    _options.defaultColor = engravingConfiguration()->defaultColor();
+    ExportOptionsScope optionsScope(&_options);
+
     // must export in transposed pitch to prevent
     // losing the transposition information
     // if necessary, switch concert pitch mode off
@@ -7266,23 +7638,24 @@ void ExportMusicXml::write(QIODevice* dev)
     }
 
     _jumpElements = findJumpElements(_score);
+    findVoltas();
 
     _xml.setDevice(dev);
     _xml.writeStartDocument();
     _xml.writeDoctype("score-partwise PUBLIC \"-//Recordare//DTD MusicXML 4.0 Partwise//EN\" \"http://www.musicxml.org/dtds/partwise.dtd\"");
 
-    _xml.startObject("score-partwise version=\"4.0\"");
+    _xml.startObject(SCORE_PARTWISE_TAG);
 
     work(_score->measures()->first());
     identification(_xml, _score);
 
-    if (configuration()->musicxmlExportLayout()) {
+    if (exportOptions().exportLayout) {
         defaults(_xml, _score, millimeters, tenths);
         credits(_xml);
     }
 
     partList(_xml, _score, instrMap);
-    writeParts();
+    writeParts(dev);
 
     _xml.endObject();
 
@@ -7303,9 +7676,10 @@ void ExportMusicXml::write(QIODevice* dev)
  Return false on error.
  */
 
-bool saveXml(Score* score, QIODevice* device)
+bool saveXml(Score* score, QIODevice* device, bool concurrentParts)
 {
     ExportMusicXml em(score);
+    em.setConcurrentPartsEnabled(concurrentParts);
     em.write(device);
     return true;
 }
@@ -7562,6 +7936,6 @@ void ExportMusicXml::harmony(Harmony const* const h, FretDiagram const* const fd
 
 bool ExportMusicXml::canWrite(const EngravingItem* e)
 {
-    return e->visible() || configuration()->musicxmlExportInvisibleElements();
+    return e->visible() || exportOptions().exportInvisibleElements;
 }
 }
@@ -31,7 +31,7 @@ namespace Ms {
 class Score;
 
 bool saveMxl(Score*, QIODevice*);
-bool saveXml(Score*, QIODevice*);
+bool saveXml(Score*, QIODevice*, bool concurrentParts = true);
 bool saveXml(Score*, const QString&);
 }
 
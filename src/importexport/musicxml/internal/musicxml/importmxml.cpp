@@ -27,6 +27,8 @@
 #include "importmxmlpass1.h"
 #include "importmxmlpass2.h"
 
+#include "log.h"
+
 namespace Ms {
 //---------------------------------------------------------
 //   musicXMLImportErrorDialog
@@ -67,12 +69,14 @@ Score::FileError importMusicXMLfromBuffer(Score* score, const QString& /*name*/,
     MusicXMLParserPass1 pass1(score, &logger);
     Score::FileError res = pass1.parse(dev);
     const auto pass1_errors = pass1.errors();
+    STEP_TIME("importMusicXml", "pass 1");
 
     // pass 2
     MusicXMLParserPass2 pass2(score, pass1, &logger);
     if (res == Score::FileError::FILE_NO_ERROR) {
         dev->seek(0);
         res = pass2.parse(dev);
+        STEP_TIME("importMusicXml", "pass 2");
     }
 
     // report result
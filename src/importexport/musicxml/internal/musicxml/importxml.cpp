@@ -27,9 +27,12 @@
 #include <QMessageBox>
 #include <QXmlSchema>
 #include <QXmlSchemaValidator>
+#include <QXmlStreamReader>
 #include <QBuffer>
 
 #include "serialization/internal/qzipreader_p.h"
+#include "modularity/ioc.h"
+#include "importexport/musicxml/imusicxmlconfiguration.h"
 #include "importmxml.h"
 
 #include "log.h"
@@ -104,6 +107,39 @@ static bool initMusicXmlSchema(QXmlSchema& schema)
     return true;
 }
 
+//---------------------------------------------------------
+//   musicXmlSchema
+//    return nullptr on error
+//---------------------------------------------------------
+
+/**
+ Return the MusicXML schema. It is loaded and compiled on first use only
+ and then shared by all imports, as compiling the full schema takes longer
+ than validating a typical file.
+ */
+
+static const QXmlSchema* musicXmlSchema()
+{
+    static QXmlSchema schema;
+    static const bool isValid = initMusicXmlSchema(schema);
+
+    if (!isValid) {
+        MScore::lastError = QObject::tr("Internal error: MusicXML schema is invalid\n");
+        return nullptr;
+    }
+    return &schema;
+}
+
+//---------------------------------------------------------
+//   musicxmlImportSchemaValidation
+//---------------------------------------------------------
+
+static bool musicxmlImportSchemaValidation()
+{
+    auto conf = mu::modularity::ioc()->resolve<mu::iex::musicxml::IMusicXmlConfiguration>("iex_musicxml");
+    return conf ? conf->musicxmlImportSchemaValidation() : true;
+}
+
 //---------------------------------------------------------
 //   musicXMLValidationErrorDialog
 //---------------------------------------------------------
@@ -139,38 +175,36 @@ static bool extractRootfile(QFile* qf, QByteArray& data)
     MQZipReader f(qf->fileName());
     data = f.fileData("META-INF/container.xml");
 
-    QDomDocument container;
-    int line, column;
-    QString err;
-    if (!container.setContent(data, false, &err, &line, &column)) {
-        MScore::lastError = QObject::tr("Error reading container.xml at line %1 column %2: %3\n").arg(line).arg(column).arg(err);
-        return false;
-    }
-
-    // extract first rootfile
+    // container.xml is tiny and only the first rootfile is needed,
+    // so stream through it instead of building a DOM
+    QXmlStreamReader container(data);
     QString rootfile = "";
-    for (QDomElement e = container.documentElement(); !e.isNull(); e = e.nextSiblingElement()) {
-        if (e.tagName() == "container") {
-            for (QDomElement ee = e.firstChildElement(); !ee.isNull(); ee = ee.nextSiblingElement()) {
-                if (ee.tagName() == "rootfiles") {
-                    for (QDomElement eee = ee.firstChildElement(); !eee.isNull(); eee = eee.nextSiblingElement()) {
-                        if (eee.tagName() == "rootfile") {
-                            if (rootfile == "") {
-                                rootfile = eee.attribute(QString("full-path"));
-                            }
-                        } else {
-                            domError(eee);
-                        }
-                    }
-                } else {
-                    domError(ee);
+    while (container.readNextStartElement()) {
+        if (container.name() != "container") {
+            LOGD("extractRootfile: unexpected element <%s>", qPrintable(container.name().toString()));
+            container.skipCurrentElement();
+            continue;
+        }
+        while (container.readNextStartElement()) {
+            if (container.name() != "rootfiles") {
+                container.skipCurrentElement();
+                continue;
+            }
+            while (container.readNextStartElement()) {
+                if (container.name() == "rootfile" && rootfile == "") {
+                    rootfile = container.attributes().value("full-path").toString();
                 }
+                container.skipCurrentElement();
             }
-        } else {
-            domError(e);
         }
     }
 
+    if (container.hasError()) {
+        MScore::lastError = QObject::tr("Error reading container.xml at line %1 column %2: %3\n")
+                            .arg(container.lineNumber()).arg(container.columnNumber()).arg(container.errorString());
+        return false;
+    }
+
     if (rootfile == "") {
         LOGD("can't find rootfile in: %s", qPrintable(qf->fileName()));
         MScore::lastError = QObject::tr("Can't find rootfile\n%1").arg(qf->fileName());
@@ -192,20 +226,15 @@ static bool extractRootfile(QFile* qf, QByteArray& data)
 
 static Score::FileError doValidate(const QString& name, QIODevice* dev)
 {
-    //QElapsedTimer t;
-    //t.start();
-
-    // initialize the schema
-    ValidatorMessageHandler messageHandler;
-    QXmlSchema schema;
-    schema.setMessageHandler(&messageHandler);
-    if (!initMusicXmlSchema(schema)) {
-        return Score::FileError::FILE_BAD_FORMAT;      // appropriate error message has been printed by initMusicXmlSchema
+    const QXmlSchema* schema = musicXmlSchema();
+    if (!schema) {
+        return Score::FileError::FILE_BAD_FORMAT;      // appropriate error message has been printed by musicXmlSchema
     }
     // validate the data
-    QXmlSchemaValidator validator(schema);
+    ValidatorMessageHandler messageHandler;
+    QXmlSchemaValidator validator(*schema);
+    validator.setMessageHandler(&messageHandler);
     bool valid = validator.validate(dev, QUrl::fromLocalFile(name));
-    //LOGD("Validation time elapsed: %d ms", t.elapsed());
 
     if (!valid) {
         LOGD("importMusicXml() file '%s' is not a valid MusicXML file", qPrintable(name));
@@ -222,6 +251,31 @@ static Score::FileError doValidate(const QString& name, QIODevice* dev)
     return Score::FileError::FILE_NO_ERROR;
 }
 
+//---------------------------------------------------------
+//   doCheckStructure
+//---------------------------------------------------------
+
+/**
+ Lightweight replacement for the schema validation: only verify that the data
+ from file \a name contained in QIODevice \a dev is XML with a score-partwise root.
+ Everything else is checked (and logged) by the parser passes.
+ */
+
+static Score::FileError doCheckStructure(const QString& name, QIODevice* dev)
+{
+    QXmlStreamReader e(dev);
+    const bool valid = e.readNextStartElement() && e.name() == "score-partwise";
+    dev->seek(0);
+
+    if (!valid) {
+        LOGD("importMusicXml() file '%s' is not a MusicXML score-partwise file", qPrintable(name));
+        MScore::lastError = QObject::tr("File '%1' is not a valid MusicXML file").arg(name);
+        return Score::FileError::FILE_BAD_FORMAT;
+    }
+
+    return Score::FileError::FILE_NO_ERROR;
+}
+
 //---------------------------------------------------------
 //   doValidateAndImport
 //---------------------------------------------------------
@@ -235,9 +289,17 @@ static Score::FileError doValidateAndImport(Score* score, const QString& name, Q
     // verify tuplet DurationType dependencies
     tupletAssert();
 
+    BEGIN_STEP_TIME("importMusicXml");
+
     // validate the file
     Score::FileError res;
-    res = doValidate(name, dev);
+    if (musicxmlImportSchemaValidation()) {
+        res = doValidate(name, dev);
+        STEP_TIME("importMusicXml", "validate");
+    } else {
+        res = doCheckStructure(name, dev);
+        STEP_TIME("importMusicXml", "check structure");
+    }
     if (res != Score::FileError::FILE_NO_ERROR) {
         return res;
     }
@@ -52,6 +52,9 @@ mu::Ret MusicXmlWriter::write(notation::INotationPtr notation, Device& destinati
         return make_ret(Ret::Code::UnknownError);
     }
 
+    //! NOTE The export contains the layout (positions, system and page breaks)
+    score->doPostponedLayout();
+
     return Ms::saveXml(score, &destinationDevice);
 }
 
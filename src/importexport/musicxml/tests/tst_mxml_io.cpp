@@ -20,6 +20,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <QBuffer>
+
 #include "testing/qtestsuite.h"
 
 #include "testbase.h"
@@ -31,9 +33,11 @@
 #include "libmscore/staff.h"
 #include "libmscore/keysig.h"
 // end includes required for fixupScore()
+#include "libmscore/textbase.h"
 
 #include "settings.h"
 #include "importexport/musicxml/imusicxmlconfiguration.h"
+#include "importexport/musicxml/internal/musicxml/exportxml.h"
 
 using namespace mu;
 using namespace mu::framework;
@@ -51,6 +55,7 @@ static const std::string PREF_EXPORT_MUSICXML_EXPORTBREAKS("export/musicXML/expo
 static const std::string PREF_IMPORT_MUSICXML_IMPORTBREAKS("import/musicXML/importBreaks");
 static const std::string PREF_EXPORT_MUSICXML_EXPORTLAYOUT("export/musicXML/exportLayout");
 static const std::string PREF_EXPORT_MUSICXML_EXPORTINVISIBLE("export/musicXML/exportInvisibleElements");
+static const std::string PREF_IMPORT_MUSICXML_IMPORTSCHEMAVALIDATION("import/musicXML/importSchemaValidation");
 
 using namespace Ms;
 
@@ -71,6 +76,9 @@ class TestMxmlIO : public QObject, public MTest
     void mxmlReadTestCompr(const char* file);
     void mxmlReadWriteTestCompr(const char* file);
     void mxmlImportTestRef(const char* file);
+    void mxmlConcurrentExportTest(const char* file, bool invalidTexts = false);
+    void mxmlImportNoValidationTest(const char* file);
+    void mxmlImportNoValidationInvalidTest(const char* file);
 
     // The list of MusicXML regression tests
     // Currently failing tests are commented out and annotated with the failure reason
@@ -109,6 +117,10 @@ private slots:
     void clefs1() { mxmlIoTest("testClefs1"); }
     void clefs2() { mxmlIoTest("testClefs2"); }
     void completeMeasureRests() { mxmlIoTest("testCompleteMeasureRests"); }
+    void concurrentParts1() { mxmlConcurrentExportTest("testConcurrentParts"); }
+    void concurrentParts2() { mxmlConcurrentExportTest("testSystemBrackets1"); }
+    void concurrentPartsInvalidLyrics() { mxmlConcurrentExportTest("testNumberedLyrics", true); }
+    void concurrentPartsInvalidWords() { mxmlConcurrentExportTest("testWords2", true); }
     void cueNotes() { mxmlIoTest("testCueNotes"); }
     void cueNotes2() { mxmlMscxExportTestRef("testCueNotes2"); }
     void dalSegno() { mxmlIoTest("testDalSegno"); }
@@ -150,6 +162,7 @@ private slots:
     void harmony5() { mxmlIoTest("testHarmony5"); }   // chordnames without chordrest
     void harmony6() { mxmlMscxExportTestRef("testHarmony6"); }
     void hello() { mxmlIoTest("testHello"); }
+    void helloNoValidation() { mxmlImportNoValidationTest("testHello"); }
     void helloReadCompr() { mxmlReadTestCompr("testHello"); }
     void helloReadWriteCompr() { mxmlReadWriteTestCompr("testHello"); }
     void implicitMeasure1() { mxmlIoTest("testImplicitMeasure1"); }
@@ -201,6 +214,7 @@ private slots:
     void noteheadsFilled() { mxmlIoTest("testNoteheadsFilled"); }
     void notesRests1() { mxmlIoTest("testNotesRests1"); }
     void notesRests2() { mxmlIoTest("testNotesRests2"); }
+    void notPartwiseNoValidation() { mxmlImportNoValidationInvalidTest("testNotPartwise"); }
     void numberedLyrics() { mxmlIoTestRef("testNumberedLyrics"); }
     void overlappingSpanners() { mxmlIoTest("testOverlappingSpanners"); }
     void printSpacingNo() { mxmlIoTestRef("testPrintSpacingNo"); }
@@ -535,5 +549,128 @@ void TestMxmlIO::mxmlImportTestRef(const char* file)
     delete score;
 }
 
+//---------------------------------------------------------
+//   invalidateText
+//   mark the text and the layout of a text element invalid,
+//   as after an edit not followed by a layout yet
+//---------------------------------------------------------
+
+static void invalidateText(void* data, EngravingItem* e)
+{
+    if (!e->isTextBase()) {
+        return;
+    }
+    TextBase* text = toTextBase(e);
+    text->setTextInvalid();
+    text->setLayoutInvalid();
+    ++*static_cast<int*>(data);
+}
+
+//---------------------------------------------------------
+//   mxmlConcurrentExportTest
+//   read a MusicXML file, export it once with the parts written
+//   serially and once concurrently and verify the results are identical
+//   if invalidTexts is set, the texts are exported with an invalid layout
+//---------------------------------------------------------
+
+void TestMxmlIO::mxmlConcurrentExportTest(const char* file, bool invalidTexts)
+{
+    MScore::debugMode = true;
+
+    setValue(PREF_EXPORT_MUSICXML_EXPORTBREAKS, Val(IMusicXmlConfiguration::MusicxmlExportBreaksType::Manual));
+    setValue(PREF_IMPORT_MUSICXML_IMPORTBREAKS, Val(true));
+    setValue(PREF_EXPORT_MUSICXML_EXPORTLAYOUT, Val(true));
+    setValue(PREF_EXPORT_MUSICXML_EXPORTINVISIBLE, Val(true));
+
+    MasterScore* score = readScore(XML_IO_DATA_DIR + file + ".xml");
+    QVERIFY(score);
+    fixupScore(score);
+    score->doLayout();
+    QVERIFY(score->parts().size() > 1);
+
+    if (invalidTexts) {
+        int invalidated = 0;
+        score->scanElements(&invalidated, invalidateText);
+        QVERIFY(invalidated > 0);
+    }
+
+    QBuffer serial;
+    QVERIFY(serial.open(QIODevice::WriteOnly));
+    QVERIFY(saveXml(score, &serial, false));
+
+    QBuffer concurrent;
+    QVERIFY(concurrent.open(QIODevice::WriteOnly));
+    QVERIFY(saveXml(score, &concurrent, true));
+
+    QVERIFY(!serial.data().isEmpty());
+    QCOMPARE(concurrent.data(), serial.data());
+    delete score;
+}
+
+//---------------------------------------------------------
+//   mxmlImportNoValidationTest
+//   read a MusicXML file twice with schema validation (the schema is compiled
+//   by the first import and reused by the second one) and once without it,
+//   verify the results are identical and match the original file
+//---------------------------------------------------------
+
+void TestMxmlIO::mxmlImportNoValidationTest(const char* file)
+{
+    MScore::debugMode = true;
+
+    setValue(PREF_EXPORT_MUSICXML_EXPORTBREAKS, Val(IMusicXmlConfiguration::MusicxmlExportBreaksType::Manual));
+    setValue(PREF_IMPORT_MUSICXML_IMPORTBREAKS, Val(true));
+    setValue(PREF_EXPORT_MUSICXML_EXPORTLAYOUT, Val(false));
+    setValue(PREF_EXPORT_MUSICXML_EXPORTINVISIBLE, Val(true));
+
+    QList<QByteArray> results;
+
+    for (bool schemaValidation : { true, true, false }) {
+        setValue(PREF_IMPORT_MUSICXML_IMPORTSCHEMAVALIDATION, Val(schemaValidation));
+
+        MasterScore* score = readScore(XML_IO_DATA_DIR + file + ".xml");
+        QVERIFY(score);
+        fixupScore(score);
+        score->doLayout();
+
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QVERIFY(saveXml(score, &buffer, false));
+        results.append(buffer.data());
+
+        if (!schemaValidation) {
+            QVERIFY(saveMusicXml(score, QString(file) + ".xml"));
+            QVERIFY(saveCompareMusicXmlScore(score, QString(file) + ".xml", XML_IO_DATA_DIR + file + ".xml"));
+        }
+
+        delete score;
+    }
+
+    setValue(PREF_IMPORT_MUSICXML_IMPORTSCHEMAVALIDATION, Val(true));
+
+    QVERIFY(!results.first().isEmpty());
+    QCOMPARE(results.at(1), results.at(0));
+    QCOMPARE(results.at(2), results.at(0));
+}
+
+//---------------------------------------------------------
+//   mxmlImportNoValidationInvalidTest
+//   read a file which is not a MusicXML score-partwise file
+//   without schema validation and verify it is rejected
+//---------------------------------------------------------
+
+void TestMxmlIO::mxmlImportNoValidationInvalidTest(const char* file)
+{
+    MScore::debugMode = true;
+
+    setValue(PREF_IMPORT_MUSICXML_IMPORTSCHEMAVALIDATION, Val(false));
+
+    MasterScore* score = readScore(XML_IO_DATA_DIR + file + ".xml");
+
+    setValue(PREF_IMPORT_MUSICXML_IMPORTSCHEMAVALIDATION, Val(true));
+
+    QVERIFY(!score);
+}
+
 QTEST_MAIN(TestMxmlIO)
 #include "tst_mxml_io.moc"
@@ -0,0 +1,116 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "videoframespipeline.h"
+
+#include "videoencoder.h"
+
+#include "log.h"
+
+using namespace mu::iex::videoexport;
+
+VideoFramesPipeline::VideoFramesPipeline(VideoEncoder* encoder, int width, int height, size_t maxFramesCount)
+    : m_encoder(encoder), m_width(width), m_height(height), m_maxFramesCount(std::max<size_t>(maxFramesCount, 1))
+{
+    m_thread = std::thread(&VideoFramesPipeline::th_encode, this);
+}
+
+VideoFramesPipeline::~VideoFramesPipeline()
+{
+    finish();
+}
+
+QImage VideoFramesPipeline::takeFreeFrame()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_freeFrames.empty() && m_framesCount < m_maxFramesCount) {
+        ++m_framesCount;
+        return QImage(m_width, m_height, QImage::Format_RGB32);
+    }
+
+    m_framesChanged.wait(lock, [this]() { return !m_freeFrames.empty(); });
+
+    QImage frame = std::move(m_freeFrames.back());
+    m_freeFrames.pop_back();
+
+    return frame;
+}
+
+void VideoFramesPipeline::pushFrame(QImage frame)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queuedFrames.push_back(std::move(frame));
+    }
+
+    m_framesChanged.notify_all();
+}
+
+bool VideoFramesPipeline::finish()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finishing = true;
+    }
+
+    m_framesChanged.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    return !m_failed;
+}
+
+void VideoFramesPipeline::th_encode()
+{
+    while (true) {
+        QImage frame;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_framesChanged.wait(lock, [this]() { return !m_queuedFrames.empty() || m_finishing; });
+
+            if (m_queuedFrames.empty()) {
+                return;
+            }
+
+            frame = std::move(m_queuedFrames.front());
+            m_queuedFrames.pop_front();
+        }
+
+        bool ok = m_encoder->encodeImage(frame);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (!ok && !m_failed) {
+                LOGE() << "failed encode frame";
+                m_failed = true;
+            }
+
+            m_freeFrames.push_back(std::move(frame));
+        }
+
+        m_framesChanged.notify_all();
+    }
+}
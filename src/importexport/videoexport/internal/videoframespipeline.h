@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_IMPORTEXPORT_VIDEOFRAMESPIPELINE_H
+#define MU_IMPORTEXPORT_VIDEOFRAMESPIPELINE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QImage>
+
+namespace mu::iex::videoexport {
+class VideoEncoder;
+
+//! NOTE Converts and encodes the frames on its own thread, while the next frames are being painted.
+//! The frames are recycled, so at most maxFramesCount frames exist at once
+class VideoFramesPipeline
+{
+public:
+    VideoFramesPipeline(VideoEncoder* encoder, int width, int height, size_t maxFramesCount = 4);
+    ~VideoFramesPipeline();
+
+    //! NOTE Waits if all the frames are still queued for encoding
+    QImage takeFreeFrame();
+    void pushFrame(QImage frame);
+
+    //! NOTE Waits until all the frames are encoded, returns false if any of them failed
+    bool finish();
+
+private:
+    void th_encode();
+
+    VideoEncoder* m_encoder = nullptr;
+    int m_width = 0;
+    int m_height = 0;
+    size_t m_maxFramesCount = 0;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_framesChanged;
+
+    std::deque<QImage> m_queuedFrames;
+    std::vector<QImage> m_freeFrames;
+    size_t m_framesCount = 0;
+    bool m_finishing = false;
+    bool m_failed = false;
+};
+}
+
+#endif // MU_IMPORTEXPORT_VIDEOFRAMESPIPELINE_H
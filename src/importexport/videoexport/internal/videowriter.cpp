@@ -21,7 +21,11 @@
  */
 #include "videowriter.h"
 
+#include <chrono>
+#include <cstring>
+
 #include "videoencoder.h"
+#include "videoframespipeline.h"
 
 #include "engraving/libmscore/page.h"
 #include "engraving/libmscore/system.h"
@@ -154,14 +158,20 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     score->update();
 
     // Setup painting
-    QImage frame(config.width, config.height, QImage::Format_RGB32);
-    frame.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
-    frame.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
+    //! NOTE The page is painted only when it changes, every frame is a copy of it with the cursor on top
+    QImage pageImage(config.width, config.height, QImage::Format_RGB32);
+    pageImage.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
+    pageImage.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
 
-    QPainter qp(&frame);
+    QPainter qp(&pageImage);
     qp.setRenderHint(QPainter::Antialiasing, true);
     qp.setRenderHint(QPainter::TextAntialiasing, true);
-    RectF frameRect = RectF::fromQRectF(QRectF(frame.rect()));
+    RectF frameRect = RectF::fromQRectF(QRectF(pageImage.rect()));
+
+    //! NOTE Same mapping as the page painting uses (see NotationPainting), so the cursor is in the page coordinates
+    SizeF pageSizeInch(score->styleD(Ms::Sid::pageWidth), score->styleD(Ms::Sid::pageHeight));
+    RectF cursorViewport(0.0, 0.0, pageSizeInch.width() * CANVAS_DPI, pageSizeInch.height() * CANVAS_DPI);
+    RectF cursorWindow(0.0, 0.0, pageSizeInch.width() * Ms::DPI, pageSizeInch.height() * Ms::DPI);
 
     draw::Painter painter(&qp, "video_writer");
 
@@ -176,19 +186,17 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     int frameCount = (totalPlayTimeSec + config.leadingSec + config.trailingSec) * config.fps;
 
     PageList pages = masterNotation->notation()->elements()->pages();
-
-    auto pageByTick = [](const PageList& pages, midi::tick_t tick) -> const Page* {
-        for (const Page* p : pages) {
-            if (tick <= static_cast<midi::tick_t>(p->endTick().ticks())) {
-                return p;
-            }
-        }
-        return nullptr;
-    };
+    size_t pageIdx = 0;
+    const Page* paintedPage = nullptr;
 
     PlaybackCursor cursor;
     cursor.setNotation(masterNotation->notation());
 
+    VideoFramesPipeline pipeline(&encoder, config.width, config.height);
+
+    auto startTime = std::chrono::steady_clock::now();
+    int encodedFrameCount = 0;
+
     for (int f = 0; f < frameCount; f++) {
         float currentTimeSec = (qreal)f / config.fps;
         currentTimeSec -= config.leadingSec;
@@ -201,19 +209,32 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
 
         midi::tick_t tick = playback->secToPlayedTick(currentTimeSec);
 
-        const Page* page = pageByTick(pages, tick);
-        if (!page) {
+        //! NOTE The tick only grows from frame to frame, so the page is searched from the current one
+        while (pageIdx < pages.size() && tick > static_cast<midi::tick_t>(pages.at(pageIdx)->endTick().ticks())) {
+            ++pageIdx;
+        }
+
+        if (pageIdx >= pages.size()) {
             break;
         }
 
-        INotationPainting::Options opt;
-        opt.fromPage = page->no();
-        opt.toPage = opt.fromPage;
-        opt.deviceDpi = CANVAS_DPI;
+        const Page* page = pages.at(pageIdx);
 
-        painter.fillRect(frameRect, draw::Color::white);
+        if (page != paintedPage) {
+            INotationPainting::Options opt;
+            opt.fromPage = page->no();
+            opt.toPage = opt.fromPage;
+            opt.deviceDpi = CANVAS_DPI;
 
-        painting->paintPrint(&painter, opt);
+            painter.fillRect(frameRect, draw::Color::white);
+
+            painting->paintPrint(&painter, opt);
+
+            paintedPage = page;
+        }
+
+        QImage frame = pipeline.takeFreeFrame();
+        std::memcpy(frame.bits(), pageImage.constBits(), pageImage.sizeInBytes());
 
         cursor.move(tick);
 
@@ -221,12 +242,25 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
         PointF pagePos = page->pos();
         RectF cursorAbsRect = cursorRect.translated(-pagePos);
 
-        painter.fillRect(cursorAbsRect, CURSOR_COLOR);
+        {
+            draw::Painter cursorPainter(&frame, "video_writer_cursor");
+            cursorPainter.setAntialiasing(true);
+            cursorPainter.setViewport(cursorViewport);
+            cursorPainter.setWindow(cursorWindow);
+            cursorPainter.fillRect(cursorAbsRect, CURSOR_COLOR);
+        }
 
-        encoder.encodeImage(frame);
+        pipeline.pushFrame(std::move(frame));
+        ++encodedFrameCount;
     }
 
+    bool ok = pipeline.finish();
+
     encoder.close();
 
-    return make_ok();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    LOGI() << "encoded " << encodedFrameCount << " frames (" << config.width << "x" << config.height << ") in "
+           << elapsed.count() << " sec, " << (elapsed.count() > 0 ? encodedFrameCount / elapsed.count() : 0) << " frames/sec";
+
+    return ok ? make_ok() : make_ret(Ret::Code::UnknownError);
 }
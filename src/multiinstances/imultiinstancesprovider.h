@@ -25,6 +25,8 @@
 #include <string>
 #include <vector>
 
+#include <QByteArray>
+
 #include "modularity/imoduleexport.h"
 #include "io/path.h"
 #include "mitypes.h"
@@ -60,6 +62,13 @@ public:
     virtual void notifyAboutResourceChanged(const std::string& name) = 0;
     virtual async::Channel<std::string> resourceChanged() = 0;
 
+    // Clipboard
+    //! NOTE Keeps the copied data, the other instances request it when they paste it. Returns the id
+    //! to put into the clipboard instead of the data, empty if the data itself should be put into the clipboard
+    virtual std::string shareClipboardData(const std::string& mimeType, const QByteArray& data) = 0;
+    //! NOTE The data kept by this or another instance under the given id, empty if no instance keeps it anymore
+    virtual ClipboardData sharedClipboardData(const std::string& id) const = 0;
+
     // Instances info
     virtual const std::string& selfID() const = 0;
     virtual bool isMainInstance() const = 0;
@@ -27,11 +27,20 @@
 #include "ipcserver.h"
 #include "ipclock.h"
 #include "ipcloop.h"
+#include "ipcsharedmemory.h"
 
-#include "log.h"
+#include "ipclog.h"
 
 using namespace mu::ipc;
 
+static const QString DATA_RECEIVED("DATA_RECEIVED");
+static const QString SHARED_DATA_PREFIX("shm:");
+static const QString INLINE_DATA_PREFIX("inline:");
+
+//! NOTE A segment costs more than sending the small data in the message
+static constexpr int MIN_SHARED_DATA_SIZE = 64 * 1024;
+static constexpr int SHARED_DATA_TIMEOUT_MSEC = 10000;
+
 IpcChannel::IpcChannel()
 {
     m_selfSocket = new IpcSocket();
@@ -43,6 +52,10 @@ IpcChannel::~IpcChannel()
 {
     delete m_selfSocket;
     delete m_server;
+
+    for (auto& p : m_sentData) {
+        delete p.second.memory;
+    }
 }
 
 const ID& IpcChannel::selfID() const
@@ -86,12 +99,126 @@ void IpcChannel::broadcast(const QString& method, const QStringList& args)
     send(res);
 }
 
+void IpcChannel::broadcastData(const QString& method, const QByteArray& data, const QStringList& args)
+{
+    int readers = instances().count() - 1; //! NOTE Exclude itself
+    if (readers <= 0) {
+        return;
+    }
+
+    broadcast(method, QStringList { shareData(data, readers) } + args);
+}
+
+void IpcChannel::responseData(const QString& method, const QByteArray& data, const QStringList& args, const ID& destID)
+{
+    response(method, QStringList { shareData(data, 1) } + args, destID);
+}
+
+QString IpcChannel::shareData(const QByteArray& data, int readers)
+{
+    releaseExpiredData();
+
+    if (data.size() >= MIN_SHARED_DATA_SIZE) {
+        IpcSharedMemory* memory = new IpcSharedMemory();
+        if (memory->create(data)) {
+            m_sentData[memory->key()] = SentData { memory, readers, QDeadlineTimer(SHARED_DATA_TIMEOUT_MSEC) };
+            return SHARED_DATA_PREFIX + memory->key();
+        }
+
+        delete memory;
+        LOGW() << "failed share data, it will be sent in the message, size: " << data.size();
+    }
+
+    return INLINE_DATA_PREFIX + QString::fromLatin1(data.toBase64());
+}
+
+QByteArray IpcChannel::receiveData(const Msg& msg)
+{
+    IF_ASSERT_FAILED(!msg.args.isEmpty()) {
+        return QByteArray();
+    }
+
+    const QString& ref = msg.args.at(0);
+    if (ref.startsWith(INLINE_DATA_PREFIX)) {
+        return QByteArray::fromBase64(ref.mid(INLINE_DATA_PREFIX.size()).toLatin1());
+    }
+
+    IF_ASSERT_FAILED(ref.startsWith(SHARED_DATA_PREFIX)) {
+        return QByteArray();
+    }
+
+    QString key = ref.mid(SHARED_DATA_PREFIX.size());
+
+    QByteArray data;
+    IpcSharedMemory memory(key);
+    if (memory.attach()) {
+        data = memory.toByteArray();
+        memory.detach();
+    }
+
+    //! NOTE The sender releases the segment when all the instances have read it
+    response(DATA_RECEIVED, { key }, msg.srcID);
+
+    return data;
+}
+
+void IpcChannel::onDataReceivedByInstance(const QString& key)
+{
+    auto it = m_sentData.find(key);
+    if (it == m_sentData.end()) {
+        return;
+    }
+
+    //! NOTE An instance connected after sending also reads the data
+    if (--it->second.pendingReaders <= 0) {
+        IPCLOG() << "release: " << key;
+        delete it->second.memory;
+        m_sentData.erase(it);
+    }
+}
+
+void IpcChannel::releaseExpiredData()
+{
+    for (auto it = m_sentData.begin(); it != m_sentData.end();) {
+        if (it->second.deadline.hasExpired()) {
+            LOGW() << "not all instances have read the data, release: " << it->first;
+            delete it->second.memory;
+            it = m_sentData.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 Code IpcChannel::syncRequestToAll(const QString& method, const QStringList& args, const OnReceived& onReceived)
 {
     IF_ASSERT_FAILED(onReceived) {
         return Code::Undefined;
     }
 
+    return doSyncRequestToAll(method, args, [onReceived](const Msg& msg) {
+        return onReceived(msg.args);
+    });
+}
+
+QStringList IpcChannel::syncRequestDataToAll(const QString& method, const QStringList& args, QByteArray& data)
+{
+    QStringList dataArgs;
+    doSyncRequestToAll(method, args, [this, &data, &dataArgs](const Msg& msg) {
+        if (msg.args.isEmpty()) {
+            return false;
+        }
+
+        data = receiveData(msg);
+        dataArgs = msg.args.mid(1);
+        return true;
+    });
+
+    return dataArgs;
+}
+
+Code IpcChannel::doSyncRequestToAll(const QString& method, const QStringList& args, const std::function<bool(const Msg&)>& onReceived)
+{
     Msg msg;
     msg.destID = ipc::BROADCAST_ID;
     msg.type = MsgType::Request;
@@ -110,7 +237,7 @@ Code IpcChannel::syncRequestToAll(const QString& method, const QStringList& args
         }
 
         ++received;
-        bool success = onReceived(msg.args);
+        bool success = onReceived(msg);
         if (success) {
             loop.exit(Code::Success);
             return;
@@ -133,6 +260,16 @@ Code IpcChannel::syncRequestToAll(const QString& method, const QStringList& args
 
 void IpcChannel::onSocketMsgReceived(const Msg& msg)
 {
+    if (msg.type == MsgType::Response && msg.method == DATA_RECEIVED) {
+        IF_ASSERT_FAILED(!msg.args.isEmpty()) {
+            return;
+        }
+
+        onDataReceivedByInstance(msg.args.at(0));
+        releaseExpiredData();
+        return;
+    }
+
     if (m_msgCallback) {
         m_msgCallback(msg);
     }
@@ -23,9 +23,11 @@
 #define MU_IPC_IPCCHANNEL_H
 
 #include <functional>
+#include <map>
 
 #include <QString>
 #include <QList>
+#include <QDeadlineTimer>
 
 #include "ipc.h"
 
@@ -39,6 +41,7 @@ namespace mu::ipc {
 //! NOTE Inter-Process Communication Channel
 class IpcSocket;
 class IpcServer;
+class IpcSharedMemory;
 class IpcChannel : public async::Asyncable
 {
 public:
@@ -57,9 +60,27 @@ public:
     void response(const QString& method, const QStringList& args, const ID& destID);
     void broadcast(const QString& method, const QStringList& args = {});
 
+    //! NOTE The data is passed through the shared memory, the first argument of the message
+    //! is the key of the segment (see IpcSharedMemory). Small data, or if the segment can't be created,
+    //! is passed in the argument itself. The segment is kept until all the instances have read the data
+    //! or until the timeout, if some instance doesn't read it
+    void broadcastData(const QString& method, const QByteArray& data, const QStringList& args = {});
+
+    //! NOTE Responds to a request with the data, the same way as broadcastData
+    void responseData(const QString& method, const QByteArray& data, const QStringList& args, const ID& destID);
+
+    //! NOTE Reads the data of a message sent by broadcastData or responseData, the rest of the arguments follow it.
+    //! The data is copied out of the segment once: the sender releases the segment as soon as it is told
+    //! the data has been read, so it can't be used in place after this returns
+    QByteArray receiveData(const Msg& msg);
+
     using OnReceived = std::function<bool (const QStringList&)>;
     Code syncRequestToAll(const QString& method, const QStringList& args, const OnReceived& onReceived);
 
+    //! NOTE Requests the data from the other instances. The instance having it responds with responseData,
+    //! the others respond without arguments. Returns the arguments following the data, the data is put into data
+    QStringList syncRequestDataToAll(const QString& method, const QStringList& args, QByteArray& data);
+
     QList<ID> instances() const;
     async::Notification instancesChanged() const;
 
@@ -68,9 +89,20 @@ private:
     void setupConnection();
     void onDisconnected();
     void onSocketMsgReceived(const Msg& msg);
+    QString shareData(const QByteArray& data, int readers);
+    Code doSyncRequestToAll(const QString& method, const QStringList& args, const std::function<bool(const Msg&)>& onReceived);
+    void onDataReceivedByInstance(const QString& key);
+    void releaseExpiredData();
+
+    struct SentData {
+        IpcSharedMemory* memory = nullptr;
+        int pendingReaders = 0;
+        QDeadlineTimer deadline;
+    };
 
     IpcSocket* m_selfSocket = nullptr;
     IpcServer* m_server = nullptr;
+    std::map<QString, SentData> m_sentData;
     std::function<void(const Msg&)> m_msgCallback;
     async::Channel<Msg> m_msgReceived;
 };
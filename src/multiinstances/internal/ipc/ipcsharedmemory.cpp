@@ -0,0 +1,161 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "ipcsharedmemory.h"
+
+#include <cstring>
+#include <limits>
+
+#include <QSharedMemory>
+#include <QUuid>
+
+#include "ipclog.h"
+
+using namespace mu::ipc;
+
+//! NOTE The segment starts with the size of the payload,
+//! because the size of the segment may be rounded up by the system
+using PayloadSize = qint64;
+static constexpr qint64 HEADER_SIZE = sizeof(PayloadSize);
+
+IpcSharedMemory::IpcSharedMemory(const QString& key)
+    : m_key(key)
+{
+}
+
+IpcSharedMemory::~IpcSharedMemory()
+{
+    delete m_memory;
+}
+
+const QString& IpcSharedMemory::key() const
+{
+    return m_key;
+}
+
+bool IpcSharedMemory::create(const QByteArray& data)
+{
+    return create(data.constData(), data.size());
+}
+
+bool IpcSharedMemory::create(const char* data, qint64 size)
+{
+    IF_ASSERT_FAILED(size >= 0) {
+        return false;
+    }
+
+    delete m_memory;
+
+    m_key = "musescore-ipc-data-" + QUuid::createUuid().toString(QUuid::Id128);
+    m_memory = new QSharedMemory(m_key);
+
+    if (!m_memory->create(HEADER_SIZE + size)) {
+        LOGE() << "failed create shared memory, size: " << size << ", err: " << m_memory->errorString();
+        delete m_memory;
+        m_memory = nullptr;
+        return false;
+    }
+
+    char* ptr = static_cast<char*>(m_memory->data());
+    PayloadSize payloadSize = size;
+    std::memcpy(ptr, &payloadSize, HEADER_SIZE);
+    if (size > 0) {
+        std::memcpy(ptr + HEADER_SIZE, data, size);
+    }
+
+    IPCLOG() << "created: " << m_key << ", size: " << size;
+
+    return true;
+}
+
+bool IpcSharedMemory::attach()
+{
+    IF_ASSERT_FAILED(!m_key.isEmpty()) {
+        return false;
+    }
+
+    if (isAttached()) {
+        return true;
+    }
+
+    if (!m_memory) {
+        m_memory = new QSharedMemory(m_key);
+    }
+
+    if (!m_memory->attach(QSharedMemory::ReadOnly)) {
+        LOGE() << "failed attach to shared memory: " << m_key << ", err: " << m_memory->errorString();
+        return false;
+    }
+
+    if (m_memory->size() < HEADER_SIZE || size() < 0 || size() > m_memory->size() - HEADER_SIZE) {
+        LOGE() << "bad shared memory: " << m_key;
+        m_memory->detach();
+        return false;
+    }
+
+    return true;
+}
+
+void IpcSharedMemory::detach()
+{
+    if (m_memory && m_memory->isAttached()) {
+        m_memory->detach();
+    }
+}
+
+bool IpcSharedMemory::isAttached() const
+{
+    return m_memory && m_memory->isAttached();
+}
+
+const char* IpcSharedMemory::data() const
+{
+    if (!isAttached()) {
+        return nullptr;
+    }
+
+    return static_cast<const char*>(m_memory->constData()) + HEADER_SIZE;
+}
+
+qint64 IpcSharedMemory::size() const
+{
+    if (!isAttached()) {
+        return 0;
+    }
+
+    PayloadSize payloadSize = 0;
+    std::memcpy(&payloadSize, m_memory->constData(), HEADER_SIZE);
+    return payloadSize;
+}
+
+QByteArray IpcSharedMemory::toByteArray() const
+{
+    if (!isAttached()) {
+        return QByteArray();
+    }
+
+    if (size() > std::numeric_limits<int>::max()) {
+        LOGE() << "too big for a byte array: " << m_key << ", size: " << size();
+        return QByteArray();
+    }
+
+    return QByteArray(data(), static_cast<int>(size()));
+}
@@ -0,0 +1,64 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_IPC_IPCSHAREDMEMORY_H
+#define MU_IPC_IPCSHAREDMEMORY_H
+
+#include <QString>
+#include <QByteArray>
+
+class QSharedMemory;
+namespace mu::ipc {
+//! NOTE Shared memory segment for the bulk payloads (e.g. the MSCX of the copied selection or a score snapshot).
+//! The writer creates a segment and sends only its key in the message, the readers attach to the segment
+//! and read the payload in place, so the payload is neither serialized into the message nor sent through the socket.
+//! The payload isn't changed after the segment is created, so it is read without locking
+class IpcSharedMemory
+{
+public:
+    IpcSharedMemory(const QString& key = QString());
+    ~IpcSharedMemory();
+
+    const QString& key() const;
+
+    //! NOTE Creates a new segment with a unique key and copies the data into it.
+    //! The segment is alive while this object is alive
+    bool create(const QByteArray& data);
+    bool create(const char* data, qint64 size);
+
+    //! NOTE Attaches to the segment created by another instance, read only
+    bool attach();
+    void detach();
+    bool isAttached() const;
+
+    //! NOTE The payload in place, valid while the segment is attached
+    const char* data() const;
+    qint64 size() const;
+
+    QByteArray toByteArray() const;
+
+private:
+    QSharedMemory* m_memory = nullptr;
+    QString m_key;
+};
+}
+
+#endif // MU_IPC_IPCSHAREDMEMORY_H
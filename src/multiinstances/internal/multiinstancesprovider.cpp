@@ -25,6 +25,10 @@
 #include <QCoreApplication>
 #include <QTimer>
 #include <QEventLoop>
+#include <QUuid>
+#include <QGuiApplication>
+#include <QClipboard>
+#include <QMimeData>
 
 #include "uri.h"
 #include "settings.h"
@@ -49,6 +53,10 @@ static const QString METHOD_SETTINGS_ROLLBACK_TRANSACTION("SETTINGS_ROLLBACK_TRA
 static const QString METHOD_SETTINGS_SET_VALUE("SETTINGS_SET_VALUE");
 static const QString METHOD_QUIT("METHOD_QUIT");
 static const QString METHOD_RESOURCE_CHANGED("RESOURCE_CHANGED");
+static const QString METHOD_CLIPBOARD_DATA("CLIPBOARD_DATA");
+
+//! NOTE Smaller data is cheaper to put into the clipboard than to request from another instance
+static constexpr int MIN_SHARED_CLIPBOARD_DATA_SIZE = 64 * 1024;
 
 MultiInstancesProvider::~MultiInstancesProvider()
 {
@@ -72,6 +80,24 @@ void MultiInstancesProvider::init()
     m_ipcChannel->connect();
 }
 
+void MultiInstancesProvider::deinit()
+{
+    if (m_clipboardDataId.empty()) {
+        return;
+    }
+
+    //! NOTE The other instances can't request the copied data from this one anymore, put it into the clipboard
+    QClipboard* clipboard = QGuiApplication::clipboard();
+    const QMimeData* mimeData = clipboard->mimeData();
+    if (!mimeData || mimeData->data(SHARED_CLIPBOARD_ID_MIME_TYPE).toStdString() != m_clipboardDataId) {
+        return;
+    }
+
+    QMimeData* restored = new QMimeData();
+    restored->setData(QString::fromStdString(m_clipboardData.mimeType), m_clipboardData.data);
+    clipboard->setMimeData(restored);
+}
+
 bool MultiInstancesProvider::isInited() const
 {
     return m_ipcChannel != nullptr;
@@ -91,7 +117,7 @@ void MultiInstancesProvider::onMsg(const Msg& msg)
         m_ipcChannel->response(METHOD_PROJECT_IS_OPENED, { QString::number(isOpened) }, msg.srcID);
     } else if (msg.method == METHOD_ACTIVATE_WINDOW_WITH_PROJECT) {
         CHECK_ARGS_COUNT(1);
-        io::path_t scorePath = io::path_t(msg.args.at(0));
+        io::path_t scorePath = io::path_t(QString::fromUtf8(m_ipcChannel->receiveData(msg)));
         bool isOpened = projectFilesController()->isProjectOpened(scorePath);
         if (isOpened) {
             mainWindow()->requestShowOnFront();
@@ -131,6 +157,16 @@ void MultiInstancesProvider::onMsg(const Msg& msg)
     } else if (msg.method == METHOD_RESOURCE_CHANGED) {
         resourceChanged().send(msg.args.at(0).toStdString());
     }
+    // Clipboard
+    else if (msg.type == MsgType::Request && msg.method == METHOD_CLIPBOARD_DATA) {
+        CHECK_ARGS_COUNT(1);
+        if (!m_clipboardDataId.empty() && msg.args.at(0).toStdString() == m_clipboardDataId) {
+            m_ipcChannel->responseData(METHOD_CLIPBOARD_DATA, m_clipboardData.data,
+                                       { QString::fromStdString(m_clipboardData.mimeType) }, msg.srcID);
+        } else {
+            m_ipcChannel->response(METHOD_CLIPBOARD_DATA, {}, msg.srcID);
+        }
+    }
 }
 
 bool MultiInstancesProvider::isProjectAlreadyOpened(const io::path_t& projectPath) const
@@ -161,7 +197,7 @@ void MultiInstancesProvider::activateWindowWithProject(const io::path_t& project
     }
 
     mainWindow()->requestShowOnBack();
-    m_ipcChannel->broadcast(METHOD_ACTIVATE_WINDOW_WITH_PROJECT, { projectPath.toQString() });
+    m_ipcChannel->broadcastData(METHOD_ACTIVATE_WINDOW_WITH_PROJECT, projectPath.toQString().toUtf8());
 }
 
 bool MultiInstancesProvider::isHasAppInstanceWithoutProject() const
@@ -350,6 +386,42 @@ mu::async::Channel<std::string> MultiInstancesProvider::resourceChanged()
     return m_resourceChanged;
 }
 
+std::string MultiInstancesProvider::shareClipboardData(const std::string& mimeType, const QByteArray& data)
+{
+    m_clipboardDataId.clear();
+    m_clipboardData = ClipboardData();
+
+    if (!isInited() || data.size() < MIN_SHARED_CLIPBOARD_DATA_SIZE || m_ipcChannel->instances().count() < 2) {
+        return std::string();
+    }
+
+    //! NOTE Nothing is sent now, the segment is created when another instance requests the data
+    m_clipboardDataId = QUuid::createUuid().toString(QUuid::Id128).toStdString();
+    m_clipboardData = ClipboardData { mimeType, data };
+
+    return m_clipboardDataId;
+}
+
+ClipboardData MultiInstancesProvider::sharedClipboardData(const std::string& id) const
+{
+    if (id.empty() || !isInited()) {
+        return ClipboardData();
+    }
+
+    if (id == m_clipboardDataId) {
+        return m_clipboardData;
+    }
+
+    ClipboardData result;
+    QStringList args = m_ipcChannel->syncRequestDataToAll(METHOD_CLIPBOARD_DATA, { QString::fromStdString(id) }, result.data);
+    if (args.isEmpty()) {
+        return ClipboardData();
+    }
+
+    result.mimeType = args.at(0).toStdString();
+    return result;
+}
+
 const std::string& MultiInstancesProvider::selfID() const
 {
     return m_selfID;
@@ -50,6 +50,7 @@ public:
     ~MultiInstancesProvider();
 
     void init();
+    void deinit();
 
     // Project opening
     bool isProjectAlreadyOpened(const io::path_t& projectPath) const override;
@@ -72,6 +73,10 @@ public:
     void notifyAboutResourceChanged(const std::string& name) override;
     async::Channel<std::string> resourceChanged() override;
 
+    // Clipboard
+    std::string shareClipboardData(const std::string& mimeType, const QByteArray& data) override;
+    ClipboardData sharedClipboardData(const std::string& id) const override;
+
     // Instances info
     const std::string& selfID() const override;
     bool isMainInstance() const override;
@@ -96,6 +101,9 @@ private:
     async::Channel<std::string> m_resourceChanged;
 
     std::map<std::string, ipc::IpcLock*> m_locks;
+
+    std::string m_clipboardDataId;
+    ClipboardData m_clipboardData;
 };
 }
 
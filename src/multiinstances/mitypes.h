@@ -24,12 +24,23 @@
 
 #include <string>
 
+#include <QByteArray>
+
 namespace mu::mi {
 struct InstanceMeta
 {
     std::string id;
     bool isServer = false;
 };
+
+//! NOTE The clipboard format of the id of the copied data kept by an instance
+static constexpr const char* SHARED_CLIPBOARD_ID_MIME_TYPE = "application/musescore/shared-clipboard-id";
+
+struct ClipboardData
+{
+    std::string mimeType;
+    QByteArray data;
+};
 }
 
 #endif // MU_MI_MITYPES_H
@@ -83,3 +83,8 @@ void MultiInstancesModule::onInit(const framework::IApplication::RunMode& mode)
 
     s_multiInstancesProvider->init();
 }
+
+void MultiInstancesModule::onDeinit()
+{
+    s_multiInstancesProvider->deinit();
+}
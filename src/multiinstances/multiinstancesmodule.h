@@ -35,6 +35,7 @@ public:
     void registerUiTypes() override;
     void registerResources() override;
     void onInit(const framework::IApplication::RunMode& mode) override;
+    void onDeinit() override;
 };
 }
 
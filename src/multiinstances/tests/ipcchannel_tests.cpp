@@ -0,0 +1,224 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+
+#include "async/asyncable.h"
+#include "async/processevents.h"
+
+#include "multiinstances/internal/ipc/ipcchannel.h"
+#include "multiinstances/internal/ipc/ipcsharedmemory.h"
+
+using namespace mu;
+using namespace mu::ipc;
+
+static const QString METHOD_PASTE("PASTE");
+
+//! NOTE Two channels of this process talk through the local socket, like two instances
+class MultiInstances_IpcChannelTests : public ::testing::Test, public async::Asyncable
+{
+public:
+    void SetUp() override
+    {
+        m_sender = std::make_unique<IpcChannel>();
+        m_sender->connect();
+
+        m_receiver = std::make_unique<IpcChannel>();
+        m_receiver->connect();
+        m_receiver->msgReceived().onReceive(this, [this](const Msg& msg) {
+            if (msg.method == METHOD_PASTE) {
+                m_received.push_back(msg);
+            }
+        });
+
+        processEventsUntil([this]() {
+            return m_sender->instances().count() == 2 && m_receiver->instances().count() == 2;
+        });
+        ASSERT_EQ(m_sender->instances().count(), 2);
+    }
+
+    void TearDown() override
+    {
+        m_receiver.reset();
+        m_sender.reset();
+    }
+
+    static void processEventsUntil(const std::function<bool()>& condition, int timeoutMs = 5000)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        while (!condition() && timer.elapsed() < timeoutMs) {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+            async::processEvents();
+        }
+    }
+
+    static QByteArray pasteBuffer(int size)
+    {
+        static const QByteArray CHORD("<Chord><durationType>quarter</durationType><Note><pitch>60</pitch><tpc>14</tpc></Note></Chord>\n");
+
+        QByteArray data;
+        data.reserve(size);
+        while (data.size() < size) {
+            data.append(CHORD);
+        }
+        data.resize(size);
+
+        return data;
+    }
+
+    static QString sharedMemoryKey(const Msg& msg)
+    {
+        const QString prefix("shm:");
+        return msg.args.at(0).startsWith(prefix) ? msg.args.at(0).mid(prefix.size()) : QString();
+    }
+
+protected:
+    std::unique_ptr<IpcChannel> m_sender;
+    std::unique_ptr<IpcChannel> m_receiver;
+    std::vector<Msg> m_received;
+};
+
+TEST_F(MultiInstances_IpcChannelTests, BroadcastData_SharedMemory)
+{
+    //! [GIVEN] A large paste buffer
+    QByteArray data = pasteBuffer(1 << 20);
+
+    //! [WHEN] Broadcast it
+    m_sender->broadcastData(METHOD_PASTE, data, { "arg" });
+    processEventsUntil([this]() { return !m_received.empty(); });
+
+    //! [THEN] Only the key of the segment goes through the socket
+    ASSERT_EQ(m_received.size(), 1);
+    const Msg& msg = m_received.front();
+    QString key = sharedMemoryKey(msg);
+    EXPECT_FALSE(key.isEmpty());
+    ASSERT_EQ(msg.args.size(), 2);
+    EXPECT_EQ(msg.args.at(1), "arg");
+
+    //! [THEN] The receiver reads the data
+    EXPECT_EQ(m_receiver->receiveData(msg), data);
+
+    //! [THEN] The segment is released when the receiver has read it
+    processEventsUntil([&key]() { return !IpcSharedMemory(key).attach(); });
+    EXPECT_FALSE(IpcSharedMemory(key).attach());
+}
+
+TEST_F(MultiInstances_IpcChannelTests, BroadcastData_SegmentsOutliveNextSend)
+{
+    //! [GIVEN] Two large payloads sent one after another
+    QByteArray first = pasteBuffer(1 << 20);
+    QByteArray second = pasteBuffer(2 << 20);
+
+    m_sender->broadcastData(METHOD_PASTE, first);
+    m_sender->broadcastData(METHOD_PASTE, second);
+
+    //! [WHEN] The receiver reads them after both have been sent
+    processEventsUntil([this]() { return m_received.size() == 2; });
+    ASSERT_EQ(m_received.size(), 2);
+
+    //! [THEN] The first segment is still there
+    EXPECT_EQ(m_receiver->receiveData(m_received.at(0)), first);
+    EXPECT_EQ(m_receiver->receiveData(m_received.at(1)), second);
+}
+
+TEST_F(MultiInstances_IpcChannelTests, BroadcastData_SmallDataInMessage)
+{
+    //! [GIVEN] A small payload
+    QByteArray data = pasteBuffer(100);
+
+    //! [WHEN] Broadcast it
+    m_sender->broadcastData(METHOD_PASTE, data);
+    processEventsUntil([this]() { return !m_received.empty(); });
+
+    //! [THEN] It is passed in the message itself
+    ASSERT_EQ(m_received.size(), 1);
+    EXPECT_TRUE(sharedMemoryKey(m_received.front()).isEmpty());
+    EXPECT_EQ(m_receiver->receiveData(m_received.front()), data);
+}
+
+TEST_F(MultiInstances_IpcChannelTests, SyncRequestData_SharedMemory)
+{
+    //! [GIVEN] The sender keeps a large paste buffer until it is requested
+    QByteArray data = pasteBuffer(1 << 20);
+    m_sender->msgReceived().onReceive(this, [this, &data](const Msg& msg) {
+        if (msg.type == MsgType::Request && msg.method == METHOD_PASTE) {
+            m_sender->responseData(METHOD_PASTE, data, { "arg" }, msg.srcID);
+        }
+    });
+
+    //! [WHEN] The receiver requests it
+    QByteArray received;
+    QStringList args = m_receiver->syncRequestDataToAll(METHOD_PASTE, {}, received);
+
+    //! [THEN] The receiver gets the data and the arguments following it
+    EXPECT_EQ(received, data);
+    ASSERT_EQ(args.size(), 1);
+    EXPECT_EQ(args.at(0), "arg");
+}
+
+//! NOTE Throughput of a large paste buffer from one channel to another:
+//! through the shared memory vs as an argument of the message, run with --gtest_also_run_disabled_tests
+TEST_F(MultiInstances_IpcChannelTests, DISABLED_Throughput)
+{
+    constexpr int ITERATIONS = 10;
+
+    auto megabytesPerSecond = [](int size, std::chrono::steady_clock::duration elapsed) {
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        return (double(size) * ITERATIONS / (1 << 20)) / seconds;
+    };
+
+    for (int size : { 1 << 20, 16 << 20, 64 << 20 }) {
+        QByteArray data = pasteBuffer(size);
+
+        m_received.clear();
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < ITERATIONS; ++i) {
+            m_sender->broadcastData(METHOD_PASTE, data);
+            processEventsUntil([this, i]() { return m_received.size() > size_t(i); }, 60000);
+            ASSERT_EQ(m_receiver->receiveData(m_received.back()).size(), size);
+        }
+
+        auto sharedMemoryElapsed = std::chrono::steady_clock::now() - start;
+
+        m_received.clear();
+        start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < ITERATIONS; ++i) {
+            m_sender->broadcast(METHOD_PASTE, { QString::fromUtf8(data) });
+            processEventsUntil([this, i]() { return m_received.size() > size_t(i); }, 60000);
+            ASSERT_EQ(m_received.back().args.at(0).size(), size);
+        }
+
+        auto messageElapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << (size >> 20) << " MB: shared memory " << megabytesPerSecond(size, sharedMemoryElapsed) << " MB/s, "
+                  << "message " << megabytesPerSecond(size, messageElapsed) << " MB/s" << std::endl;
+    }
+}
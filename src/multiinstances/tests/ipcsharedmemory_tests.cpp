@@ -0,0 +1,116 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <QSharedMemory>
+
+#include "multiinstances/internal/ipc/ipcsharedmemory.h"
+
+using namespace mu::ipc;
+
+class MultiInstances_IpcSharedMemoryTests : public ::testing::Test
+{
+public:
+    static QByteArray pasteBuffer(int size)
+    {
+        static const QByteArray CHORD("<Chord><durationType>quarter</durationType><Note><pitch>60</pitch><tpc>14</tpc></Note></Chord>\n");
+
+        QByteArray data;
+        data.reserve(size);
+        while (data.size() < size) {
+            data.append(CHORD);
+        }
+        data.resize(size);
+
+        return data;
+    }
+};
+
+TEST_F(MultiInstances_IpcSharedMemoryTests, WriteAndRead)
+{
+    //! [GIVEN] Some data written to the shared memory
+    QByteArray data = pasteBuffer(100000);
+
+    IpcSharedMemory writer;
+    ASSERT_TRUE(writer.create(data));
+    EXPECT_FALSE(writer.key().isEmpty());
+
+    //! [WHEN] Attach to the segment by its key
+    IpcSharedMemory reader(writer.key());
+    ASSERT_TRUE(reader.attach());
+
+    //! [THEN] The reader sees the same data
+    EXPECT_EQ(reader.size(), data.size());
+    EXPECT_EQ(reader.toByteArray(), data);
+}
+
+TEST_F(MultiInstances_IpcSharedMemoryTests, EmptyData)
+{
+    //! [GIVEN] Empty data written to the shared memory
+    IpcSharedMemory writer;
+    ASSERT_TRUE(writer.create(QByteArray()));
+
+    //! [WHEN] Attach to the segment
+    IpcSharedMemory reader(writer.key());
+    ASSERT_TRUE(reader.attach());
+
+    //! [THEN] The payload is empty
+    EXPECT_EQ(reader.size(), 0);
+    EXPECT_TRUE(reader.toByteArray().isEmpty());
+}
+
+TEST_F(MultiInstances_IpcSharedMemoryTests, SegmentIsReleasedWithWriter)
+{
+    //! [GIVEN] The key of a segment whose writer is already destroyed
+    QString key;
+    {
+        IpcSharedMemory writer;
+        ASSERT_TRUE(writer.create(pasteBuffer(1000)));
+        key = writer.key();
+    }
+
+    //! [WHEN] Attach to the segment
+    IpcSharedMemory reader(key);
+
+    //! [THEN] The segment doesn't exist anymore
+    EXPECT_FALSE(reader.attach());
+    EXPECT_EQ(reader.data(), nullptr);
+}
+
+TEST_F(MultiInstances_IpcSharedMemoryTests, NegativeSizeIsRejected)
+{
+    //! [GIVEN] A segment whose header has a negative payload size
+    QString key = "musescore-ipc-data-tests-negative-size";
+    QSharedMemory memory(key);
+    ASSERT_TRUE(memory.create(sizeof(qint64) + 16));
+    qint64 badSize = -1;
+    std::memcpy(memory.data(), &badSize, sizeof(badSize));
+
+    //! [WHEN] Attach to the segment
+    IpcSharedMemory reader(key);
+
+    //! [THEN] It is rejected
+    EXPECT_FALSE(reader.attach());
+    EXPECT_EQ(reader.size(), 0);
+}
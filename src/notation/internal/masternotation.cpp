@@ -468,6 +468,8 @@ void MasterNotation::addExcerpts(const ExcerptNotationList& excerpts)
     undoStack()->prepareChanges();
 
     ExcerptNotationList result = m_excerpts.val;
+    std::vector<Ms::Excerpt*> excerptsToCreate;
+
     for (IExcerptNotationPtr excerptNotation : excerpts) {
         auto it = std::find(result.cbegin(), result.cend(), excerptNotation);
         if (it != result.end()) {
@@ -477,13 +479,15 @@ void MasterNotation::addExcerpts(const ExcerptNotationList& excerpts)
         ExcerptNotation* excerptNotationImpl = get_impl(excerptNotation);
 
         if (!excerptNotationImpl->isCreated()) {
-            masterScore()->initAndAddExcerpt(excerptNotationImpl->excerpt(), false);
+            excerptsToCreate.push_back(excerptNotationImpl->excerpt());
             excerptNotationImpl->setIsCreated(true);
         }
 
         result.push_back(excerptNotation);
     }
 
+    masterScore()->initAndAddExcerpts(excerptsToCreate, false);
+
     masterScore()->setExcerptsChanged(false);
 
     undoStack()->commitChanges();
@@ -693,9 +697,7 @@ void MasterNotation::addExcerptsToMasterScore(const std::vector<Ms::Excerpt*>& e
 {
     TRACEFUNC;
 
-    for (Ms::Excerpt* excerpt : excerpts) {
-        masterScore()->initAndAddExcerpt(excerpt, false);
-    }
+    masterScore()->initAndAddExcerpts(excerpts, false);
 
     masterScore()->setExcerptsChanged(false);
 }
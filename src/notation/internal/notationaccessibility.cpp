@@ -37,6 +37,8 @@
 
 #include "accessibility/accessibleroot.h"
 
+#include "log.h"
+
 using namespace mu::notation;
 using namespace mu::async;
 using namespace mu::engraving;
@@ -46,10 +48,12 @@ NotationAccessibility::NotationAccessibility(const Notation* notation)
 {
     notation->interaction()->selectionChanged().onNotify(this, [this]() {
         updateAccessibilityInfo();
+        updateAccessibleFocus(true);
     });
 
     notation->notationChanged().onNotify(this, [this]() {
         updateAccessibilityInfo();
+        updateAccessibleFocus(false);
     });
 }
 
@@ -82,6 +86,8 @@ void NotationAccessibility::setEnabled(bool enabled)
 
 void NotationAccessibility::updateAccessibilityInfo()
 {
+    TRACEFUNC;
+
     if (!score()) {
         return;
     }
@@ -102,6 +108,34 @@ void NotationAccessibility::updateAccessibilityInfo()
     setAccessibilityInfo(newAccessibilityInfo);
 }
 
+void NotationAccessibility::updateAccessibleFocus(bool selectionChanged)
+{
+    TRACEFUNC;
+
+    if (!score()) {
+        return;
+    }
+
+    //! NOTE The accessible objects are created only for the focused elements,
+    //! so the focus is moved once per selection change, not for every selected element
+    const std::vector<EngravingItem*>& elements = selection()->elements();
+    if (elements.empty()) {
+        return;
+    }
+
+    EngravingItem* element = elements.back();
+
+    //! NOTE An edit keeps the focus on the element, only its changed name is announced
+    AccessibleItem* accessible = element->accessible();
+    AccessibleRoot* accessibleRoot = accessible ? accessible->accessibleRoot() : nullptr;
+    if (!selectionChanged && accessibleRoot && accessibleRoot->focusedElement() == accessible) {
+        accessibleRoot->updateFocusedElementName();
+        return;
+    }
+
+    element->setAccessibleFocus();
+}
+
 void NotationAccessibility::setAccessibilityInfo(const QString& info)
 {
     std::string infoStd = info.toStdString();
@@ -53,6 +53,7 @@ private:
     const Ms::Selection* selection() const;
 
     void updateAccessibilityInfo();
+    void updateAccessibleFocus(bool selectionChanged);
     void setAccessibilityInfo(const QString& info);
 
     QString rangeAccessibilityInfo() const;
@@ -29,6 +29,7 @@
 #include <QClipboard>
 #include <QApplication>
 #include <QKeyEvent>
+#include <QMimeData>
 
 #include "defer.h"
 #include "ptrutils.h"
@@ -231,6 +232,7 @@ void NotationInteraction::notifyAboutNotationChanged()
 {
     TRACEFUNC;
 
+    resetHitTestCache();
     m_notation->notifyAboutNotationChanged();
 }
 
@@ -420,13 +422,16 @@ std::vector<EngravingItem*> NotationInteraction::elementsAt(const PointF& p) con
         return {};
     }
 
-    std::vector<EngravingItem*> el = page->items(p - page->pos());
-    if (el.empty()) {
-        return {};
+    HitTestKey key = hitTestKey(page, p);
+    if (m_elementsAtCache.contains(key)) {
+        return m_elementsAtCache.result;
     }
 
+    std::vector<EngravingItem*> el = page->items(p - page->pos());
     std::sort(el.begin(), el.end(), NotationInteraction::elementIsLess);
 
+    m_elementsAtCache.set(key, el);
+
     return el;
 }
 
@@ -443,6 +448,11 @@ std::vector<Ms::EngravingItem*> NotationInteraction::hitElements(const PointF& p
         return {};
     }
 
+    HitTestKey key = hitTestKey(page, p_in, w);
+    if (m_hitElementsCache.contains(key)) {
+        return m_hitElementsCache.result;
+    }
+
     std::vector<Ms::EngravingItem*> ll;
 
     PointF p = p_in - page->pos();
@@ -452,6 +462,7 @@ std::vector<Ms::EngravingItem*> NotationInteraction::hitElements(const PointF& p
         RectF hitRect(p.x() - editW, p.y() - editW, 2.0 * editW, 2.0 * editW);
         if (m_editData.element->intersects(hitRect)) {
             ll.push_back(m_editData.element);
+            m_hitElementsCache.set(key, ll);
             return ll;
         }
     }
@@ -515,11 +526,19 @@ std::vector<Ms::EngravingItem*> NotationInteraction::hitElements(const PointF& p
         }
     }
 
+    m_hitElementsCache.set(key, ll);
+
     return ll;
 }
 
 NotationInteraction::HitMeasureData NotationInteraction::hitMeasure(const PointF& pos) const
 {
+    Ms::Page* page = point2page(pos);
+    HitTestKey key = hitTestKey(page, pos);
+    if (page && m_hitMeasureCache.contains(key)) {
+        return m_hitMeasureCache.result;
+    }
+
     Ms::staff_idx_t staffIndex = mu::nidx;
     Ms::Segment* segment = nullptr;
     PointF offset;
@@ -531,9 +550,48 @@ NotationInteraction::HitMeasureData NotationInteraction::hitMeasure(const PointF
         result.staff = score()->staff(staffIndex);
     }
 
+    if (page) {
+        m_hitMeasureCache.set(key, result);
+    }
+
     return result;
 }
 
+bool NotationInteraction::HitTestKey::operator==(const HitTestKey& other) const
+{
+    return page == other.page
+           && bspTreeRevision == other.bspTreeRevision
+           && pos == other.pos
+           && width == other.width
+           && editedElement == other.editedElement
+           && showInvisible == other.showInvisible;
+}
+
+NotationInteraction::HitTestKey NotationInteraction::hitTestKey(Ms::Page* page, const PointF& pos, float width) const
+{
+    HitTestKey key;
+    if (!page) {
+        return key;
+    }
+
+    //! NOTE The revision changes when the page is laid out, so the elements of the cached results are still alive
+    key.page = page;
+    key.bspTreeRevision = page->bspTreeRevision();
+    key.pos = pos;
+    key.width = width;
+    key.editedElement = isTextEditingStarted() ? m_editData.element : nullptr;
+    key.showInvisible = score()->showInvisible();
+
+    return key;
+}
+
+void NotationInteraction::resetHitTestCache()
+{
+    m_hitElementsCache = {};
+    m_elementsAtCache = {};
+    m_hitMeasureCache = {};
+}
+
 bool NotationInteraction::elementIsLess(const Ms::EngravingItem* e1, const Ms::EngravingItem* e2)
 {
     if (e1->selectable() && !e2->selectable()) {
@@ -3201,10 +3259,44 @@ void NotationInteraction::copySelection()
         if (!mimeData) {
             return;
         }
+        shareClipboardData(mimeData);
         QApplication::clipboard()->setMimeData(mimeData);
     }
 }
 
+void NotationInteraction::shareClipboardData(QMimeData* mimeData) const
+{
+    if (!multiInstancesProvider()) {
+        return;
+    }
+
+    QString mimeType = score()->selection().mimeType();
+    std::string id = multiInstancesProvider()->shareClipboardData(mimeType.toStdString(), mimeData->data(mimeType));
+    if (!id.empty()) {
+        //! NOTE The data stays in this instance, the clipboard only refers to it
+        mimeData->removeFormat(mimeType);
+        mimeData->setData(mi::SHARED_CLIPBOARD_ID_MIME_TYPE, QByteArray::fromStdString(id));
+    }
+}
+
+std::unique_ptr<QMimeData> NotationInteraction::sharedClipboardData(const QMimeData* mimeData) const
+{
+    if (!multiInstancesProvider() || !mimeData || !mimeData->hasFormat(mi::SHARED_CLIPBOARD_ID_MIME_TYPE)) {
+        return nullptr;
+    }
+
+    std::string id = mimeData->data(mi::SHARED_CLIPBOARD_ID_MIME_TYPE).toStdString();
+    mi::ClipboardData data = multiInstancesProvider()->sharedClipboardData(id);
+    if (data.data.isEmpty()) {
+        LOGW() << "the copied data isn't available anymore, id: " << id;
+        return nullptr;
+    }
+
+    auto shared = std::make_unique<QMimeData>();
+    shared->setData(QString::fromStdString(data.mimeType), data.data);
+    return shared;
+}
+
 void NotationInteraction::copyLyrics()
 {
     QString text = score()->extractLyrics();
@@ -3225,7 +3317,8 @@ void NotationInteraction::pasteSelection(const Fraction& scale)
         toTextBase(m_editData.element)->paste(m_editData, txt);
     } else {
         const QMimeData* mimeData = QApplication::clipboard()->mimeData();
-        score()->cmdPaste(mimeData, nullptr, scale);
+        std::unique_ptr<QMimeData> sharedMimeData = sharedClipboardData(mimeData);
+        score()->cmdPaste(sharedMimeData ? sharedMimeData.get() : mimeData, nullptr, scale);
     }
     apply();
 }
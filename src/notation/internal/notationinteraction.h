@@ -32,6 +32,7 @@
 #include "inotationconfiguration.h"
 #include "inotationundostack.h"
 #include "iselectinstrumentscenario.h"
+#include "multiinstances/imultiinstancesprovider.h"
 
 #include "libmscore/engravingitem.h"
 #include "libmscore/elementgroup.h"
@@ -48,6 +49,7 @@ class NotationInteraction : public INotationInteraction, public async::Asyncable
 {
     INJECT(notation, INotationConfiguration, configuration)
     INJECT(notation, ISelectInstrumentsScenario, selectInstrumentScenario)
+    INJECT(notation, mi::IMultiInstancesProvider, multiInstancesProvider)
 
 public:
     NotationInteraction(Notation* notation, INotationUndoStackPtr undoStack);
@@ -296,6 +298,9 @@ private:
     void startEditText(Ms::TextBase* text);
     bool needEndTextEdit() const;
 
+    void shareClipboardData(QMimeData* mimeData) const;
+    std::unique_ptr<QMimeData> sharedClipboardData(const QMimeData* mimeData) const;
+
     Ms::Page* point2page(const PointF& p) const;
     std::vector<EngravingItem*> hitElements(const PointF& p_in, float w) const;
     std::vector<EngravingItem*> elementsAt(const PointF& p) const;
@@ -351,6 +356,39 @@ private:
 
     HitMeasureData hitMeasure(const PointF& pos) const;
 
+    //! NOTE The results of the last hit-tests are reused while the page isn't laid out again,
+    //! e.g. hitElement and hitStaff on the same mouse press, or dropTarget while the mouse stays still
+    struct HitTestKey
+    {
+        const Ms::Page* page = nullptr;
+        int bspTreeRevision = 0;
+        PointF pos;
+        float width = 0.f;
+        const EngravingItem* editedElement = nullptr;
+        bool showInvisible = false;
+
+        bool operator==(const HitTestKey& other) const;
+    };
+
+    template<typename T>
+    struct HitTestCache
+    {
+        HitTestKey key;
+        T result;
+        bool valid = false;
+
+        bool contains(const HitTestKey& k) const { return valid && key == k; }
+        void set(const HitTestKey& k, const T& r)
+        {
+            key = k;
+            result = r;
+            valid = true;
+        }
+    };
+
+    HitTestKey hitTestKey(Ms::Page* page, const PointF& pos, float width = 0.f) const;
+    void resetHitTestCache();
+
     struct DragData
     {
         PointF beginMove;
@@ -396,6 +434,10 @@ private:
     bool m_notifyAboutDropChanged = false;
     HitElementContext m_hitElementContext;
 
+    mutable HitTestCache<std::vector<EngravingItem*> > m_hitElementsCache;
+    mutable HitTestCache<std::vector<EngravingItem*> > m_elementsAtCache;
+    mutable HitTestCache<HitMeasureData> m_hitMeasureCache;
+
     async::Channel<ShowItemRequest> m_showItemRequested;
 };
 }
@@ -102,6 +102,9 @@ mu::Ret PositionsWriter::write(INotationPtr notation, Device& destinationDevice,
         return make_ret(Ret::Code::UnknownError);
     }
 
+    //! NOTE The positions are taken from the layout, which may be postponed for a closed part
+    score->doPostponedLayout();
+
     QHash<void*, int> segments;
 
     XmlWriter writer(&destinationDevice);
@@ -21,6 +21,9 @@
  */
 #include "palettecelliconengine.h"
 
+#include <QPainter>
+#include <QPixmapCache>
+
 #include "engraving/infrastructure/draw/geometry.h"
 #include "engraving/infrastructure/draw/painter.h"
 #include "engraving/infrastructure/draw/pen.h"
@@ -47,11 +50,62 @@ QIconEngine* PaletteCellIconEngine::clone() const
 
 void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode mode, QIcon::State state)
 {
-    Painter p(qp, "palettecell");
-    p.save();
-    p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
-    p.restore();
+    const bool selected = mode == QIcon::Selected;
+    const bool current = state == QIcon::On;
+    const qreal dpr = qp->device() ? qp->device()->devicePixelRatioF() : 1.0;
+
+    //! NOTE Laying out and drawing the element is slow, so each cell is rendered once
+    //! and the pixmap is reused while the cell, its size and the colors are the same
+    const QString key = cacheKey(rect.size(), dpr, selected, current);
+
+    QPixmap pixmap;
+    if (!QPixmapCache::find(key, &pixmap)) {
+        pixmap = QPixmap(rect.size() * dpr);
+        pixmap.setDevicePixelRatio(dpr);
+        pixmap.fill(Qt::transparent);
+
+        {
+            QPainter pixmapPainter(&pixmap);
+            Painter p(&pixmapPainter, "palettecell");
+            p.setAntialiasing(true);
+            paintCell(p, RectF(0.0, 0.0, rect.width(), rect.height()), selected, current);
+        }
+
+        QPixmapCache::insert(key, pixmap);
+    }
+
+    qp->drawPixmap(rect, pixmap);
+}
+
+QString PaletteCellIconEngine::cacheKey(const QSize& size, qreal dpr, bool selected, bool current) const
+{
+    QString key = QString("palettecell_%1x%2_%3_%4%5_%6_%7_%8_%9")
+                  .arg(size.width())
+                  .arg(size.height())
+                  .arg(dpr)
+                  .arg(selected)
+                  .arg(current)
+                  .arg(m_extraMag)
+                  .arg(uiConfiguration()->guiScaling())
+                  .arg(configuration()->paletteSpatium())
+                  .arg(uiConfiguration()->logicalDpi());
+
+    //! NOTE The colors depend on the theme
+    key += QString("_%1_%2")
+           .arg(configuration()->elementsColor().rgba())
+           .arg(configuration()->accentColor().rgba());
+
+    if (m_cell) {
+        key += QString("_%1_%2_%3_%4_%5_%6")
+               .arg(m_cell->id)
+               .arg(quintptr(m_cell->element.get()))
+               .arg(m_cell->mag)
+               .arg(m_cell->xoffset)
+               .arg(m_cell->yoffset)
+               .arg(m_cell->drawStaff);
+    }
+
+    return key;
 }
 
 void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current) const
@@ -57,6 +57,8 @@ public:
     static void paintPaletteElement(void* context, Ms::EngravingItem* element);
 
 private:
+    QString cacheKey(const QSize& size, qreal dpr, bool selected, bool current) const;
+
     void paintCell(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
     void paintBackground(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
     void paintActionIcon(draw::Painter& painter, const RectF& rect, Ms::EngravingItem* element) const;
@@ -596,9 +596,6 @@ void PaletteProvider::init()
     m_userPaletteModel = new Ms::PaletteTreeModel(std::make_shared<PaletteTree>(), this);
     connect(m_userPaletteModel, &PaletteTreeModel::treeChanged, this, &PaletteProvider::notifyAboutUserPaletteChanged);
 
-    m_masterPaletteModel = new Ms::PaletteTreeModel(PaletteCreator::newMasterPaletteTree());
-    m_masterPaletteModel->setParent(this);
-
     m_searchFilterModel = new PaletteCellFilterProxyModel(this);
     m_searchFilterModel->setFilterCaseSensitivity(Qt::CaseInsensitive);
     m_searchFilterModel->setSourceModel(m_userPaletteModel);
@@ -617,6 +614,18 @@ void PaletteProvider::init()
     });
 }
 
+PaletteTreeModel* PaletteProvider::masterPaletteModel() const
+{
+    //! NOTE The master palette contains all the elements, it is created on demand,
+    //! when the user adds a palette or looks for more elements
+    if (!m_masterPaletteModel) {
+        m_masterPaletteModel = new Ms::PaletteTreeModel(PaletteCreator::newMasterPaletteTree());
+        m_masterPaletteModel->setParent(const_cast<PaletteProvider*>(this));
+    }
+
+    return m_masterPaletteModel;
+}
+
 void PaletteProvider::setSearching(bool searching)
 {
     if (m_isSearching == searching) {
@@ -707,7 +716,7 @@ FilterPaletteTreeModel* PaletteProvider::poolPaletteModel(const QModelIndex& ind
         return nullptr;
     }
 
-    FilterPaletteTreeModel* m = new FilterPaletteTreeModel(filter, m_masterPaletteModel);
+    FilterPaletteTreeModel* m = new FilterPaletteTreeModel(filter, masterPaletteModel());
     QQmlEngine::setObjectOwnership(m, QQmlEngine::JavaScriptOwnership);
     return m;
 }
@@ -738,12 +747,12 @@ QAbstractItemModel* PaletteProvider::availableExtraPalettesModel() const
 
     QStandardItem* root = m->invisibleRootItem();
 
-    const int masterRows = m_masterPaletteModel->rowCount();
+    const int masterRows = masterPaletteModel()->rowCount();
     for (int row = 0; row < masterRows; ++row) {
-        const QModelIndex idx = m_masterPaletteModel->index(row, 0);
+        const QModelIndex idx = masterPaletteModel()->index(row, 0);
         // add everything that cannot be found in user palette
         if (!convertIndex(idx, m_userPaletteModel).isValid()) {
-            const QString name = m_masterPaletteModel->data(idx, Qt::DisplayRole).toString();
+            const QString name = masterPaletteModel()->data(idx, Qt::DisplayRole).toString();
             QStandardItem* item = new QStandardItem(name);
             item->setData(false, CustomRole);       // this palette is from master palette, hence not custom
             item->setData(QPersistentModelIndex(idx), PaletteIndexRole);
@@ -786,8 +795,8 @@ bool PaletteProvider::addPalette(const QPersistentModelIndex& index)
         return true;
     }
 
-    if (index.model() == m_masterPaletteModel) {
-        QMimeData* data = m_masterPaletteModel->mimeData({ QModelIndex(index) });
+    if (m_masterPaletteModel && index.model() == m_masterPaletteModel) {
+        QMimeData* data = masterPaletteModel()->mimeData({ QModelIndex(index) });
         const bool success = m_userPaletteModel->dropMimeData(data, Qt::CopyAction, 0, 0, QModelIndex());
         data->deleteLater();
         return success;
@@ -849,8 +858,8 @@ bool PaletteProvider::resetPalette(const QModelIndex& index)
     }
 
     if (!resetIndex.isValid()) {
-        resetModel = m_masterPaletteModel;
-        resetIndex = convertIndex(index, m_masterPaletteModel);
+        resetModel = masterPaletteModel();
+        resetIndex = convertIndex(index, masterPaletteModel());
     }
 
     const QModelIndex userPaletteIndex = convertProxyIndex(index, m_userPaletteModel);
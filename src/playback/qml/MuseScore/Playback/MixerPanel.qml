@@ -70,6 +70,8 @@ ColumnLayout {
     MixerPanelModel {
         id: mixerPanelModel
 
+        isVisible: root.visible
+
         Component.onCompleted: {
             mixerPanelModel.load(root.navigationSection)
         }
@@ -22,6 +22,8 @@
 
 #include "mixerchannelitem.h"
 
+#include <algorithm>
+
 #include "translation.h"
 
 using namespace mu::playback;
@@ -63,11 +65,6 @@ MixerChannelItem::MixerChannelItem(QObject* parent, const audio::TrackId id, con
     });
 }
 
-MixerChannelItem::~MixerChannelItem()
-{
-    m_audioSignalChanges.resetOnReceive(this);
-}
-
 TrackId MixerChannelItem::id() const
 {
     return m_id;
@@ -192,26 +189,33 @@ void MixerChannelItem::loadSoloMuteState(project::IProjectAudioSettings::SoloMut
     }
 }
 
-void MixerChannelItem::subscribeOnAudioSignalChanges(AudioSignalChanges&& audioSignalChanges)
+void MixerChannelItem::setAudioSignalsSnapshot(AudioSignalsSnapshotPtr audioSignals)
 {
-    m_audioSignalChanges = audioSignalChanges;
+    m_audioSignals = std::move(audioSignals);
+}
 
-    m_audioSignalChanges.onReceive(this, [this](const audioch_t audioChNum, const AudioSignalVal& newValue) {
-        //!Note There should be no signal changes when the mixer channel is muted.
-        //!     But some audio signal changes still might be "on the way" from the times when the mixer channel wasn't muted
-        //!     So that we have to just ignore them
-        if (muted()) {
-            return;
-        }
+void MixerChannelItem::updateAudioSignals()
+{
+    //!Note The snapshot might still contain the values from the times when the mixer channel wasn't muted
+    //!     So that we have to just ignore them
+    if (!m_audioSignals || muted()) {
+        return;
+    }
+
+    //! NOTE Only the left and right meters are displayed, a mono output is shown on both of them
+    audioch_t audioChannelsCount = std::min<audioch_t>(m_audioSignals->audioChannelsCount(), 2);
 
-        if (newValue.pressure < MIN_DISPLAYED_DBFS) {
-            setAudioChannelVolumePressure(audioChNum, MIN_DISPLAYED_DBFS);
-        } else if (newValue.pressure > MAX_DISPLAYED_DBFS) {
-            setAudioChannelVolumePressure(audioChNum, MAX_DISPLAYED_DBFS);
+    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
+        AudioSignalVal newValue = m_audioSignals->value(audioChNum);
+        float pressure = std::clamp(newValue.pressure, MIN_DISPLAYED_DBFS, MAX_DISPLAYED_DBFS);
+
+        if (audioChannelsCount == 1) {
+            setLeftChannelPressure(pressure);
+            setRightChannelPressure(pressure);
         } else {
-            setAudioChannelVolumePressure(audioChNum, newValue.pressure);
+            setAudioChannelVolumePressure(audioChNum, pressure);
         }
-    });
+    }
 }
 
 void MixerChannelItem::setTitle(QString title)
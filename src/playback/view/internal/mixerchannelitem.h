@@ -63,8 +63,6 @@ class MixerChannelItem : public QObject, public async::Asyncable
 public:
     explicit MixerChannelItem(QObject* parent, const audio::TrackId id = -1, const bool isMaster = false);
 
-    ~MixerChannelItem();
-
     audio::TrackId id() const;
 
     bool isMasterChannel() const;
@@ -89,7 +87,9 @@ public:
     void loadOutputParams(audio::AudioOutputParams&& newParams);
     void loadSoloMuteState(project::IProjectAudioSettings::SoloMuteState&& newState);
 
-    void subscribeOnAudioSignalChanges(audio::AudioSignalChanges&& audioSignalChanges);
+    void setAudioSignalsSnapshot(audio::AudioSignalsSnapshotPtr audioSignals);
+    void updateAudioSignals();
+    void resetAudioChannelsVolumePressure();
 
     bool outputOnly() const;
 
@@ -132,7 +132,6 @@ signals:
 
 private:
     void setAudioChannelVolumePressure(const audio::audioch_t chNum, const float newValue);
-    void resetAudioChannelsVolumePressure();
 
     void applyMuteToOutputParams(const bool isMuted);
 
@@ -157,7 +156,7 @@ private:
     InputResourceItem* m_inputResourceItem = nullptr;
     QList<OutputResourceItem*> m_outputResourceItemList;
 
-    audio::AudioSignalChanges m_audioSignalChanges;
+    audio::AudioSignalsSnapshotPtr m_audioSignals = nullptr;
 
     bool m_isMaster = false;
     QString m_title;
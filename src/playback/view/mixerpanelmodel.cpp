@@ -33,12 +33,22 @@ using namespace mu::project;
 
 static constexpr int INVALID_INDEX = -1;
 
+//! NOTE The audio signal values are polled, the meters don't need to be updated more often than this
+static constexpr int AUDIO_SIGNALS_UPDATE_INTERVAL_MSECS = 1000 / 30;
+
 MixerPanelModel::MixerPanelModel(QObject* parent)
     : QAbstractListModel(parent)
 {
     controller()->currentTrackSequenceIdChanged().onNotify(this, [this]() {
         load(QVariant::fromValue(m_itemsNavigationSection));
     });
+
+    m_audioSignalsUpdateTimer.setInterval(AUDIO_SIGNALS_UPDATE_INTERVAL_MSECS);
+    connect(&m_audioSignalsUpdateTimer, &QTimer::timeout, this, &MixerPanelModel::updateAudioSignals);
+
+    controller()->isPlayingChanged().onNotify(this, [this]() {
+        updateAudioSignalsTimerState();
+    });
 }
 
 void MixerPanelModel::load(const QVariant& navigationSection)
@@ -114,6 +124,23 @@ QHash<int, QByteArray> MixerPanelModel::roleNames() const
     return roles;
 }
 
+bool MixerPanelModel::isVisible() const
+{
+    return m_isVisible;
+}
+
+void MixerPanelModel::setIsVisible(bool visible)
+{
+    if (m_isVisible == visible) {
+        return;
+    }
+
+    m_isVisible = visible;
+    emit isVisibleChanged();
+
+    updateAudioSignalsTimerState();
+}
+
 void MixerPanelModel::loadItems(const TrackSequenceId sequenceId, const TrackIdList& trackIdList)
 {
     TRACEFUNC;
@@ -194,6 +221,35 @@ void MixerPanelModel::clear()
     m_mixerChannelList.clear();
 }
 
+void MixerPanelModel::updateAudioSignals()
+{
+    for (MixerChannelItem* item : m_mixerChannelList) {
+        item->updateAudioSignals();
+    }
+}
+
+void MixerPanelModel::updateAudioSignalsTimerState()
+{
+    //! NOTE The meters are only polled while they can show something,
+    //! once the playback is stopped they fall back to silence
+    bool needUpdate = m_isVisible && controller()->isPlaying();
+
+    if (needUpdate == m_audioSignalsUpdateTimer.isActive()) {
+        return;
+    }
+
+    if (needUpdate) {
+        m_audioSignalsUpdateTimer.start();
+        return;
+    }
+
+    m_audioSignalsUpdateTimer.stop();
+
+    for (MixerChannelItem* item : m_mixerChannelList) {
+        item->resetAudioChannelsVolumePressure();
+    }
+}
+
 int MixerPanelModel::resolveInsertIndex(const audio::TrackId trackId) const
 {
     for (int i = 0; i < m_mixerChannelList.size(); ++i) {
@@ -308,12 +364,12 @@ MixerChannelItem* MixerPanelModel::buildTrackChannelItem(const audio::TrackSeque
         item->loadOutputParams(std::move(params));
     }, AsyncMode::AsyncSetRepeat);
 
-    playback()->audioOutput()->signalChanges(sequenceId, trackId)
-    .onResolve(this, [item](AudioSignalChanges signalChanges) {
-        item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+    playback()->audioOutput()->signalsSnapshot(sequenceId, trackId)
+    .onResolve(this, [item](AudioSignalsSnapshotPtr signalsSnapshot) {
+        item->setAudioSignalsSnapshot(std::move(signalsSnapshot));
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from mixer channel, error code: " << errCode
+        LOGE() << "unable to get audio signals of mixer channel, error code: " << errCode
                << ", " << text;
     });
 
@@ -352,12 +408,12 @@ MixerChannelItem* MixerPanelModel::buildMasterChannelItem()
                << ", " << text;
     });
 
-    playback()->audioOutput()->masterSignalChanges()
-    .onResolve(this, [item](AudioSignalChanges signalChanges) {
-        item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+    playback()->audioOutput()->masterSignalsSnapshot()
+    .onResolve(this, [item](AudioSignalsSnapshotPtr signalsSnapshot) {
+        item->setAudioSignalsSnapshot(std::move(signalsSnapshot));
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from master channel, error code: " << errCode
+        LOGE() << "unable to get audio signals of master channel, error code: " << errCode
                << ", " << text;
     });
 
@@ -25,6 +25,7 @@
 
 #include <QAbstractListModel>
 #include <QList>
+#include <QTimer>
 
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
@@ -46,6 +47,7 @@ class MixerPanelModel : public QAbstractListModel, public async::Asyncable
     INJECT(playback, context::IGlobalContext, context)
 
     Q_PROPERTY(int count READ rowCount NOTIFY rowCountChanged)
+    Q_PROPERTY(bool isVisible READ isVisible WRITE setIsVisible NOTIFY isVisibleChanged)
 
 public:
     explicit MixerPanelModel(QObject* parent = nullptr);
@@ -57,8 +59,14 @@ public:
     int rowCount(const QModelIndex& parent = QModelIndex()) const override;
     QHash<int, QByteArray> roleNames() const override;
 
+    bool isVisible() const;
+
+public slots:
+    void setIsVisible(bool visible);
+
 signals:
     void rowCountChanged();
+    void isVisibleChanged();
 
 private:
     enum Roles {
@@ -71,6 +79,9 @@ private:
     void updateItemsPanelsOrder();
     void clear();
 
+    void updateAudioSignals();
+    void updateAudioSignalsTimerState();
+
     int resolveInsertIndex(const audio::TrackId trackId) const;
     int indexOf(const audio::TrackId trackId) const;
 
@@ -86,6 +97,9 @@ private:
     audio::TrackSequenceId m_currentTrackSequenceId = -1;
 
     ui::NavigationSection* m_itemsNavigationSection = nullptr;
+
+    bool m_isVisible = false;
+    QTimer m_audioSignalsUpdateTimer;
 };
 }
 
@@ -48,7 +48,8 @@ public:
         UNIT_TYPE,
         PAGE_NUMBER,
         TRANSPARENT_BACKGROUND,
-        BEATS_COLORS
+        BEATS_COLORS,
+        PARTS_DEVICES //!< MULTI_PART: also write each notation as its own document to these devices (QVariantList of QIODevice*)
     };
 
     using Options = QMap<OptionKey, Val>;
@@ -63,6 +63,11 @@ bool ExportProjectScenario::exportScores(const INotationPtrList& notations, cons
         return false;
     }
 
+    //! NOTE The parts which aren't open may have a postponed layout, the page counts below depend on it
+    for (INotationPtr notation : notations) {
+        notation->elements()->msScore()->doPostponedLayout();
+    }
+
     bool isCreatingOnlyOneFile = this->isCreatingOnlyOneFile(notations, unitType);
 
     // If isCreatingOnlyOneFile, the save dialog has already asked whether to replace
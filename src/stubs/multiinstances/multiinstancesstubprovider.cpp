@@ -75,6 +75,17 @@ bool MultiInstancesStubProvider::unlockResource(const std::string&)
     return true;
 }
 
+// Clipboard
+std::string MultiInstancesStubProvider::shareClipboardData(const std::string&, const QByteArray&)
+{
+    return std::string();
+}
+
+ClipboardData MultiInstancesStubProvider::sharedClipboardData(const std::string&) const
+{
+    return ClipboardData();
+}
+
 // Instances info
 const std::string& MultiInstancesStubProvider::selfID() const
 {
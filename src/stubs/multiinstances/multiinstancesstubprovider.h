@@ -47,6 +47,10 @@ public:
     bool lockResource(const std::string& name) override;
     bool unlockResource(const std::string& name) override;
 
+    // Clipboard
+    std::string shareClipboardData(const std::string& mimeType, const QByteArray& data) override;
+    ClipboardData sharedClipboardData(const std::string& id) const override;
+
     // Instances info
     const std::string& selfID() const override;
     std::vector<InstanceMeta> instances() const override;
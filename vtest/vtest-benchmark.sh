@@ -0,0 +1,111 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-CLA-applies
+#
+# MuseScore
+# Music Composition & Notation
+#
+# Copyright (C) 2021 MuseScore BVBA and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+set -o pipefail
+
+HERE="$(dirname ${BASH_SOURCE[0]})"
+SCORES_DIR="$HERE/scores"
+OUTPUT_DIR=""
+MSCORE_BIN=build.debug/install/bin/mscore
+FORMAT="svg"
+
+while [[ "$#" -gt 0 ]]; do
+    case $1 in
+        -f|--format) FORMAT="$2"; shift ;;
+        -s|--scores) SCORES_DIR="$2"; shift ;;
+        -o|--output-dir) OUTPUT_DIR="$2"; shift ;;
+        -m|--mscore) MSCORE_BIN="$2"; shift ;;
+        *) echo "Unknown parameter passed: $1"; exit 1 ;;
+    esac
+    shift
+done
+
+case $FORMAT in
+    svg|pdf) ;;
+    *) echo "Unknown format: $FORMAT (svg or pdf)"; exit 1 ;;
+esac
+
+FORMAT_NAME=$(echo $FORMAT | tr '[:lower:]' '[:upper:]')
+
+if [ -z "$OUTPUT_DIR" ]; then
+    OUTPUT_DIR="./vtest_${FORMAT}s"
+fi
+
+echo "MuseScore VTest Benchmark ${FORMAT_NAME}s"
+
+echo "::group::Configuration:"
+echo "FORMAT: $FORMAT"
+echo "SCORES_DIR: $SCORES_DIR"
+echo "OUTPUT_DIR: $OUTPUT_DIR"
+echo "MSCORE_BIN: $MSCORE_BIN"
+echo "::endgroup::"
+
+rm -rf $OUTPUT_DIR
+mkdir -p $OUTPUT_DIR
+
+LOG_FILE=$OUTPUT_DIR/convert.log
+SCORES_LIST=$(ls -p $SCORES_DIR | grep -v /)
+
+if [ "$FORMAT" == "svg" ]; then
+    OUT_EXT="svg"
+    JSON_FILE=$OUTPUT_DIR/vtestjob.json
+
+    echo "::group::Generating JSON job file"
+    echo "[" >> $JSON_FILE
+    for score in $SCORES_LIST ; do
+        OUT_FILE=$OUTPUT_DIR/${score%.*}.svg
+        echo "{ \"in\" : \"$SCORES_DIR/$score\", \"out\" : \"$OUT_FILE\" }," >> $JSON_FILE;
+    done
+    echo "{}]" >> $JSON_FILE
+    echo "::endgroup::"
+
+    echo "::group::Generating SVG files"
+    START_TIME=$(date +%s.%N)
+    $MSCORE_BIN -j $JSON_FILE 2>&1 | tee $LOG_FILE || FAILED="true"
+    END_TIME=$(date +%s.%N)
+    echo "::endgroup::"
+else
+    # The score and all its parts, as for the online score pages (the PDFs are base64 encoded in JSON)
+    OUT_EXT="json"
+
+    echo "::group::Generating score and parts PDFs"
+    START_TIME=$(date +%s.%N)
+    for score in $SCORES_LIST ; do
+        OUT_FILE=$OUTPUT_DIR/${score%.*}.json
+        $MSCORE_BIN --score-parts-pdf $SCORES_DIR/$score -o $OUT_FILE 2>&1 | tee -a $LOG_FILE || FAILED="true"
+    done
+    END_TIME=$(date +%s.%N)
+    echo "::endgroup::"
+fi
+
+if [ -n "$FAILED" ]; then
+    echo -e "\033[0;31mGenerating ${FORMAT_NAME}s failed!\033[0m"
+    exit 1
+fi
+
+# The time includes starting MuseScore, loading and layout of the scores, so compare it only between the builds
+FILES_COUNT=$(ls $OUTPUT_DIR/*.$OUT_EXT | wc -l)
+TOTAL_BYTES=$(cat $OUTPUT_DIR/*.$OUT_EXT | wc -c)
+ELAPSED=$(echo "$END_TIME - $START_TIME" | bc)
+
+echo "Scores: $(echo "$SCORES_LIST" | wc -w)"
+echo "Output files: $FILES_COUNT"
+echo "Total size: $TOTAL_BYTES bytes"
+echo "Elapsed: $ELAPSED s"